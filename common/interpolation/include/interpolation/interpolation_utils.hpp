@@ -52,8 +52,8 @@ inline bool isNotDecreasing(const std::vector<double> & x)
   return true;
 }
 
-inline std::vector<double> validateKeys(
-  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+// throws an exception for the invalid keys without copying the query keys
+inline void checkKeys(const std::vector<double> & base_keys, const std::vector<double> & query_keys)
 {
   // when vectors are empty
   if (base_keys.empty() || query_keys.empty()) {
@@ -78,6 +78,12 @@ inline std::vector<double> validateKeys(
     base_keys.back() + epsilon < query_keys.back()) {
     throw std::invalid_argument("query_keys is out of base_keys");
   }
+}
+
+inline std::vector<double> validateKeys(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+{
+  checkKeys(base_keys, query_keys);
 
   // NOTE: Due to calculation error of double, a query key may be slightly out of base keys.
   //       Therefore, query keys are cropped here.
@@ -21,8 +21,41 @@
 
 namespace interpolation
 {
+/**
+ * @brief segment indices and ratios of the query keys on the base keys. They are shared by all the
+ * values on the same keys, so that the segments are searched only once for the values.
+ */
+struct LerpWeights
+{
+  size_t base_size{0};
+  // the query key is in [base_keys[indices[i]], base_keys[indices[i] + 1]]
+  std::vector<size_t> indices;
+  std::vector<double> ratios;
+};
+
 double lerp(const double src_val, const double dst_val, const double ratio);
 
+LerpWeights calcLerpWeights(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys);
+
+/**
+ * @brief same as above, but overwrites the weights so that their buffers are reused over the
+ * calls. It does not allocate once the buffers are large enough for the query keys.
+ */
+void calcLerpWeights(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys,
+  LerpWeights & weights);
+
+/**
+ * @brief linear interpolation with the precomputed weights
+ * @param weights segment indices and ratios calculated by calcLerpWeights
+ * @param base_values values on the base keys, whose size is weights.base_size
+ * @param query_values [out] values on the query keys, whose size is weights.indices.size()
+ */
+void lerp(const LerpWeights & weights, const double * base_values, double * query_values);
+
+std::vector<double> lerp(const LerpWeights & weights, const std::vector<double> & base_values);
+
 std::vector<double> lerp(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const std::vector<double> & query_keys);
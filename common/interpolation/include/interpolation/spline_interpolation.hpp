@@ -45,6 +45,16 @@ struct MultiSplineCoef
   std::vector<double> d;
 };
 
+// NOTE: The segments of the sorted query keys on the base keys, which are searched by a single
+//       forward sweep. They can be shared by the splines on the same base keys.
+struct SplineSegments
+{
+  // the query key is in [base_keys[indices[i]], base_keys[indices[i] + 1]]
+  std::vector<size_t> indices;
+  // query_keys[i] - base_keys[indices[i]]
+  std::vector<double> offsets;
+};
+
 // static spline interpolation functions
 std::vector<double> spline(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
@@ -65,6 +75,10 @@ std::vector<double> splineByAkima(
 //   base_keys, query_keys1);
 // const auto interpolation_result2 = spline.getSplineInterpolatedValues(
 //   base_keys, query_keys2);
+// // search the segments once for the values and the derivatives
+// const auto segments = spline.getSplineSegments(query_keys3);
+// const auto values = spline.getSplineInterpolatedValues(segments);
+// const auto diff_values = spline.getSplineInterpolatedDiffValues(segments);
 // ```
 class SplineInterpolation
 {
@@ -76,6 +90,14 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief calculate the spline coefficients.
+  //!< @details The buffers of the tridiagonal matrix algorithm are kept in the instance and
+  //            reused. When the base keys (and values) begin with the previous ones, e.g. the
+  //            previous points are extended at the end, the forward elimination of the common
+  //            part is also reused. The result is the same as the one calculated from scratch.
+  void calcSplineCoefficients(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
@@ -95,14 +117,32 @@ public:
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
 
+  //!< @brief get the segments of the sorted query keys, which are shared by the following
+  //            functions and by the other splines on the same base keys
+  interpolation::SplineSegments getSplineSegments(const std::vector<double> & query_keys) const;
+
+  std::vector<double> getSplineInterpolatedValues(
+    const interpolation::SplineSegments & segments) const;
+  std::vector<double> getSplineInterpolatedDiffValues(
+    const interpolation::SplineSegments & segments) const;
+  std::vector<double> getSplineInterpolatedQuadDiffValues(
+    const interpolation::SplineSegments & segments) const;
+
   size_t getSize() const { return base_keys_.size(); }
 
 private:
   std::vector<double> base_keys_;
+  std::vector<double> base_values_;
   interpolation::MultiSplineCoef multi_spline_coef_;
 
-  void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+  // workspace of the tridiagonal matrix algorithm, which is kept for the next calculation
+  // NOTE: den and p depend only on the base keys, and q depends on the base values as well.
+  std::vector<double> diff_keys_;
+  std::vector<double> diff_values_;
+  std::vector<double> tdma_den_;
+  std::vector<double> tdma_p_;
+  std::vector<double> tdma_q_;
+  std::vector<double> second_derivatives_;
 };
 
 #endif  // INTERPOLATION__SPLINE_INTERPOLATION_HPP_
@@ -50,8 +50,17 @@ public:
   SplineInterpolationPoints2d() = default;
   template <typename T>
   explicit SplineInterpolationPoints2d(const std::vector<T> & points)
+  {
+    calcSplineCoefficients(points);
+  }
+
+  // NOTE: The workspaces of the splines are reused, so updating the instance is cheaper than
+  //       constructing a new one, especially when the previous points are extended at the end.
+  template <typename T>
+  void calcSplineCoefficients(const std::vector<T> & points)
   {
     std::vector<geometry_msgs::msg::Point> points_inner;
+    points_inner.reserve(points.size());
     for (const auto & p : points) {
       points_inner.push_back(tier4_autoware_utils::getPoint(p));
     }
@@ -76,12 +85,27 @@ public:
   double getSplineInterpolatedCurvature(const size_t idx, const double s) const;
   std::vector<double> getSplineInterpolatedCurvatures() const;
 
+  // batched versions of the above, whose query_s are the sorted arc lengths from the first point.
+  // The segments are searched once by a single forward sweep and shared by x, y and z.
+  std::vector<geometry_msgs::msg::Pose> getSplineInterpolatedPoses(
+    const std::vector<double> & query_s) const;
+  std::vector<geometry_msgs::msg::Point> getSplineInterpolatedPoints(
+    const std::vector<double> & query_s) const;
+  std::vector<double> getSplineInterpolatedYaws(const std::vector<double> & query_s) const;
+  std::vector<double> getSplineInterpolatedCurvatures(const std::vector<double> & query_s) const;
+
   size_t getSize() const { return base_s_vec_.size(); }
   size_t getOffsetIndex(const size_t idx, const double offset) const;
   double getAccumulatedLength(const size_t idx) const;
 
 private:
   void calcSplineCoefficientsInner(const std::vector<geometry_msgs::msg::Point> & points);
+  interpolation::SplineSegments getSplineSegments(const std::vector<double> & query_s) const;
+  std::vector<double> getSplineInterpolatedYaws(
+    const interpolation::SplineSegments & segments) const;
+  std::vector<double> getSplineInterpolatedCurvatures(
+    const interpolation::SplineSegments & segments) const;
+
   SplineInterpolation spline_x_;
   SplineInterpolation spline_y_;
   SplineInterpolation spline_z_;
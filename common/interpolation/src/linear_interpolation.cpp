@@ -14,43 +14,101 @@
 
 #include "interpolation/linear_interpolation.hpp"
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 namespace interpolation
 {
+namespace
+{
+// NOTE: The input and the output must not overlap, which lets the compiler vectorize the loop with
+//       the gather instructions.
+void lerpWithWeights(
+  const size_t * __restrict indices, const double * __restrict ratios, const size_t size,
+  const double * __restrict base_values, double * __restrict query_values)
+{
+  for (size_t i = 0; i < size; ++i) {
+    const size_t key_index = indices[i];
+    query_values[i] = base_values[key_index] +
+                      (base_values[key_index + 1] - base_values[key_index]) * ratios[i];
+  }
+}
+}  // namespace
+
 double lerp(const double src_val, const double dst_val, const double ratio)
 {
   return src_val + (dst_val - src_val) * ratio;
 }
 
-std::vector<double> lerp(
-  const std::vector<double> & base_keys, const std::vector<double> & base_values,
-  const std::vector<double> & query_keys)
+LerpWeights calcLerpWeights(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys)
+{
+  LerpWeights weights;
+  calcLerpWeights(base_keys, query_keys, weights);
+  return weights;
+}
+
+void calcLerpWeights(
+  const std::vector<double> & base_keys, const std::vector<double> & query_keys,
+  LerpWeights & weights)
 {
   // throw exception for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys, query_keys);
-  interpolation_utils::validateKeysAndValues(base_keys, base_values);
+  interpolation_utils::checkKeys(base_keys, query_keys);
 
-  // calculate linear interpolation
-  std::vector<double> query_values;
+  weights.base_size = base_keys.size();
+  weights.indices.resize(query_keys.size());
+  weights.ratios.resize(query_keys.size());
   size_t key_index = 0;
-  for (const auto query_key : validated_query_keys) {
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    // NOTE: same as validateKeys, the query keys slightly out of the base keys are cropped.
+    double query_key = query_keys.at(i);
+    if (i == 0) {
+      query_key = std::max(query_key, base_keys.front());
+    }
+    if (i == query_keys.size() - 1) {
+      query_key = std::min(query_key, base_keys.back());
+    }
+
     while (base_keys.at(key_index + 1) < query_key) {
       ++key_index;
     }
 
-    const double src_val = base_values.at(key_index);
-    const double dst_val = base_values.at(key_index + 1);
-    const double ratio = (query_key - base_keys.at(key_index)) /
-                         (base_keys.at(key_index + 1) - base_keys.at(key_index));
+    weights.indices.at(i) = key_index;
+    weights.ratios.at(i) = (query_key - base_keys.at(key_index)) /
+                           (base_keys.at(key_index + 1) - base_keys.at(key_index));
+  }
+}
+
+void lerp(const LerpWeights & weights, const double * base_values, double * query_values)
+{
+  lerpWithWeights(
+    weights.indices.data(), weights.ratios.data(), weights.indices.size(), base_values,
+    query_values);
+}
 
-    const double interpolated_val = lerp(src_val, dst_val, ratio);
-    query_values.push_back(interpolated_val);
+std::vector<double> lerp(const LerpWeights & weights, const std::vector<double> & base_values)
+{
+  if (base_values.size() != weights.base_size) {
+    throw std::invalid_argument("The size of base_keys and base_values are not the same.");
   }
 
+  std::vector<double> query_values(weights.indices.size());
+  lerp(weights, base_values.data(), query_values.data());
   return query_values;
 }
 
+std::vector<double> lerp(
+  const std::vector<double> & base_keys, const std::vector<double> & base_values,
+  const std::vector<double> & query_keys)
+{
+  // throw exception for invalid arguments
+  const auto weights = calcLerpWeights(base_keys, query_keys);
+  interpolation_utils::validateKeysAndValues(base_keys, base_values);
+
+  return lerp(weights, base_values);
+}
+
 double lerp(
   const std::vector<double> & base_keys, const std::vector<double> & base_values, double query_key)
 {
@@ -18,64 +18,15 @@
 
 namespace
 {
-// solve Ax = d
-// where A is tridiagonal matrix
-//     [b_0 c_0 ...                       ]
-//     [a_0 b_1 c_1 ...               O   ]
-// A = [            ...                   ]
-//     [   O         ... a_N-3 b_N-2 c_N-2]
-//     [                   ... a_N-2 b_N-1]
-struct TDMACoef
+// the number of the leading elements which are the same in both vectors
+size_t countCommonPrefix(const std::vector<double> & a, const std::vector<double> & b)
 {
-  explicit TDMACoef(const size_t num_row)
-  {
-    a.resize(num_row - 1);
-    b.resize(num_row);
-    c.resize(num_row - 1);
-    d.resize(num_row);
+  const size_t size = std::min(a.size(), b.size());
+  size_t i = 0;
+  while (i < size && a[i] == b[i]) {
+    ++i;
   }
-
-  std::vector<double> a;
-  std::vector<double> b;
-  std::vector<double> c;
-  std::vector<double> d;
-};
-
-inline std::vector<double> solveTridiagonalMatrixAlgorithm(const TDMACoef & tdma_coef)
-{
-  const auto & a = tdma_coef.a;
-  const auto & b = tdma_coef.b;
-  const auto & c = tdma_coef.c;
-  const auto & d = tdma_coef.d;
-
-  const size_t num_row = b.size();
-
-  std::vector<double> x(num_row);
-  if (num_row != 1) {
-    // calculate p and q
-    std::vector<double> p;
-    std::vector<double> q;
-    p.push_back(-c[0] / b[0]);
-    q.push_back(d[0] / b[0]);
-
-    for (size_t i = 1; i < num_row; ++i) {
-      const double den = b[i] + a[i - 1] * p[i - 1];
-      p.push_back(-c[i - 1] / den);
-      q.push_back((d[i] - a[i - 1] * q[i - 1]) / den);
-    }
-
-    // calculate solution
-    x[num_row - 1] = q[num_row - 1];
-
-    for (size_t i = 1; i < num_row; ++i) {
-      const size_t j = num_row - 1 - i;
-      x[j] = p[j] * x[j + 1] + q[j];
-    }
-  } else {
-    x[0] = (d[0] / b[0]);
-  }
-
-  return x;
+  return i;
 }
 }  // namespace
 
@@ -174,115 +125,178 @@ void SplineInterpolation::calcSplineCoefficients(
 
   const size_t num_base = base_keys.size();  // N+1
 
-  std::vector<double> diff_keys;    // N
-  std::vector<double> diff_values;  // N
-  for (size_t i = 0; i < num_base - 1; ++i) {
-    diff_keys.push_back(base_keys.at(i + 1) - base_keys.at(i));
-    diff_values.push_back(base_values.at(i + 1) - base_values.at(i));
+  // NOTE: The differences and the rows of the tridiagonal matrix algorithm which depend only on the
+  //       leading base keys (and values) same as the previous ones are reused.
+  const size_t num_same_keys = countCommonPrefix(base_keys, base_keys_);
+  const size_t num_same_values =
+    std::min(num_same_keys, countCommonPrefix(base_values, base_values_));
+  if (num_same_values == num_base && base_keys_.size() == num_base) {
+    return;
   }
 
-  std::vector<double> v = {0.0};
+  diff_keys_.resize(num_base - 1);    // N
+  diff_values_.resize(num_base - 1);  // N
+  for (size_t i = std::max(num_same_keys, size_t{1}) - 1; i < num_base - 1; ++i) {
+    diff_keys_[i] = base_keys[i + 1] - base_keys[i];
+  }
+  for (size_t i = std::max(num_same_values, size_t{1}) - 1; i < num_base - 1; ++i) {
+    diff_values_[i] = base_values[i + 1] - base_values[i];
+  }
+
+  // second derivatives divided by 2 (= v)
+  auto & v = second_derivatives_;
+  v.assign(num_base, 0.0);
   if (num_base > 2) {
-    // solve tridiagonal matrix algorithm
-    TDMACoef tdma_coef(num_base - 2);  // N-1
-
-    for (size_t i = 0; i < num_base - 2; ++i) {
-      tdma_coef.b[i] = 2 * (diff_keys[i] + diff_keys[i + 1]);
-      if (i != num_base - 3) {
-        tdma_coef.a[i] = diff_keys[i + 1];
-        tdma_coef.c[i] = diff_keys[i + 1];
+    // solve Ax = d by the tridiagonal matrix algorithm
+    // where A is tridiagonal matrix
+    //     [b_0 c_0 ...                       ]
+    //     [a_0 b_1 c_1 ...               O   ]
+    // A = [            ...                   ]
+    //     [   O         ... a_N-3 b_N-2 c_N-2]
+    //     [                   ... a_N-2 b_N-1]
+    // and b_i = 2 (h_i + h_i+1), a_i = c_i = h_i+1 where h is the difference of the base keys.
+    // The i-th row of the forward elimination depends on the base keys and values up to the i+2-th.
+    const size_t num_row = num_base - 2;  // N-1
+    tdma_den_.resize(num_row);
+    tdma_p_.resize(num_row);
+    tdma_q_.resize(num_row);
+
+    // NOTE: den and p depend only on the base keys, so only q is updated for the rows whose keys
+    //       are the same. The other rows update all of them in a loop, where the chains of the
+    //       divisions of p and q run in parallel.
+    const size_t key_row_begin = std::max(num_same_keys, size_t{2}) - 2;
+    const size_t value_row_begin = std::max(num_same_values, size_t{2}) - 2;
+    const auto calcD = [&](const size_t i) {
+      return 6.0 * (diff_values_[i + 1] / diff_keys_[i + 1] - diff_values_[i] / diff_keys_[i]);
+    };
+    for (size_t i = value_row_begin; i < key_row_begin; ++i) {
+      tdma_q_[i] = i == 0 ? calcD(i) / tdma_den_[i]
+                          : (calcD(i) - diff_keys_[i] * tdma_q_[i - 1]) / tdma_den_[i];
+    }
+    for (size_t i = key_row_begin; i < num_row; ++i) {
+      const double b = 2 * (diff_keys_[i] + diff_keys_[i + 1]);
+      if (i == 0) {
+        tdma_den_[i] = b;
+        tdma_p_[i] = -diff_keys_[i + 1] / tdma_den_[i];
+        tdma_q_[i] = calcD(i) / tdma_den_[i];
+      } else {
+        tdma_den_[i] = b + diff_keys_[i] * tdma_p_[i - 1];
+        tdma_p_[i] = -diff_keys_[i] / tdma_den_[i];
+        tdma_q_[i] = (calcD(i) - diff_keys_[i] * tdma_q_[i - 1]) / tdma_den_[i];
       }
-      tdma_coef.d[i] =
-        6.0 * (diff_values[i + 1] / diff_keys[i + 1] - diff_values[i] / diff_keys[i]);
     }
 
-    const std::vector<double> tdma_res = solveTridiagonalMatrixAlgorithm(tdma_coef);
-
-    // calculate v
-    v.insert(v.end(), tdma_res.begin(), tdma_res.end());
+    // calculate solution
+    v[num_row] = tdma_q_[num_row - 1];
+    for (size_t i = 1; i < num_row; ++i) {
+      const size_t j = num_row - 1 - i;
+      v[j + 1] = tdma_p_[j] * v[j + 2] + tdma_q_[j];
+    }
   }
-  v.push_back(0.0);
 
   // calculate a, b, c, d of spline coefficients
-  multi_spline_coef_ = interpolation::MultiSplineCoef{num_base - 1};  // N
+  multi_spline_coef_.a.resize(num_base - 1);  // N
+  multi_spline_coef_.b.resize(num_base - 1);
+  multi_spline_coef_.c.resize(num_base - 1);
+  multi_spline_coef_.d.resize(num_base - 1);
   for (size_t i = 0; i < num_base - 1; ++i) {
-    multi_spline_coef_.a[i] = (v[i + 1] - v[i]) / 6.0 / diff_keys[i];
+    multi_spline_coef_.a[i] = (v[i + 1] - v[i]) / 6.0 / diff_keys_[i];
     multi_spline_coef_.b[i] = v[i] / 2.0;
     multi_spline_coef_.c[i] =
-      diff_values[i] / diff_keys[i] - diff_keys[i] * (2 * v[i] + v[i + 1]) / 6.0;
+      diff_values_[i] / diff_keys_[i] - diff_keys_[i] * (2 * v[i] + v[i + 1]) / 6.0;
     multi_spline_coef_.d[i] = base_values[i];
   }
 
   base_keys_ = base_keys;
+  base_values_ = base_values;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
   const std::vector<double> & query_keys) const
+{
+  return getSplineInterpolatedValues(getSplineSegments(query_keys));
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
+  const std::vector<double> & query_keys) const
+{
+  return getSplineInterpolatedDiffValues(getSplineSegments(query_keys));
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
+  const std::vector<double> & query_keys) const
+{
+  return getSplineInterpolatedQuadDiffValues(getSplineSegments(query_keys));
+}
+
+interpolation::SplineSegments SplineInterpolation::getSplineSegments(
+  const std::vector<double> & query_keys) const
 {
   // throw exceptions for invalid arguments
   const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
 
-  const auto & a = multi_spline_coef_.a;
-  const auto & b = multi_spline_coef_.b;
-  const auto & c = multi_spline_coef_.c;
-  const auto & d = multi_spline_coef_.d;
-
-  std::vector<double> res;
+  interpolation::SplineSegments segments;
+  segments.indices.reserve(validated_query_keys.size());
+  segments.offsets.reserve(validated_query_keys.size());
   size_t j = 0;
   for (const auto & query_key : validated_query_keys) {
     while (base_keys_.at(j + 1) < query_key) {
       ++j;
     }
 
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(d.at(j) + (c.at(j) + (b.at(j) + a.at(j) * ds) * ds) * ds);
+    segments.indices.push_back(j);
+    segments.offsets.push_back(query_key - base_keys_.at(j));
+  }
+
+  return segments;
+}
+
+std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
+  const interpolation::SplineSegments & segments) const
+{
+  const auto & a = multi_spline_coef_.a;
+  const auto & b = multi_spline_coef_.b;
+  const auto & c = multi_spline_coef_.c;
+  const auto & d = multi_spline_coef_.d;
+
+  std::vector<double> res(segments.indices.size());
+  for (size_t i = 0; i < res.size(); ++i) {
+    const size_t j = segments.indices[i];
+    const double ds = segments.offsets[i];
+    res[i] = d.at(j) + (c.at(j) + (b.at(j) + a.at(j) * ds) * ds) * ds;
   }
 
   return res;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedDiffValues(
-  const std::vector<double> & query_keys) const
+  const interpolation::SplineSegments & segments) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
-
   const auto & a = multi_spline_coef_.a;
   const auto & b = multi_spline_coef_.b;
   const auto & c = multi_spline_coef_.c;
 
-  std::vector<double> res;
-  size_t j = 0;
-  for (const auto & query_key : validated_query_keys) {
-    while (base_keys_.at(j + 1) < query_key) {
-      ++j;
-    }
-
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(c.at(j) + (2.0 * b.at(j) + 3.0 * a.at(j) * ds) * ds);
+  std::vector<double> res(segments.indices.size());
+  for (size_t i = 0; i < res.size(); ++i) {
+    const size_t j = segments.indices[i];
+    const double ds = segments.offsets[i];
+    res[i] = c.at(j) + (2.0 * b.at(j) + 3.0 * a.at(j) * ds) * ds;
   }
 
   return res;
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
-  const std::vector<double> & query_keys) const
+  const interpolation::SplineSegments & segments) const
 {
-  // throw exceptions for invalid arguments
-  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys_, query_keys);
-
   const auto & a = multi_spline_coef_.a;
   const auto & b = multi_spline_coef_.b;
 
-  std::vector<double> res;
-  size_t j = 0;
-  for (const auto & query_key : validated_query_keys) {
-    while (base_keys_.at(j + 1) < query_key) {
-      ++j;
-    }
-
-    const double ds = query_key - base_keys_.at(j);
-    res.push_back(2.0 * b.at(j) + 6.0 * a.at(j) * ds);
+  std::vector<double> res(segments.indices.size());
+  for (size_t i = 0; i < res.size(); ++i) {
+    const size_t j = segments.indices[i];
+    const double ds = segments.offsets[i];
+    res[i] = 2.0 * b.at(j) + 6.0 * a.at(j) * ds;
   }
 
   return res;
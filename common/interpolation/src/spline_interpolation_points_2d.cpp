@@ -78,8 +78,9 @@ std::array<std::vector<double>, 3> slerp2dFromXY(
   // calculate spline coefficients
   SplineInterpolation interpolator_x(base_keys, base_x_values);
   SplineInterpolation interpolator_y(base_keys, base_y_values);
-  const auto diff_x = interpolator_x.getSplineInterpolatedDiffValues(query_keys);
-  const auto diff_y = interpolator_y.getSplineInterpolatedDiffValues(query_keys);
+  const auto segments = interpolator_x.getSplineSegments(query_keys);
+  const auto diff_x = interpolator_x.getSplineInterpolatedDiffValues(segments);
+  const auto diff_y = interpolator_y.getSplineInterpolatedDiffValues(segments);
 
   // calculate yaw
   std::vector<double> yaw_vec;
@@ -89,8 +90,8 @@ std::array<std::vector<double>, 3> slerp2dFromXY(
   }
   // interpolate base_keys at query_keys
   return {
-    interpolator_x.getSplineInterpolatedValues(query_keys),
-    interpolator_y.getSplineInterpolatedValues(query_keys), yaw_vec};
+    interpolator_x.getSplineInterpolatedValues(segments),
+    interpolator_y.getSplineInterpolatedValues(segments), yaw_vec};
 }
 
 template <typename T>
@@ -100,12 +101,11 @@ std::vector<double> splineYawFromPoints(const std::vector<T> & points)
   SplineInterpolationPoints2d interpolator(points);
 
   // interpolate base_keys at query_keys
-  std::vector<double> yaw_vec;
+  std::vector<double> query_s(points.size());
   for (size_t i = 0; i < points.size(); ++i) {
-    const double yaw = interpolator.getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
+    query_s.at(i) = interpolator.getAccumulatedLength(i);
   }
-  return yaw_vec;
+  return interpolator.getSplineInterpolatedYaws(query_s);
 }
 template std::vector<double> splineYawFromPoints(
   const std::vector<geometry_msgs::msg::Point> & points);
@@ -115,11 +115,11 @@ template std::vector<double> splineYawFromPoints(
 geometry_msgs::msg::Pose SplineInterpolationPoints2d::getSplineInterpolatedPose(
   const size_t idx, const double s) const
 {
-  geometry_msgs::msg::Pose pose;
-  pose.position = getSplineInterpolatedPoint(idx, s);
-  pose.orientation =
-    tier4_autoware_utils::createQuaternionFromYaw(getSplineInterpolatedYaw(idx, s));
-  return pose;
+  if (base_s_vec_.size() <= idx) {
+    throw std::out_of_range("idx is out of range.");
+  }
+
+  return getSplineInterpolatedPoses({base_s_vec_.at(idx) + s}).at(0);
 }
 
 geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoint(
@@ -129,23 +129,7 @@ geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoin
     throw std::out_of_range("idx is out of range.");
   }
 
-  double whole_s = base_s_vec_.at(idx) + s;
-  if (whole_s < base_s_vec_.front()) {
-    whole_s = base_s_vec_.front();
-  }
-  if (whole_s > base_s_vec_.back()) {
-    whole_s = base_s_vec_.back();
-  }
-
-  const double x = spline_x_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double y = spline_y_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double z = spline_z_.getSplineInterpolatedValues({whole_s}).at(0);
-
-  geometry_msgs::msg::Point geom_point;
-  geom_point.x = x;
-  geom_point.y = y;
-  geom_point.z = z;
-  return geom_point;
+  return getSplineInterpolatedPoints({base_s_vec_.at(idx) + s}).at(0);
 }
 
 double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, const double s) const
@@ -154,23 +138,12 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
     throw std::out_of_range("idx is out of range.");
   }
 
-  const double whole_s =
-    std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
-
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-
-  return std::atan2(diff_y, diff_x);
+  return getSplineInterpolatedYaws({base_s_vec_.at(idx) + s}).at(0);
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws() const
 {
-  std::vector<double> yaw_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double yaw = getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
-  }
-  return yaw_vec;
+  return getSplineInterpolatedYaws(base_s_vec_);
 }
 
 double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
@@ -180,27 +153,60 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
     throw std::out_of_range("idx is out of range.");
   }
 
-  const double whole_s =
-    std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
-
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  return getSplineInterpolatedCurvatures({base_s_vec_.at(idx) + s}).at(0);
+}
 
-  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
+std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
+{
+  return getSplineInterpolatedCurvatures(base_s_vec_);
+}
 
-  return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
-         std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
+std::vector<geometry_msgs::msg::Pose> SplineInterpolationPoints2d::getSplineInterpolatedPoses(
+  const std::vector<double> & query_s) const
+{
+  const auto segments = getSplineSegments(query_s);
+  const auto x = spline_x_.getSplineInterpolatedValues(segments);
+  const auto y = spline_y_.getSplineInterpolatedValues(segments);
+  const auto z = spline_z_.getSplineInterpolatedValues(segments);
+  const auto yaws = getSplineInterpolatedYaws(segments);
+
+  std::vector<geometry_msgs::msg::Pose> poses(query_s.size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    poses.at(i).position.x = x.at(i);
+    poses.at(i).position.y = y.at(i);
+    poses.at(i).position.z = z.at(i);
+    poses.at(i).orientation = tier4_autoware_utils::createQuaternionFromYaw(yaws.at(i));
+  }
+  return poses;
 }
 
-std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
+std::vector<geometry_msgs::msg::Point> SplineInterpolationPoints2d::getSplineInterpolatedPoints(
+  const std::vector<double> & query_s) const
 {
-  std::vector<double> curvature_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double curvature = getSplineInterpolatedCurvature(i, 0.0);
-    curvature_vec.push_back(curvature);
+  const auto segments = getSplineSegments(query_s);
+  const auto x = spline_x_.getSplineInterpolatedValues(segments);
+  const auto y = spline_y_.getSplineInterpolatedValues(segments);
+  const auto z = spline_z_.getSplineInterpolatedValues(segments);
+
+  std::vector<geometry_msgs::msg::Point> points(query_s.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    points.at(i).x = x.at(i);
+    points.at(i).y = y.at(i);
+    points.at(i).z = z.at(i);
   }
-  return curvature_vec;
+  return points;
+}
+
+std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws(
+  const std::vector<double> & query_s) const
+{
+  return getSplineInterpolatedYaws(getSplineSegments(query_s));
+}
+
+std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures(
+  const std::vector<double> & query_s) const
+{
+  return getSplineInterpolatedCurvatures(getSplineSegments(query_s));
 }
 
 size_t SplineInterpolationPoints2d::getOffsetIndex(const size_t idx, const double offset) const
@@ -233,7 +239,51 @@ void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
   const auto & base_z_vec = base.at(3);
 
   // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  spline_x_.calcSplineCoefficients(base_s_vec_, base_x_vec);
+  spline_y_.calcSplineCoefficients(base_s_vec_, base_y_vec);
+  spline_z_.calcSplineCoefficients(base_s_vec_, base_z_vec);
+}
+
+interpolation::SplineSegments SplineInterpolationPoints2d::getSplineSegments(
+  const std::vector<double> & query_s) const
+{
+  if (base_s_vec_.empty()) {
+    throw std::logic_error("The spline coefficients are not calculated.");
+  }
+
+  std::vector<double> whole_s(query_s.size());
+  for (size_t i = 0; i < query_s.size(); ++i) {
+    whole_s.at(i) = std::clamp(query_s.at(i), base_s_vec_.front(), base_s_vec_.back());
+  }
+  return spline_x_.getSplineSegments(whole_s);
+}
+
+std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws(
+  const interpolation::SplineSegments & segments) const
+{
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(segments);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(segments);
+
+  std::vector<double> yaw_vec(diff_x.size());
+  for (size_t i = 0; i < yaw_vec.size(); ++i) {
+    yaw_vec.at(i) = std::atan2(diff_y.at(i), diff_x.at(i));
+  }
+  return yaw_vec;
+}
+
+std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures(
+  const interpolation::SplineSegments & segments) const
+{
+  const auto diff_x = spline_x_.getSplineInterpolatedDiffValues(segments);
+  const auto diff_y = spline_y_.getSplineInterpolatedDiffValues(segments);
+  const auto quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues(segments);
+  const auto quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues(segments);
+
+  std::vector<double> curvature_vec(diff_x.size());
+  for (size_t i = 0; i < curvature_vec.size(); ++i) {
+    curvature_vec.at(i) =
+      (diff_x.at(i) * quad_diff_y.at(i) - quad_diff_x.at(i) * diff_y.at(i)) /
+      std::pow(std::pow(diff_x.at(i), 2) + std::pow(diff_y.at(i), 2), 1.5);
+  }
+  return curvature_vec;
 }
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <stdexcept>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -92,3 +93,63 @@ TEST(linear_interpolation, lerp_scalar_query)
     }
   }
 }
+
+TEST(linear_interpolation, lerp_weights)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 8.0, 8.0, 18.0, 20.0};
+
+  const auto weights = interpolation::calcLerpWeights(base_keys, query_keys);
+  EXPECT_EQ(weights.base_size, base_keys.size());
+  const std::vector<size_t> ans_indices{0, 0, 0, 2, 2, 4, 4};
+  const std::vector<double> ans_ratios{0.0, 0.6, 1.0, 0.6, 0.6, 0.6, 1.0};
+  ASSERT_EQ(weights.indices.size(), query_keys.size());
+  ASSERT_EQ(weights.ratios.size(), query_keys.size());
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_EQ(weights.indices.at(i), ans_indices.at(i));
+    EXPECT_NEAR(weights.ratios.at(i), ans_ratios.at(i), epsilon);
+  }
+
+  // the weights are shared by the values on the same keys
+  const std::vector<std::vector<double>> base_values_list{
+    {-1.2, 0.5, 1.0, 1.2, 2.0, 1.0}, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0}};
+  for (const auto & base_values : base_values_list) {
+    const auto query_values = interpolation::lerp(weights, base_values);
+    const auto ans = interpolation::lerp(base_keys, base_values, query_keys);
+    ASSERT_EQ(query_values.size(), ans.size());
+    for (size_t i = 0; i < query_values.size(); ++i) {
+      EXPECT_EQ(query_values.at(i), ans.at(i));
+    }
+  }
+
+  // size of the base values is different from the base keys
+  EXPECT_THROW(
+    interpolation::lerp(weights, std::vector<double>{0.0, 1.0, 2.0}), std::invalid_argument);
+  // query keys out of the base keys
+  EXPECT_THROW(
+    interpolation::calcLerpWeights(base_keys, std::vector<double>{0.0, 30.0}),
+    std::invalid_argument);
+}
+
+TEST(linear_interpolation, lerp_weights_reuse)
+{
+  const std::vector<double> base_keys{0.0, 1.0, 2.0, 3.0};
+
+  // the weights are overwritten even if the previous query keys are more than the current ones
+  interpolation::LerpWeights weights;
+  interpolation::calcLerpWeights(base_keys, std::vector<double>{0.0, 0.5, 1.5, 2.5, 3.0}, weights);
+  const std::vector<double> query_keys{-1e-4, 2.2, 3.0 + 1e-4};
+  interpolation::calcLerpWeights(base_keys, query_keys, weights);
+
+  const auto ans = interpolation::calcLerpWeights(base_keys, query_keys);
+  EXPECT_EQ(weights.base_size, ans.base_size);
+  EXPECT_EQ(weights.indices, ans.indices);
+  ASSERT_EQ(weights.ratios.size(), ans.ratios.size());
+  for (size_t i = 0; i < ans.ratios.size(); ++i) {
+    EXPECT_NEAR(weights.ratios.at(i), ans.ratios.at(i), epsilon);
+  }
+
+  // the query keys slightly out of the base keys are cropped
+  EXPECT_NEAR(weights.ratios.front(), 0.0, epsilon);
+  EXPECT_NEAR(weights.ratios.back(), 1.0, epsilon);
+}
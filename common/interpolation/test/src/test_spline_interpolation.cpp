@@ -267,3 +267,89 @@ TEST(spline_interpolation, SplineInterpolation)
     }
   }
 }
+
+TEST(spline_interpolation, SplineInterpolationSegments)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 8.0, 12.0, 18.0, 20.0};
+
+  SplineInterpolation s(base_keys, base_values);
+  const auto segments = s.getSplineSegments(query_keys);
+
+  const std::vector<size_t> ans_indices{0, 0, 0, 2, 3, 4, 4};
+  EXPECT_EQ(segments.indices, ans_indices);
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    EXPECT_NEAR(
+      segments.offsets.at(i), query_keys.at(i) - base_keys.at(segments.indices.at(i)), epsilon);
+  }
+
+  // the same as the ones searching the segments by themselves
+  EXPECT_EQ(s.getSplineInterpolatedValues(segments), s.getSplineInterpolatedValues(query_keys));
+  EXPECT_EQ(
+    s.getSplineInterpolatedDiffValues(segments), s.getSplineInterpolatedDiffValues(query_keys));
+  EXPECT_EQ(
+    s.getSplineInterpolatedQuadDiffValues(segments),
+    s.getSplineInterpolatedQuadDiffValues(query_keys));
+
+  // the segments are shared by the spline on the same base keys
+  const std::vector<double> other_base_values{0.3, -0.2, 1.5, 0.0, 0.8, 2.0};
+  SplineInterpolation other_s(base_keys, other_base_values);
+  EXPECT_EQ(
+    other_s.getSplineInterpolatedValues(segments),
+    other_s.getSplineInterpolatedValues(query_keys));
+
+  // query_keys is not sorted
+  EXPECT_THROW(s.getSplineSegments({8.0, 0.0}), std::invalid_argument);
+}
+
+TEST(spline_interpolation, SplineInterpolationReuse)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0, 22.0, 27.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0, 0.7, 1.5};
+
+  const auto calcSubVector = [](const std::vector<double> & v, const size_t size) {
+    return std::vector<double>(v.begin(), v.begin() + size);
+  };
+
+  // the results of the reused instance are the same as the ones calculated from scratch
+  SplineInterpolation reused_s;
+  const auto expectSameAsScratch = [&](const std::vector<double> & keys, const auto & values) {
+    reused_s.calcSplineCoefficients(keys, values);
+    const SplineInterpolation scratch_s(keys, values);
+    EXPECT_EQ(reused_s.getSize(), keys.size());
+    EXPECT_EQ(
+      reused_s.getSplineInterpolatedValues(keys), scratch_s.getSplineInterpolatedValues(keys));
+    EXPECT_EQ(
+      reused_s.getSplineInterpolatedQuadDiffValues(keys),
+      scratch_s.getSplineInterpolatedQuadDiffValues(keys));
+  };
+
+  {  // extended at the end
+    for (size_t size = 2; size <= base_keys.size(); ++size) {
+      expectSameAsScratch(calcSubVector(base_keys, size), calcSubVector(base_values, size));
+    }
+  }
+
+  {  // same keys with different values
+    const std::vector<double> other_base_values{0.3, -0.2, 1.5, 0.0, 0.8, 2.0, 1.0, -1.0};
+    expectSameAsScratch(base_keys, other_base_values);
+    expectSameAsScratch(base_keys, other_base_values);
+  }
+
+  {  // shortened
+    expectSameAsScratch(calcSubVector(base_keys, 4), calcSubVector(base_values, 4));
+  }
+
+  {  // different keys
+    const std::vector<double> other_base_keys{0.0, 2.0, 3.0, 7.0};
+    expectSameAsScratch(other_base_keys, calcSubVector(base_values, 4));
+  }
+
+  {  // invalid arguments do not break the instance
+    EXPECT_THROW(
+      reused_s.calcSplineCoefficients(base_keys, calcSubVector(base_values, 4)),
+      std::invalid_argument);
+    expectSameAsScratch(base_keys, base_values);
+  }
+}
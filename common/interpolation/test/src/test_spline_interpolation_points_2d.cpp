@@ -197,6 +197,87 @@ TEST(spline_interpolation, SplineInterpolationPoints2d)
   EXPECT_THROW(SplineInterpolationPoints2d{single_points}, std::logic_error);
 }
 
+TEST(spline_interpolation, SplineInterpolationPoints2dBatch)
+{
+  using tier4_autoware_utils::createPoint;
+
+  // curve
+  std::vector<geometry_msgs::msg::Point> points;
+  points.push_back(createPoint(-2.0, -10.0, 0.0));
+  points.push_back(createPoint(2.0, 1.5, 0.0));
+  points.push_back(createPoint(3.0, 3.0, 0.5));
+  points.push_back(createPoint(5.0, 10.0, 1.0));
+  points.push_back(createPoint(10.0, 12.5, 0.0));
+
+  SplineInterpolationPoints2d s(points);
+
+  // including out of range of total length
+  const std::vector<double> query_s{-0.1, 0.0, 5.0, 12.3, 21.2586811, 21.7586811, 26.8488511, 27.0};
+  const auto batch_poses = s.getSplineInterpolatedPoses(query_s);
+  const auto batch_points = s.getSplineInterpolatedPoints(query_s);
+  const auto batch_yaws = s.getSplineInterpolatedYaws(query_s);
+  const auto batch_curvatures = s.getSplineInterpolatedCurvatures(query_s);
+  ASSERT_EQ(batch_poses.size(), query_s.size());
+  ASSERT_EQ(batch_points.size(), query_s.size());
+  ASSERT_EQ(batch_yaws.size(), query_s.size());
+  ASSERT_EQ(batch_curvatures.size(), query_s.size());
+
+  for (size_t i = 0; i < query_s.size(); ++i) {
+    const auto pose = s.getSplineInterpolatedPose(0, query_s.at(i));
+    EXPECT_DOUBLE_EQ(batch_poses.at(i).position.x, pose.position.x);
+    EXPECT_DOUBLE_EQ(batch_poses.at(i).position.y, pose.position.y);
+    EXPECT_DOUBLE_EQ(batch_poses.at(i).position.z, pose.position.z);
+    EXPECT_DOUBLE_EQ(batch_poses.at(i).orientation.z, pose.orientation.z);
+    EXPECT_DOUBLE_EQ(batch_poses.at(i).orientation.w, pose.orientation.w);
+
+    const auto point = s.getSplineInterpolatedPoint(0, query_s.at(i));
+    EXPECT_DOUBLE_EQ(batch_points.at(i).x, point.x);
+    EXPECT_DOUBLE_EQ(batch_points.at(i).y, point.y);
+    EXPECT_DOUBLE_EQ(batch_points.at(i).z, point.z);
+
+    EXPECT_DOUBLE_EQ(batch_yaws.at(i), s.getSplineInterpolatedYaw(0, query_s.at(i)));
+    EXPECT_DOUBLE_EQ(batch_curvatures.at(i), s.getSplineInterpolatedCurvature(0, query_s.at(i)));
+  }
+
+  // random
+  EXPECT_NEAR(batch_points.at(5).x, 5.3036484, epsilon);
+  EXPECT_NEAR(batch_points.at(5).y, 10.3343074, epsilon);
+  EXPECT_NEAR(batch_yaws.at(5), 0.7757198, epsilon);
+  EXPECT_NEAR(batch_curvatures.at(5), -0.2441671, epsilon);
+
+  // query_s is not sorted
+  EXPECT_THROW(s.getSplineInterpolatedPoints({5.0, 0.0}), std::invalid_argument);
+
+  // the spline coefficients are not calculated
+  EXPECT_THROW(SplineInterpolationPoints2d{}.getSplineInterpolatedPoints({0.0}), std::logic_error);
+}
+
+TEST(spline_interpolation, SplineInterpolationPoints2dReuse)
+{
+  using tier4_autoware_utils::createPoint;
+
+  std::vector<geometry_msgs::msg::Point> points;
+  points.push_back(createPoint(-2.0, -10.0, 0.0));
+  points.push_back(createPoint(2.0, 1.5, 0.0));
+  points.push_back(createPoint(3.0, 3.0, 0.0));
+
+  // the points are extended at the end
+  SplineInterpolationPoints2d reused_s(points);
+  for (const auto & p : {createPoint(5.0, 10.0, 0.0), createPoint(10.0, 12.5, 0.0)}) {
+    points.push_back(p);
+    reused_s.calcSplineCoefficients(points);
+    const SplineInterpolationPoints2d scratch_s(points);
+
+    ASSERT_EQ(reused_s.getSize(), scratch_s.getSize());
+    EXPECT_EQ(reused_s.getSplineInterpolatedYaws(), scratch_s.getSplineInterpolatedYaws());
+    EXPECT_EQ(
+      reused_s.getSplineInterpolatedCurvatures(), scratch_s.getSplineInterpolatedCurvatures());
+  }
+
+  // random
+  EXPECT_NEAR(reused_s.getSplineInterpolatedYaw(3, 0.5), 0.7757198, epsilon);
+}
+
 TEST(spline_interpolation, SplineInterpolationPoints2dPolymorphism)
 {
   using autoware_auto_planning_msgs::msg::TrajectoryPoint;
@@ -18,6 +18,7 @@
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 #include "tier4_autoware_utils/geometry/pose_deviation.hpp"
 #include "tier4_autoware_utils/math/constants.hpp"
+#include "tier4_autoware_utils/math/trigonometry.hpp"
 #include "tier4_autoware_utils/system/backtrace.hpp"
 
 #include <Eigen/Geometry>
@@ -27,6 +28,7 @@
 #include <autoware_auto_planning_msgs/msg/trajectory_point.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <optional>
 #include <stdexcept>
@@ -1855,32 +1857,43 @@ insertDecelPoint<std::vector<autoware_auto_planning_msgs::msg::TrajectoryPoint>>
 template <class T>
 void insertOrientation(T & points, const bool is_driving_forward)
 {
+  if (points.size() < 2) {
+    return;
+  }
+
+  // The orientation of each point is the direction to the next point (the previous point when
+  // driving backward). The angles of all the segments are calculated at once by the vectorized
+  // kernels instead of calling calcElevationAngle and calcAzimuthAngle for each segment.
+  const size_t num_segments = points.size() - 1;
+  std::vector<double> dx(num_segments);
+  std::vector<double> dy(num_segments);
+  std::vector<double> dz(num_segments);
+  std::vector<double> dist_2d(num_segments);
+  for (size_t i = 0; i < num_segments; ++i) {
+    const size_t src_idx = is_driving_forward ? i : i + 1;
+    const size_t dst_idx = is_driving_forward ? i + 1 : i;
+    const auto & src_point = tier4_autoware_utils::getPoint(points.at(src_idx));
+    const auto & dst_point = tier4_autoware_utils::getPoint(points.at(dst_idx));
+    dx.at(i) = dst_point.x - src_point.x;
+    dy.at(i) = dst_point.y - src_point.y;
+    dz.at(i) = dst_point.z - src_point.z;
+    dist_2d.at(i) = std::hypot(dx.at(i), dy.at(i));
+  }
+  const auto pitches = tier4_autoware_utils::atan2(dz, dist_2d);
+  const auto yaws = tier4_autoware_utils::atan2(dy, dx);
+  const auto orientations = tier4_autoware_utils::createQuaternionFromRPY(
+    std::vector<double>(num_segments, 0.0), pitches, yaws);
+
+  for (size_t i = 0; i < num_segments; ++i) {
+    const size_t src_idx = is_driving_forward ? i : i + 1;
+    tier4_autoware_utils::setOrientation(orientations.at(i), points.at(src_idx));
+  }
   if (is_driving_forward) {
-    for (size_t i = 0; i < points.size() - 1; ++i) {
-      const auto & src_point = tier4_autoware_utils::getPoint(points.at(i));
-      const auto & dst_point = tier4_autoware_utils::getPoint(points.at(i + 1));
-      const double pitch = tier4_autoware_utils::calcElevationAngle(src_point, dst_point);
-      const double yaw = tier4_autoware_utils::calcAzimuthAngle(src_point, dst_point);
-      tier4_autoware_utils::setOrientation(
-        tier4_autoware_utils::createQuaternionFromRPY(0.0, pitch, yaw), points.at(i));
-      if (i == points.size() - 2) {
-        // Terminal orientation is same as the point before it
-        tier4_autoware_utils::setOrientation(
-          tier4_autoware_utils::getPose(points.at(i)).orientation, points.at(i + 1));
-      }
-    }
+    // Terminal orientation is same as the point before it
+    tier4_autoware_utils::setOrientation(orientations.back(), points.back());
   } else {
-    for (size_t i = points.size() - 1; i >= 1; --i) {
-      const auto & src_point = tier4_autoware_utils::getPoint(points.at(i));
-      const auto & dst_point = tier4_autoware_utils::getPoint(points.at(i - 1));
-      const double pitch = tier4_autoware_utils::calcElevationAngle(src_point, dst_point);
-      const double yaw = tier4_autoware_utils::calcAzimuthAngle(src_point, dst_point);
-      tier4_autoware_utils::setOrientation(
-        tier4_autoware_utils::createQuaternionFromRPY(0.0, pitch, yaw), points.at(i));
-    }
     // Initial orientation is same as the point after it
-    tier4_autoware_utils::setOrientation(
-      tier4_autoware_utils::getPose(points.at(1)).orientation, points.at(0));
+    tier4_autoware_utils::setOrientation(orientations.front(), points.front());
   }
 }
 
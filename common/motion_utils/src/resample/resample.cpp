@@ -21,8 +21,76 @@
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace motion_utils
 {
+namespace
+{
+// The fields of the points are stored in the structure-of-arrays layout, so that the segment of
+// each resampled point is searched only once and all the fields are interpolated with the same
+// weights in the loops which the compiler vectorizes.
+enum PointField : size_t { POINT_X = 0, POINT_Y, POINT_Z, NUM_POINT_FIELDS };
+
+// NOTE: The fields which can be interpolated by zero order hold come first.
+enum PathField : size_t { PATH_V_LON = 0, PATH_V_LAT, PATH_HEADING_RATE, NUM_PATH_FIELDS };
+constexpr size_t num_path_twist_fields = 2;
+
+enum TrajectoryField : size_t {
+  TRAJ_V_LON = 0,
+  TRAJ_V_LAT,
+  TRAJ_ACCELERATION,
+  TRAJ_HEADING_RATE,
+  TRAJ_FRONT_WHEEL_ANGLE,
+  TRAJ_REAR_WHEEL_ANGLE,
+  TRAJ_TIME_FROM_START,
+  NUM_TRAJ_FIELDS
+};
+constexpr size_t num_traj_twist_fields = 3;
+
+class ScalarFields
+{
+public:
+  ScalarFields(const size_t num_fields, const size_t num_points)
+  : num_points_(num_points), values_(num_fields * num_points)
+  {
+  }
+
+  double * data(const size_t field) { return values_.data() + field * num_points_; }
+  const double * data(const size_t field) const { return values_.data() + field * num_points_; }
+  double & at(const size_t field, const size_t i) { return values_[field * num_points_ + i]; }
+  double at(const size_t field, const size_t i) const { return values_[field * num_points_ + i]; }
+
+  // interpolate the fields in [begin_field, end_field) to the same fields of the output
+  void lerp(
+    const interpolation::LerpWeights & weights, const size_t begin_field, const size_t end_field,
+    ScalarFields & output) const
+  {
+    for (size_t field = begin_field; field < end_field; ++field) {
+      interpolation::lerp(weights, data(field), output.data(field));
+    }
+  }
+
+  void zeroOrderHold(
+    const std::vector<size_t> & closest_segment_indices, const size_t begin_field,
+    const size_t end_field, ScalarFields & output) const
+  {
+    for (size_t field = begin_field; field < end_field; ++field) {
+      const double * input_values = data(field);
+      double * output_values = output.data(field);
+      for (size_t i = 0; i < closest_segment_indices.size(); ++i) {
+        output_values[i] = input_values[closest_segment_indices[i]];
+      }
+    }
+  }
+
+private:
+  size_t num_points_;
+  std::vector<double> values_;
+};
+}  // namespace
+
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
   const std::vector<geometry_msgs::msg::Point> & points,
   const std::vector<double> & resampled_arclength, const bool use_akima_spline_for_xy,
@@ -35,53 +103,66 @@ std::vector<geometry_msgs::msg::Point> resamplePointVector(
 
   // Input Path Information
   std::vector<double> input_arclength;
-  std::vector<double> x;
-  std::vector<double> y;
-  std::vector<double> z;
+  ScalarFields input_fields(NUM_POINT_FIELDS, points.size());
   input_arclength.reserve(points.size());
-  x.reserve(points.size());
-  y.reserve(points.size());
-  z.reserve(points.size());
 
   input_arclength.push_back(0.0);
-  x.push_back(points.front().x);
-  y.push_back(points.front().y);
-  z.push_back(points.front().z);
-  for (size_t i = 1; i < points.size(); ++i) {
-    const auto & prev_pt = points.at(i - 1);
+  for (size_t i = 0; i < points.size(); ++i) {
     const auto & curr_pt = points.at(i);
-    const double ds = tier4_autoware_utils::calcDistance2d(prev_pt, curr_pt);
-    input_arclength.push_back(ds + input_arclength.back());
-    x.push_back(curr_pt.x);
-    y.push_back(curr_pt.y);
-    z.push_back(curr_pt.z);
+    if (i > 0) {
+      const double ds = tier4_autoware_utils::calcDistance2d(points.at(i - 1), curr_pt);
+      input_arclength.push_back(ds + input_arclength.back());
+    }
+    input_fields.at(POINT_X, i) = curr_pt.x;
+    input_fields.at(POINT_Y, i) = curr_pt.y;
+    input_fields.at(POINT_Z, i) = curr_pt.z;
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
+  // NOTE: The segments are searched only once for the fields interpolated linearly.
+  ScalarFields interpolated_fields(NUM_POINT_FIELDS, resampled_arclength.size());
+  interpolation::LerpWeights weights;
+  const auto lerp = [&](const size_t field) {
+    if (weights.indices.empty()) {
+      weights = interpolation::calcLerpWeights(input_arclength, resampled_arclength);
+    }
+    input_fields.lerp(weights, field, field + 1, interpolated_fields);
   };
-  const auto spline = [&](const auto & input) {
-    return interpolation::spline(input_arclength, input, resampled_arclength);
+  const auto spline = [&](const size_t field) {
+    const std::vector<double> input(
+      input_fields.data(field), input_fields.data(field) + points.size());
+    const auto interpolated =
+      interpolation::spline(input_arclength, input, resampled_arclength);
+    std::copy(interpolated.begin(), interpolated.end(), interpolated_fields.data(field));
   };
-  const auto spline_by_akima = [&](const auto & input) {
-    return interpolation::splineByAkima(input_arclength, input, resampled_arclength);
+  const auto spline_by_akima = [&](const size_t field) {
+    const std::vector<double> input(
+      input_fields.data(field), input_fields.data(field) + points.size());
+    const auto interpolated =
+      interpolation::splineByAkima(input_arclength, input, resampled_arclength);
+    std::copy(interpolated.begin(), interpolated.end(), interpolated_fields.data(field));
   };
 
-  const auto interpolated_x = use_akima_spline_for_xy ? lerp(x) : spline_by_akima(x);
-  const auto interpolated_y = use_akima_spline_for_xy ? lerp(y) : spline_by_akima(y);
-  const auto interpolated_z = use_lerp_for_z ? lerp(z) : spline(z);
-
-  std::vector<geometry_msgs::msg::Point> resampled_points;
-  resampled_points.resize(interpolated_x.size());
+  for (const size_t field : {POINT_X, POINT_Y}) {
+    if (use_akima_spline_for_xy) {
+      lerp(field);
+    } else {
+      spline_by_akima(field);
+    }
+  }
+  if (use_lerp_for_z) {
+    lerp(POINT_Z);
+  } else {
+    spline(POINT_Z);
+  }
 
   // Insert Position
+  std::vector<geometry_msgs::msg::Point> resampled_points(resampled_arclength.size());
   for (size_t i = 0; i < resampled_points.size(); ++i) {
-    geometry_msgs::msg::Point point;
-    point.x = interpolated_x.at(i);
-    point.y = interpolated_y.at(i);
-    point.z = interpolated_z.at(i);
-    resampled_points.at(i) = point;
+    auto & point = resampled_points.at(i);
+    point.x = interpolated_fields.at(POINT_X, i);
+    point.y = interpolated_fields.at(POINT_Y, i);
+    point.z = interpolated_fields.at(POINT_Z, i);
   }
 
   return resampled_points;
@@ -236,38 +317,23 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
   // Input Path Information
   std::vector<double> input_arclength;
   std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<bool> is_final;
-  std::vector<std::vector<int64_t>> lane_ids;
+  ScalarFields input_fields(NUM_PATH_FIELDS, input_path.points.size());
   input_arclength.reserve(input_path.points.size());
   input_pose.reserve(input_path.points.size());
-  v_lon.reserve(input_path.points.size());
-  v_lat.reserve(input_path.points.size());
-  heading_rate.reserve(input_path.points.size());
-  is_final.reserve(input_path.points.size());
-  lane_ids.reserve(input_path.points.size());
 
   input_arclength.push_back(0.0);
-  input_pose.push_back(input_path.points.front().point.pose);
-  v_lon.push_back(input_path.points.front().point.longitudinal_velocity_mps);
-  v_lat.push_back(input_path.points.front().point.lateral_velocity_mps);
-  heading_rate.push_back(input_path.points.front().point.heading_rate_rps);
-  is_final.push_back(input_path.points.front().point.is_final);
-  lane_ids.push_back(input_path.points.front().lane_ids);
-  for (size_t i = 1; i < input_path.points.size(); ++i) {
-    const auto & prev_pt = input_path.points.at(i - 1).point;
+  for (size_t i = 0; i < input_path.points.size(); ++i) {
     const auto & curr_pt = input_path.points.at(i).point;
-    const double ds =
-      tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
+    if (i > 0) {
+      const auto & prev_pt = input_path.points.at(i - 1).point;
+      const double ds =
+        tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
+      input_arclength.push_back(ds + input_arclength.back());
+    }
     input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    is_final.push_back(curr_pt.is_final);
-    lane_ids.push_back(input_path.points.at(i).lane_ids);
+    input_fields.at(PATH_V_LON, i) = curr_pt.longitudinal_velocity_mps;
+    input_fields.at(PATH_V_LAT, i) = curr_pt.lateral_velocity_mps;
+    input_fields.at(PATH_HEADING_RATE, i) = curr_pt.heading_rate_rps;
   }
 
   if (input_arclength.back() < resampling_arclength.back()) {
@@ -277,78 +343,67 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampling_arclength);
-  };
-
-  auto closest_segment_indices =
+  const auto closest_segment_indices =
     interpolation::calc_closest_segment_indices(input_arclength, resampling_arclength);
-
-  const auto zoh = [&](const auto & input) {
-    return interpolation::zero_order_hold(input_arclength, input, closest_segment_indices);
-  };
+  const auto weights = interpolation::calcLerpWeights(input_arclength, resampling_arclength);
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_is_final = zoh(is_final);
-
-  // interpolate lane_ids
-  std::vector<std::vector<int64_t>> interpolated_lane_ids;
-  interpolated_lane_ids.resize(resampling_arclength.size());
+  ScalarFields interpolated_fields(NUM_PATH_FIELDS, resampling_arclength.size());
+  if (use_zero_order_hold_for_v) {
+    input_fields.zeroOrderHold(
+      closest_segment_indices, 0, num_path_twist_fields, interpolated_fields);
+    input_fields.lerp(weights, num_path_twist_fields, NUM_PATH_FIELDS, interpolated_fields);
+  } else {
+    input_fields.lerp(weights, 0, NUM_PATH_FIELDS, interpolated_fields);
+  }
+
+  if (interpolated_pose.size() != resampling_arclength.size()) {
+    std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
+              << std::endl;
+    return input_path;
+  }
+
+  autoware_auto_planning_msgs::msg::PathWithLaneId resampled_path;
+  resampled_path.header = input_path.header;
+  resampled_path.left_bound = input_path.left_bound;
+  resampled_path.right_bound = input_path.right_bound;
+  resampled_path.points.resize(interpolated_pose.size());
   constexpr double epsilon = 1e-6;
-  for (size_t i = 0; i < resampling_arclength.size(); ++i) {
+  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
+    auto & path_point = resampled_path.points.at(i).point;
+    path_point.pose = interpolated_pose.at(i);
+    path_point.longitudinal_velocity_mps = interpolated_fields.at(PATH_V_LON, i);
+    path_point.lateral_velocity_mps = interpolated_fields.at(PATH_V_LAT, i);
+    path_point.heading_rate_rps = interpolated_fields.at(PATH_HEADING_RATE, i);
+    path_point.is_final = input_path.points.at(closest_segment_indices.at(i)).point.is_final;
+
+    // interpolate lane_ids
+    auto & interpolated_lane_ids = resampled_path.points.at(i).lane_ids;
     const size_t seg_idx = std::min(closest_segment_indices.at(i), input_path.points.size() - 2);
     const auto & prev_lane_ids = input_path.points.at(seg_idx).lane_ids;
     const auto & next_lane_ids = input_path.points.at(seg_idx + 1).lane_ids;
 
     if (std::abs(input_arclength.at(seg_idx) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
+      interpolated_lane_ids = prev_lane_ids;
     } else if (std::abs(input_arclength.at(seg_idx + 1) - resampling_arclength.at(i)) <= epsilon) {
-      interpolated_lane_ids.at(i).insert(
-        interpolated_lane_ids.at(i).end(), next_lane_ids.begin(), next_lane_ids.end());
+      interpolated_lane_ids = next_lane_ids;
     } else {
       // extract lane_ids those prev_lane_ids and next_lane_ids have in common
       for (const auto target_lane_id : prev_lane_ids) {
         if (
           std::find(next_lane_ids.begin(), next_lane_ids.end(), target_lane_id) !=
           next_lane_ids.end()) {
-          interpolated_lane_ids.at(i).push_back(target_lane_id);
+          interpolated_lane_ids.push_back(target_lane_id);
         }
       }
       // If there are no common lane_ids, the prev_lane_ids is assigned.
-      if (interpolated_lane_ids.at(i).empty()) {
-        interpolated_lane_ids.at(i).insert(
-          interpolated_lane_ids.at(i).end(), prev_lane_ids.begin(), prev_lane_ids.end());
+      if (interpolated_lane_ids.empty()) {
+        interpolated_lane_ids = prev_lane_ids;
       }
     }
   }
 
-  if (interpolated_pose.size() != resampling_arclength.size()) {
-    std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
-              << std::endl;
-    return input_path;
-  }
-
-  autoware_auto_planning_msgs::msg::PathWithLaneId resampled_path;
-  resampled_path.header = input_path.header;
-  resampled_path.left_bound = input_path.left_bound;
-  resampled_path.right_bound = input_path.right_bound;
-  resampled_path.points.resize(interpolated_pose.size());
-  for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::PathPoint path_point;
-    path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    path_point.is_final = interpolated_is_final.at(i);
-    resampled_path.points.at(i).point = path_point;
-    resampled_path.points.at(i).lane_ids = interpolated_lane_ids.at(i);
-  }
-
   return resampled_path;
 }
 
@@ -431,51 +486,40 @@ autoware_auto_planning_msgs::msg::Path resamplePath(
   // Input Path Information
   std::vector<double> input_arclength;
   std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
+  ScalarFields input_fields(NUM_PATH_FIELDS, input_path.points.size());
   input_arclength.reserve(input_path.points.size());
   input_pose.reserve(input_path.points.size());
-  v_lon.reserve(input_path.points.size());
-  v_lat.reserve(input_path.points.size());
-  heading_rate.reserve(input_path.points.size());
 
   input_arclength.push_back(0.0);
-  input_pose.push_back(input_path.points.front().pose);
-  v_lon.push_back(input_path.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_path.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_path.points.front().heading_rate_rps);
-  for (size_t i = 1; i < input_path.points.size(); ++i) {
-    const auto & prev_pt = input_path.points.at(i - 1);
+  for (size_t i = 0; i < input_path.points.size(); ++i) {
     const auto & curr_pt = input_path.points.at(i);
-    const double ds =
-      tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
+    if (i > 0) {
+      const auto & prev_pt = input_path.points.at(i - 1);
+      const double ds =
+        tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
+      input_arclength.push_back(ds + input_arclength.back());
+    }
     input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
+    input_fields.at(PATH_V_LON, i) = curr_pt.longitudinal_velocity_mps;
+    input_fields.at(PATH_V_LAT, i) = curr_pt.lateral_velocity_mps;
+    input_fields.at(PATH_HEADING_RATE, i) = curr_pt.heading_rate_rps;
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
+  const auto weights = interpolation::calcLerpWeights(input_arclength, resampled_arclength);
 
-  std::vector<size_t> closest_segment_indices;
+  const auto interpolated_pose =
+    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
+  ScalarFields interpolated_fields(NUM_PATH_FIELDS, resampled_arclength.size());
   if (use_zero_order_hold_for_v) {
-    closest_segment_indices =
+    const auto closest_segment_indices =
       interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
+    input_fields.zeroOrderHold(
+      closest_segment_indices, 0, num_path_twist_fields, interpolated_fields);
+    input_fields.lerp(weights, num_path_twist_fields, NUM_PATH_FIELDS, interpolated_fields);
+  } else {
+    input_fields.lerp(weights, 0, NUM_PATH_FIELDS, interpolated_fields);
   }
-  const auto zoh = [&](const auto & input) {
-    return interpolation::zero_order_hold(input_arclength, input, closest_segment_indices);
-  };
-
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
@@ -489,12 +533,11 @@ autoware_auto_planning_msgs::msg::Path resamplePath(
   resampled_path.right_bound = input_path.right_bound;
   resampled_path.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_path.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::PathPoint path_point;
+    auto & path_point = resampled_path.points.at(i);
     path_point.pose = interpolated_pose.at(i);
-    path_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    path_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    path_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    resampled_path.points.at(i) = path_point;
+    path_point.longitudinal_velocity_mps = interpolated_fields.at(PATH_V_LON, i);
+    path_point.lateral_velocity_mps = interpolated_fields.at(PATH_V_LAT, i);
+    path_point.heading_rate_rps = interpolated_fields.at(PATH_HEADING_RATE, i);
   }
 
   return resampled_path;
@@ -572,73 +615,44 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   // Input Trajectory Information
   std::vector<double> input_arclength;
   std::vector<geometry_msgs::msg::Pose> input_pose;
-  std::vector<double> v_lon;
-  std::vector<double> v_lat;
-  std::vector<double> heading_rate;
-  std::vector<double> acceleration;
-  std::vector<double> front_wheel_angle;
-  std::vector<double> rear_wheel_angle;
-  std::vector<double> time_from_start;
+  ScalarFields input_fields(NUM_TRAJ_FIELDS, input_trajectory.points.size());
   input_arclength.reserve(input_trajectory.points.size());
   input_pose.reserve(input_trajectory.points.size());
-  v_lon.reserve(input_trajectory.points.size());
-  v_lat.reserve(input_trajectory.points.size());
-  heading_rate.reserve(input_trajectory.points.size());
-  acceleration.reserve(input_trajectory.points.size());
-  front_wheel_angle.reserve(input_trajectory.points.size());
-  rear_wheel_angle.reserve(input_trajectory.points.size());
-  time_from_start.reserve(input_trajectory.points.size());
 
   input_arclength.push_back(0.0);
-  input_pose.push_back(input_trajectory.points.front().pose);
-  v_lon.push_back(input_trajectory.points.front().longitudinal_velocity_mps);
-  v_lat.push_back(input_trajectory.points.front().lateral_velocity_mps);
-  heading_rate.push_back(input_trajectory.points.front().heading_rate_rps);
-  acceleration.push_back(input_trajectory.points.front().acceleration_mps2);
-  front_wheel_angle.push_back(input_trajectory.points.front().front_wheel_angle_rad);
-  rear_wheel_angle.push_back(input_trajectory.points.front().rear_wheel_angle_rad);
-  time_from_start.push_back(
-    rclcpp::Duration(input_trajectory.points.front().time_from_start).seconds());
-  for (size_t i = 1; i < input_trajectory.points.size(); ++i) {
-    const auto & prev_pt = input_trajectory.points.at(i - 1);
+  for (size_t i = 0; i < input_trajectory.points.size(); ++i) {
     const auto & curr_pt = input_trajectory.points.at(i);
-    const double ds =
-      tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
-    input_arclength.push_back(ds + input_arclength.back());
+    if (i > 0) {
+      const auto & prev_pt = input_trajectory.points.at(i - 1);
+      const double ds =
+        tier4_autoware_utils::calcDistance2d(prev_pt.pose.position, curr_pt.pose.position);
+      input_arclength.push_back(ds + input_arclength.back());
+    }
     input_pose.push_back(curr_pt.pose);
-    v_lon.push_back(curr_pt.longitudinal_velocity_mps);
-    v_lat.push_back(curr_pt.lateral_velocity_mps);
-    heading_rate.push_back(curr_pt.heading_rate_rps);
-    acceleration.push_back(curr_pt.acceleration_mps2);
-    front_wheel_angle.push_back(curr_pt.front_wheel_angle_rad);
-    rear_wheel_angle.push_back(curr_pt.rear_wheel_angle_rad);
-    time_from_start.push_back(rclcpp::Duration(curr_pt.time_from_start).seconds());
+    input_fields.at(TRAJ_V_LON, i) = curr_pt.longitudinal_velocity_mps;
+    input_fields.at(TRAJ_V_LAT, i) = curr_pt.lateral_velocity_mps;
+    input_fields.at(TRAJ_ACCELERATION, i) = curr_pt.acceleration_mps2;
+    input_fields.at(TRAJ_HEADING_RATE, i) = curr_pt.heading_rate_rps;
+    input_fields.at(TRAJ_FRONT_WHEEL_ANGLE, i) = curr_pt.front_wheel_angle_rad;
+    input_fields.at(TRAJ_REAR_WHEEL_ANGLE, i) = curr_pt.rear_wheel_angle_rad;
+    input_fields.at(TRAJ_TIME_FROM_START, i) = rclcpp::Duration(curr_pt.time_from_start).seconds();
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
+  const auto weights = interpolation::calcLerpWeights(input_arclength, resampled_arclength);
 
-  std::vector<size_t> closest_segment_indices;
+  const auto interpolated_pose =
+    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
+  ScalarFields interpolated_fields(NUM_TRAJ_FIELDS, resampled_arclength.size());
   if (use_zero_order_hold_for_twist) {
-    closest_segment_indices =
+    const auto closest_segment_indices =
       interpolation::calc_closest_segment_indices(input_arclength, resampled_arclength);
+    input_fields.zeroOrderHold(
+      closest_segment_indices, 0, num_traj_twist_fields, interpolated_fields);
+    input_fields.lerp(weights, num_traj_twist_fields, NUM_TRAJ_FIELDS, interpolated_fields);
+  } else {
+    input_fields.lerp(weights, 0, NUM_TRAJ_FIELDS, interpolated_fields);
   }
-  const auto zoh = [&](const auto & input) {
-    return interpolation::zero_order_hold(input_arclength, input, closest_segment_indices);
-  };
-
-  const auto interpolated_pose =
-    resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
-  const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
@@ -650,16 +664,16 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   resampled_trajectory.header = input_trajectory.header;
   resampled_trajectory.points.resize(interpolated_pose.size());
   for (size_t i = 0; i < resampled_trajectory.points.size(); ++i) {
-    autoware_auto_planning_msgs::msg::TrajectoryPoint traj_point;
+    auto & traj_point = resampled_trajectory.points.at(i);
     traj_point.pose = interpolated_pose.at(i);
-    traj_point.longitudinal_velocity_mps = interpolated_v_lon.at(i);
-    traj_point.lateral_velocity_mps = interpolated_v_lat.at(i);
-    traj_point.heading_rate_rps = interpolated_heading_rate.at(i);
-    traj_point.acceleration_mps2 = interpolated_acceleration.at(i);
-    traj_point.front_wheel_angle_rad = interpolated_front_wheel_angle.at(i);
-    traj_point.rear_wheel_angle_rad = interpolated_rear_wheel_angle.at(i);
-    traj_point.time_from_start = rclcpp::Duration::from_seconds(interpolated_time_from_start.at(i));
-    resampled_trajectory.points.at(i) = traj_point;
+    traj_point.longitudinal_velocity_mps = interpolated_fields.at(TRAJ_V_LON, i);
+    traj_point.lateral_velocity_mps = interpolated_fields.at(TRAJ_V_LAT, i);
+    traj_point.acceleration_mps2 = interpolated_fields.at(TRAJ_ACCELERATION, i);
+    traj_point.heading_rate_rps = interpolated_fields.at(TRAJ_HEADING_RATE, i);
+    traj_point.front_wheel_angle_rad = interpolated_fields.at(TRAJ_FRONT_WHEEL_ANGLE, i);
+    traj_point.rear_wheel_angle_rad = interpolated_fields.at(TRAJ_REAR_WHEEL_ANGLE, i);
+    traj_point.time_from_start =
+      rclcpp::Duration::from_seconds(interpolated_fields.at(TRAJ_TIME_FROM_START, i));
   }
 
   return resampled_trajectory;
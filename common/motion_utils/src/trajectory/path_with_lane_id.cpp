@@ -16,8 +16,10 @@
 
 #include "interpolation/spline_interpolation_points_2d.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
+#include "tier4_autoware_utils/math/trigonometry.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 #include <vector>
 
@@ -110,21 +112,23 @@ autoware_auto_planning_msgs::msg::PathWithLaneId convertToRearWheelCenter(
   const auto curvature_vec = spline.getSplineInterpolatedCurvatures();
   const auto yaw_vec = spline.getSplineInterpolatedYaws();
 
+  // calculate beta, which is CoG's velocity direction, and apply it to CoG yaw
+  std::vector<double> cog_yaws_with_beta(path.points.size());
   for (size_t i = 0; i < path.points.size(); ++i) {
-    // calculate beta, which is CoG's velocity direction
     const double beta = std::atan(rear_to_cog * curvature_vec.at(i));
+    cog_yaws_with_beta.at(i) = yaw_vec.at(i) - beta;
+  }
+  std::vector<double> sin_yaws;
+  std::vector<double> cos_yaws;
+  tier4_autoware_utils::sinCos(cog_yaws_with_beta, sin_yaws, cos_yaws);
 
-    // apply beta to CoG pose
-    geometry_msgs::msg::Pose cog_pose_with_beta;
-    cog_pose_with_beta.position = tier4_autoware_utils::getPoint(path.points.at(i));
-    cog_pose_with_beta.orientation =
-      tier4_autoware_utils::createQuaternionFromYaw(yaw_vec.at(i) - beta);
-
-    const auto rear_pose =
-      tier4_autoware_utils::calcOffsetPose(cog_pose_with_beta, -rear_to_cog, 0.0, 0.0);
-
-    // update pose
-    tier4_autoware_utils::setPose(rear_pose, cog_path.points.at(i));
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    // offset the position backward along the yaw, which is the same as calcOffsetPose. The
+    // orientation is updated by insertOrientation below.
+    const auto & cog_point = tier4_autoware_utils::getPoint(path.points.at(i));
+    auto & rear_point = cog_path.points.at(i).point.pose.position;
+    rear_point.x = cog_point.x - rear_to_cog * cos_yaws.at(i);
+    rear_point.y = cog_point.y - rear_to_cog * sin_yaws.at(i);
   }
 
   // compensate for the last pose
@@ -0,0 +1,131 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "interpolation/linear_interpolation.hpp"
+#include "motion_utils/resample/resample.hpp"
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <gtest/gtest.h>
+#include <gtest/internal/gtest-port.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using tier4_autoware_utils::createPoint;
+using tier4_autoware_utils::createQuaternionFromYaw;
+
+constexpr size_t num_fields = 7;
+constexpr int nb_iteration = 100;
+
+Trajectory generateRandomTrajectory(const size_t num_points, std::default_random_engine & engine)
+{
+  std::uniform_real_distribution<double> value_dist(-5.0, 5.0);
+
+  Trajectory traj;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = 0.01 * i;
+    TrajectoryPoint p;
+    p.pose.position = createPoint(100.0 * std::sin(theta), 100.0 * (1.0 - std::cos(theta)), 0.0);
+    p.pose.orientation = createQuaternionFromYaw(theta);
+    p.longitudinal_velocity_mps = value_dist(engine);
+    p.lateral_velocity_mps = value_dist(engine);
+    p.acceleration_mps2 = value_dist(engine);
+    p.heading_rate_rps = value_dist(engine);
+    p.front_wheel_angle_rad = value_dist(engine);
+    p.rear_wheel_angle_rad = value_dist(engine);
+    p.time_from_start = rclcpp::Duration::from_seconds(0.1 * i);
+    traj.points.push_back(p);
+  }
+  return traj;
+}
+
+template <class F>
+double measureMicroseconds(F && f)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nb_iteration; ++i) {
+    f();
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(duration).count() / nb_iteration;
+}
+}  // namespace
+
+// compare the linear interpolation of the scalar fields of the trajectory point, which searches
+// the segments for each field, with the one sharing the segments among the fields
+TEST(resample_benchmark, DISABLED_lerpFields)
+{
+  std::default_random_engine engine(0);
+  std::uniform_real_distribution<double> value_dist(-5.0, 5.0);
+
+  std::cout << "#N per_field[us] shared_weights[us]" << std::endl;
+  for (const size_t num_points : {100, 500, 1000, 5000}) {
+    std::vector<double> base_keys(num_points);
+    std::vector<std::vector<double>> base_values(num_fields, std::vector<double>(num_points));
+    for (size_t i = 0; i < num_points; ++i) {
+      base_keys.at(i) = static_cast<double>(i);
+      for (auto & values : base_values) {
+        values.at(i) = value_dist(engine);
+      }
+    }
+    // resample at the half interval
+    std::vector<double> query_keys(2 * num_points - 1);
+    for (size_t i = 0; i < query_keys.size(); ++i) {
+      query_keys.at(i) = 0.5 * i;
+    }
+
+    std::vector<std::vector<double>> per_field_values(num_fields);
+    const double per_field_time = measureMicroseconds([&]() {
+      for (size_t j = 0; j < num_fields; ++j) {
+        per_field_values.at(j) = interpolation::lerp(base_keys, base_values.at(j), query_keys);
+      }
+    });
+
+    std::vector<std::vector<double>> shared_values(num_fields);
+    const double shared_time = measureMicroseconds([&]() {
+      const auto weights = interpolation::calcLerpWeights(base_keys, query_keys);
+      for (size_t j = 0; j < num_fields; ++j) {
+        shared_values.at(j) = interpolation::lerp(weights, base_values.at(j));
+      }
+    });
+    EXPECT_EQ(per_field_values, shared_values);
+
+    std::cout << num_points << " " << per_field_time << " " << shared_time << std::endl;
+  }
+}
+
+TEST(resample_benchmark, DISABLED_resampleTrajectory)
+{
+  std::default_random_engine engine(0);
+
+  std::cout << "#N resample_trajectory[us]" << std::endl;
+  for (const size_t num_points : {100, 500, 1000, 5000}) {
+    const auto traj = generateRandomTrajectory(num_points, engine);
+    // resample at the half interval
+    Trajectory resampled_traj;
+    const double time = measureMicroseconds([&]() {
+      resampled_traj = motion_utils::resampleTrajectory(traj, 0.5, false, true, false, false);
+    });
+    EXPECT_GT(resampled_traj.points.size(), num_points);
+
+    std::cout << num_points << " " << time << std::endl;
+  }
+}
@@ -19,6 +19,7 @@
 #include "osqp_interface/visibility_control.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <vector>
 
@@ -43,6 +44,15 @@ struct OSQP_INTERFACE_PUBLIC CSC_Matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::MatrixXd & mat);
 /// \brief Calculate upper trapezoidal CSC matrix from square Eigen matrix
 OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat);
+/// \brief Calculate CSC matrix from Eigen sparse matrix in O(nnz)
+/// \details Explicitly stored zeros are kept so that the sparsity pattern of the result depends
+/// \details only on the structure of the matrix, not on its values.
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat);
+/// \brief Calculate upper trapezoidal CSC matrix from square Eigen sparse matrix in O(nnz)
+/// \details The elements below the diagonal are ignored, and the explicitly stored zeros are kept.
+OSQP_INTERFACE_PUBLIC CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat);
+/// \brief Check if the two CSC matrices have the same sparsity pattern
+OSQP_INTERFACE_PUBLIC bool hasSameSparsityPattern(const CSC_Matrix & mat1, const CSC_Matrix & mat2);
 /// \brief Print the given CSC matrix to the standard output
 OSQP_INTERFACE_PUBLIC void printCSCMatrix(const CSC_Matrix & csc_mat);
 
@@ -20,6 +20,7 @@
 #include "osqp_interface/visibility_control.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <rclcpp/rclcpp.hpp>
 
 #include <limits>
@@ -54,6 +55,11 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // Sparsity patterns of P and A in the current work (the values are not stored)
+  CSC_Matrix m_P_pattern;
+  CSC_Matrix m_A_pattern;
+  // Flag to check if the latest problem was set by updating the values of the current work
+  bool m_work_reused = false;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -122,6 +128,14 @@ public:
     const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
     const std::vector<double> & l, const std::vector<double> & u);
 
+  /// \brief Solves convex quadratic programs (QPs) given as sparse matrices using the OSQP solver.
+  /// \details Unlike the dense overload, the workspace is kept after the optimization, so that the
+  /// \details next call with the same sparsity patterns of P and A only updates the values in the
+  /// \details workspace and starts from the previous solution. See setProblem().
+  std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> optimize(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+
   /// \brief Converts the input data and sets up the workspace object.
   /// \param P (n,n) matrix defining relations between parameters.
   /// \param A (m,n) matrix defining parameter constraints relative to the lower and upper bound.
@@ -135,6 +149,24 @@ public:
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
 
+  /// \brief Sets the problem, reusing the current workspace when possible.
+  /// \details When the workspace was set up with the same dimensions and the same sparsity patterns
+  /// \details of P and A, only the values of P, A, q, l and u are updated in the workspace, which
+  /// \details keeps the setup of the factorization and the previous solution for warm start.
+  /// \details Otherwise the workspace is set up from scratch as initializeProblem().
+  /// \param P (n,n) sparse matrix. Only the upper triangular part is used.
+  /// \param A (m,n) sparse matrix defining parameter constraints.
+  /// \param q (n) vector defining the linear cost of the problem.
+  /// \param l (m) vector defining the lower bound problem constraint.
+  /// \param u (m) vector defining the upper bound problem constraint.
+  int64_t setProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+  /// \brief Same as above with P and A in CSC format, where P_csc is upper triangular.
+  int64_t setProblem(
+    const CSC_Matrix & P_csc, const CSC_Matrix & A_csc, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
@@ -189,6 +221,8 @@ public:
   inline double getObjVal() const { return m_latest_work_info.obj_val; }
   /// \brief Returns flag asserting interface condition (Healthy condition: 0).
   inline int64_t getExitFlag() const { return m_exitflag; }
+  /// \brief Returns true if the latest setProblem() only updated the values of the workspace
+  inline bool isWorkReused() const { return m_work_reused; }
 
   void logUnsolvedStatus(const std::string & prefix_message = "") const;
 };
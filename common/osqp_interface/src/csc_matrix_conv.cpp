@@ -115,6 +115,58 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const Eigen::Index cols = mat.outerSize();
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.m_row_idxs.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.m_col_idxs.reserve(static_cast<size_t>(cols + 1));
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it; ++it) {
+      csc_matrix.m_vals.push_back(it.value());
+      csc_matrix.m_row_idxs.push_back(static_cast<c_int>(it.row()));
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  const Eigen::Index cols = mat.outerSize();
+
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.m_row_idxs.reserve(static_cast<size_t>(mat.nonZeros()));
+  csc_matrix.m_col_idxs.reserve(static_cast<size_t>(cols + 1));
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {
+    // the row indices are sorted in each column
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mat, j); it && it.row() <= j; ++it) {
+      csc_matrix.m_vals.push_back(it.value());
+      csc_matrix.m_row_idxs.push_back(static_cast<c_int>(it.row()));
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
+bool hasSameSparsityPattern(const CSC_Matrix & mat1, const CSC_Matrix & mat2)
+{
+  return mat1.m_row_idxs == mat2.m_row_idxs && mat1.m_col_idxs == mat2.m_col_idxs;
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
@@ -21,6 +21,8 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -31,6 +33,42 @@ namespace common
 {
 namespace osqp
 {
+namespace
+{
+void checkProblemSize(
+  const Eigen::Index P_rows, const Eigen::Index P_cols, const Eigen::Index A_rows,
+  const Eigen::Index A_cols, const std::vector<double> & q, const std::vector<double> & l,
+  const std::vector<double> & u)
+{
+  std::stringstream ss;
+  if (P_rows != P_cols) {
+    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P_rows
+       << ", P.cols() = " << P_cols;
+    throw std::invalid_argument(ss.str());
+  }
+  if (P_rows != static_cast<int>(q.size())) {
+    ss << "P.rows() and q.size() are not the same. P.rows() = " << P_rows
+       << ", q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (P_rows != A_cols) {
+    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P_rows
+       << ", A.cols() = " << A_cols;
+    throw std::invalid_argument(ss.str());
+  }
+  if (A_rows != static_cast<int>(l.size())) {
+    ss << "A.rows() and l.size() are not the same. A.rows() = " << A_rows
+       << ", l.size() = " << l.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A_rows != static_cast<int>(u.size())) {
+    ss << "A.rows() and u.size() are not the same. A.rows() = " << A_rows
+       << ", u.size() = " << u.size();
+    throw std::invalid_argument(ss.str());
+  }
+}
+}  // namespace
+
 OSQPInterface::OSQPInterface(const c_float eps_abs, const bool polish)
 : m_work{nullptr, OSQPWorkspaceDeleter}
 {
@@ -288,32 +326,7 @@ int64_t OSQPInterface::initializeProblem(
   const std::vector<double> & l, const std::vector<double> & u)
 {
   // check if arguments are valid
-  std::stringstream ss;
-  if (P.rows() != P.cols()) {
-    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
-       << ", P.cols() = " << P.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != static_cast<int>(q.size())) {
-    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
-       << ", q.size() = " << q.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != A.cols()) {
-    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
-       << ", A.cols() = " << A.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(l.size())) {
-    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
-       << ", l.size() = " << l.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(u.size())) {
-    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
-       << ", u.size() = " << u.size();
-    throw std::invalid_argument(ss.str());
-  }
+  checkProblemSize(P.rows(), P.cols(), A.rows(), A.cols(), q, l, u);
 
   CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
   CSC_Matrix A_csc = calCSCMatrix(A);
@@ -359,10 +372,51 @@ int64_t OSQPInterface::initializeProblem(
   m_exitflag = osqp_setup(&workspace, m_data.get(), m_settings.get());
   m_work.reset(workspace);
   m_work_initialized = true;
+  m_work_reused = false;
+
+  m_P_pattern.m_row_idxs = P_csc.m_row_idxs;
+  m_P_pattern.m_col_idxs = P_csc.m_col_idxs;
+  m_A_pattern.m_row_idxs = A_csc.m_row_idxs;
+  m_A_pattern.m_col_idxs = A_csc.m_col_idxs;
 
   return m_exitflag;
 }
 
+int64_t OSQPInterface::setProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  // check if arguments are valid
+  checkProblemSize(P.rows(), P.cols(), A.rows(), A.cols(), q, l, u);
+
+  return setProblem(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+}
+
+int64_t OSQPInterface::setProblem(
+  const CSC_Matrix & P_csc, const CSC_Matrix & A_csc, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  const bool is_same_structure = m_work_initialized && m_exitflag == 0 &&
+                                 m_param_n == static_cast<int64_t>(q.size()) &&
+                                 m_data->m == static_cast<c_int>(l.size()) &&
+                                 hasSameSparsityPattern(P_csc, m_P_pattern) &&
+                                 hasSameSparsityPattern(A_csc, m_A_pattern);
+  if (is_same_structure) {
+    // update only the values, keeping the setup of the factorization and the previous solution
+    const c_int update_matrix_flag = osqp_update_P_A(
+      m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()),
+      A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
+    const c_int update_q_flag = osqp_update_lin_cost(m_work.get(), q.data());
+    const c_int update_bounds_flag = osqp_update_bounds(m_work.get(), l.data(), u.data());
+    if (update_matrix_flag == 0 && update_q_flag == 0 && update_bounds_flag == 0) {
+      m_work_reused = true;
+      return m_exitflag;
+    }
+  }
+
+  return initializeProblem(P_csc, A_csc, q, l, u);
+}
+
 std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
 OSQPInterface::solve()
 {
@@ -416,6 +470,18 @@ OSQPInterface::optimize(
   return result;
 }
 
+std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
+OSQPInterface::optimize(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  // Set up the workspace, or update the values in it
+  setProblem(P, A, q, l, u);
+
+  // Run the solver on the stored problem representation, keeping the workspace for the next call
+  return solve();
+}
+
 void OSQPInterface::logUnsolvedStatus(const std::string & prefix_message) const
 {
   const int status = getStatus();
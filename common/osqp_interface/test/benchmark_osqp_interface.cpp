@@ -0,0 +1,182 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the per-cycle cost of the dense API, which converts the dense matrices and sets up the
+// workspace at every cycle, with the sparse API, which only updates the values of the workspace
+// while the sparsity pattern is unchanged. The problem imitates the jerk filtered velocity
+// smoother, which has 4N variables [b, a, delta, sigma] for the N points of the trajectory.
+
+#include "osqp_interface/osqp_interface.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+using autoware::common::osqp::INF;
+
+struct SparseProblem
+{
+  Eigen::SparseMatrix<double> P;
+  Eigen::SparseMatrix<double> A;
+  std::vector<double> q;
+  std::vector<double> l;
+  std::vector<double> u;
+};
+
+SparseProblem generateProblem(const int N, const int cycle)
+{
+  constexpr double ds = 1.0;
+  constexpr double v0 = 10.0;
+  constexpr double a_max = 1.0;
+  constexpr double a_min = -1.0;
+  constexpr double j_max = 0.5;
+  constexpr double j_min = -0.5;
+  constexpr double over_v_weight = 100.0;
+  constexpr double over_a_weight = 10.0;
+  const double jerk_weight = 0.1 * (1.0 + 0.1 * std::sin(0.1 * cycle));
+
+  // variables: b (squared velocity), a (acceleration), delta and sigma (slack variables)
+  const int IDX_B0 = 0;
+  const int IDX_A0 = N;
+  const int IDX_DELTA0 = 2 * N;
+  const int IDX_SIGMA0 = 3 * N;
+  const int num_variables = 4 * N;
+  const int num_constraints = 6 * N;
+
+  SparseProblem problem;
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  problem.q.assign(num_variables, 0.0);
+  problem.l.assign(num_constraints, 0.0);
+  problem.u.assign(num_constraints, 0.0);
+
+  for (int i = 0; i < N; ++i) {
+    const double v_max = 15.0 + 5.0 * std::sin(0.05 * i + 0.1 * cycle);
+    problem.q.at(IDX_B0 + i) = -1.0;  // maximize velocity
+    P_triplets.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, over_v_weight);
+    P_triplets.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, over_a_weight);
+    if (i + 1 < N) {
+      // jerk: (a[i+1] - a[i])^2
+      P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i, jerk_weight);
+      P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i + 1, jerk_weight);
+      P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, -jerk_weight);
+      P_triplets.emplace_back(IDX_A0 + i + 1, IDX_A0 + i, -jerk_weight);
+    }
+
+    // 0 < b - delta < v_max^2
+    A_triplets.emplace_back(i, IDX_B0 + i, 1.0);
+    A_triplets.emplace_back(i, IDX_DELTA0 + i, -1.0);
+    problem.u.at(i) = v_max * v_max;
+    // a_min < a - sigma < a_max
+    A_triplets.emplace_back(N + i, IDX_A0 + i, 1.0);
+    A_triplets.emplace_back(N + i, IDX_SIGMA0 + i, -1.0);
+    problem.l.at(N + i) = a_min;
+    problem.u.at(N + i) = a_max;
+    // delta > 0, sigma > 0
+    A_triplets.emplace_back(2 * N + i, IDX_DELTA0 + i, 1.0);
+    problem.u.at(2 * N + i) = INF;
+    A_triplets.emplace_back(3 * N + i, IDX_SIGMA0 + i, 1.0);
+    problem.u.at(3 * N + i) = INF;
+  }
+  for (int i = 0; i + 1 < N; ++i) {
+    // j_min * ds / v0 < a[i+1] - a[i] < j_max * ds / v0
+    A_triplets.emplace_back(4 * N + i, IDX_A0 + i, -1.0);
+    A_triplets.emplace_back(4 * N + i, IDX_A0 + i + 1, 1.0);
+    problem.l.at(4 * N + i) = j_min * ds / v0;
+    problem.u.at(4 * N + i) = j_max * ds / v0;
+    // (b[i+1] - b[i]) / ds = 2 * a[i]
+    A_triplets.emplace_back(5 * N - 1 + i, IDX_B0 + i, -1.0 / ds);
+    A_triplets.emplace_back(5 * N - 1 + i, IDX_B0 + i + 1, 1.0 / ds);
+    A_triplets.emplace_back(5 * N - 1 + i, IDX_A0 + i, -2.0);
+  }
+  // initial condition
+  A_triplets.emplace_back(6 * N - 2, IDX_B0, 1.0);
+  problem.l.at(6 * N - 2) = problem.u.at(6 * N - 2) = v0 * v0;
+  A_triplets.emplace_back(6 * N - 1, IDX_A0, 1.0);
+
+  problem.P.resize(num_variables, num_variables);
+  problem.P.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  problem.A.resize(num_constraints, num_variables);
+  problem.A.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  return problem;
+}
+
+double toMilliseconds(const std::chrono::steady_clock::duration & duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+}  // namespace
+
+int main()
+{
+  using autoware::common::osqp::calCSCMatrix;
+  using autoware::common::osqp::calCSCMatrixTrapezoidal;
+  using autoware::common::osqp::OSQPInterface;
+  using std::chrono::steady_clock;
+
+  constexpr int nb_cycles = 20;
+
+  std::cout << "#N dense_conversion[ms] dense_optimize[ms] sparse_conversion[ms] "
+               "sparse_optimize[ms] reused_cycles"
+            << std::endl;
+  for (int N = 100; N <= 300; N += 100) {
+    double dense_conversion_time = 0.0;
+    double dense_optimize_time = 0.0;
+    double sparse_conversion_time = 0.0;
+    double sparse_optimize_time = 0.0;
+    int reused_cycles = 0;
+
+    OSQPInterface dense_solver(1.0e-4);
+    OSQPInterface sparse_solver(1.0e-4);
+    for (int cycle = 0; cycle < nb_cycles; ++cycle) {
+      const auto problem = generateProblem(N, cycle);
+      const Eigen::MatrixXd P_dense = problem.P;
+      const Eigen::MatrixXd A_dense = problem.A;
+
+      // the conversion alone
+      auto start = steady_clock::now();
+      calCSCMatrixTrapezoidal(P_dense);
+      calCSCMatrix(A_dense);
+      dense_conversion_time += toMilliseconds(steady_clock::now() - start);
+
+      start = steady_clock::now();
+      calCSCMatrixTrapezoidal(problem.P);
+      calCSCMatrix(problem.A);
+      sparse_conversion_time += toMilliseconds(steady_clock::now() - start);
+
+      // the conversion, the setup of the workspace and the optimization
+      start = steady_clock::now();
+      dense_solver.optimize(P_dense, A_dense, problem.q, problem.l, problem.u);
+      dense_optimize_time += toMilliseconds(steady_clock::now() - start);
+
+      start = steady_clock::now();
+      sparse_solver.optimize(problem.P, problem.A, problem.q, problem.l, problem.u);
+      sparse_optimize_time += toMilliseconds(steady_clock::now() - start);
+      if (sparse_solver.isWorkReused()) {
+        ++reused_cycles;
+      }
+    }
+
+    std::cout << N << " " << dense_conversion_time / nb_cycles << " "
+              << dense_optimize_time / nb_cycles << " " << sparse_conversion_time / nb_cycles
+              << " " << sparse_optimize_time / nb_cycles << " " << reused_cycles << std::endl;
+  }
+  return 0;
+}
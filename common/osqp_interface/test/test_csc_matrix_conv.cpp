@@ -16,6 +16,7 @@
 #include "osqp_interface/csc_matrix_conv.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,60 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::common::osqp::calCSCMatrix;
+  using autoware::common::osqp::calCSCMatrixTrapezoidal;
+  using autoware::common::osqp::CSC_Matrix;
+  using autoware::common::osqp::hasSameSparsityPattern;
+
+  auto expect_same_csc = [](const CSC_Matrix & csc1, const CSC_Matrix & csc2) {
+    EXPECT_EQ(csc1.m_vals, csc2.m_vals);
+    EXPECT_EQ(csc1.m_row_idxs, csc2.m_row_idxs);
+    EXPECT_EQ(csc1.m_col_idxs, csc2.m_col_idxs);
+  };
+
+  // same as the dense conversion for the matrices without explicit zeros
+  Eigen::MatrixXd rect1(2, 4);
+  Eigen::MatrixXd square1(6, 6);
+  Eigen::MatrixXd square2(3, 3);
+  rect1 << 1.0, 0.0, 3.0, 0.0, 0.0, 6.0, 7.0, 0.0;
+  square1 << 10.0, 0.0, 0.0, 0.0, -2.0, 0.0, 3.0, 9.0, 0.0, 0.0, 0.0, 3.0, 0.0, 7.0, 8.0, 7.0, 0.0,
+    0.0, 3.0, 0.0, 8.0, 7.0, 5.0, 0.0, 0.0, 8.0, 0.0, 9.0, 9.0, 13.0, 0.0, 4.0, 0.0, 0.0, 2.0, -1.0;
+  square2 << 0.0, 2.0, 0.0, 4.0, 5.0, 6.0, 0.0, 0.0, 0.0;
+  expect_same_csc(
+    calCSCMatrix(Eigen::SparseMatrix<double>(rect1.sparseView())), calCSCMatrix(rect1));
+  expect_same_csc(
+    calCSCMatrix(Eigen::SparseMatrix<double>(square1.sparseView())), calCSCMatrix(square1));
+  expect_same_csc(
+    calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(square1.sparseView())),
+    calCSCMatrixTrapezoidal(square1));
+  expect_same_csc(
+    calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(square2.sparseView())),
+    calCSCMatrixTrapezoidal(square2));
+
+  // the explicit zeros are kept in the sparsity pattern
+  Eigen::SparseMatrix<double> sparse1(2, 2);
+  sparse1.insert(0, 0) = 1.0;
+  sparse1.insert(0, 1) = 0.0;
+  sparse1.insert(1, 1) = 4.0;
+  sparse1.makeCompressed();
+  Eigen::SparseMatrix<double> sparse2 = sparse1;
+  sparse2.coeffRef(0, 1) = 2.0;
+  const CSC_Matrix sparse_m1 = calCSCMatrixTrapezoidal(sparse1);
+  ASSERT_EQ(sparse_m1.m_vals.size(), size_t(3));
+  EXPECT_EQ(sparse_m1.m_vals[1], 0.0);
+  EXPECT_TRUE(hasSameSparsityPattern(sparse_m1, calCSCMatrixTrapezoidal(sparse2)));
+  EXPECT_FALSE(hasSameSparsityPattern(sparse_m1, calCSCMatrixTrapezoidal(square1)));
+
+  try {
+    const CSC_Matrix rect_m1 =
+      calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(rect1.sparseView()));
+    FAIL() << "calCSCMatrixTrapezoidal should fail with non-square inputs";
+  } catch (const std::invalid_argument & e) {
+    EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
+  }
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::common::osqp::calCSCMatrix;
@@ -16,6 +16,7 @@
 #include "osqp_interface/osqp_interface.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <tuple>
 #include <vector>
@@ -161,4 +162,59 @@ TEST(TestOsqpInterface, BasicQp)
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
 }
+
+TEST(TestOsqpInterface, SparseQp)
+{
+  using autoware::common::osqp::INF;
+
+  auto check_primal_result =
+    [](const std::tuple<std::vector<double>, std::vector<double>, int, int, int> & result) {
+      EXPECT_EQ(std::get<3>(result), 1);  // solution succeeded
+
+      static const auto ep = 1.0e-6;
+
+      const auto prime_val = std::get<0>(result);
+      ASSERT_EQ(prime_val.size(), size_t(2));
+      EXPECT_NEAR(prime_val[0], 0.3, ep);
+      EXPECT_NEAR(prime_val[1], 0.7, ep);
+    };
+
+  // same problem as BasicQp
+  const Eigen::MatrixXd P = (Eigen::MatrixXd(2, 2) << 4, 1, 1, 2).finished();
+  const Eigen::MatrixXd A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+  const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+  const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+  const std::vector<double> q = {1.0, 1.0};
+  const std::vector<double> l = {1.0, 0.0, 0.0, -INF};
+  const std::vector<double> u = {1.0, 0.7, 0.7, INF};
+
+  autoware::common::osqp::OSQPInterface osqp;
+  std::tuple<std::vector<double>, std::vector<double>, int, int, int> result =
+    osqp.optimize(P_sparse, A_sparse, q, l, u);
+  EXPECT_FALSE(osqp.isWorkReused());
+  check_primal_result(result);
+
+  // the scaled objective with the same sparsity pattern only updates the values in the workspace
+  const Eigen::SparseMatrix<double> P_scaled = 2.0 * P_sparse;
+  const std::vector<double> q_scaled = {2.0, 2.0};
+  result = osqp.optimize(P_scaled, A_sparse, q_scaled, l, u);
+  EXPECT_TRUE(osqp.isWorkReused());
+  check_primal_result(result);
+
+  // the workspace is set up again without the last constraint, which is not active
+  const Eigen::SparseMatrix<double> A_reduced = A.topRows(3).sparseView();
+  const std::vector<double> l_reduced = {1.0, 0.0, 0.0};
+  const std::vector<double> u_reduced = {1.0, 0.7, 0.7};
+  result = osqp.optimize(P_sparse, A_reduced, q, l_reduced, u_reduced);
+  EXPECT_FALSE(osqp.isWorkReused());
+  check_primal_result(result);
+
+  // the dense optimization discards the workspace
+  osqp.optimize(P, A, q, l, u);
+  osqp.setProblem(P_sparse, A_sparse, q, l, u);
+  EXPECT_FALSE(osqp.isWorkReused());
+
+  EXPECT_THROW(
+    osqp.setProblem(P_sparse, A_sparse, q, l_reduced, u_reduced), std::invalid_argument);
+}
 }  // namespace
@@ -0,0 +1,153 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the accuracy and the throughput of the batched sinCos and atan2 kernels with libm and
+// the sin table, and those of the batched yaw <-> quaternion conversions with tf2, for the array
+// sizes of the typical trajectories.
+
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+#include "tier4_autoware_utils/math/constants.hpp"
+#include "tier4_autoware_utils/math/trigonometry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr int nb_iterations = 100;
+
+template <class F>
+double measureNanosecondsPerElement(const size_t size, F && f)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nb_iterations; ++i) {
+    f();
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(duration).count() / nb_iterations / size;
+}
+
+double calcMaxError(const std::vector<double> & values, const std::vector<double> & expected)
+{
+  double max_error = 0.0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    max_error = std::max(max_error, std::abs(values.at(i) - expected.at(i)));
+  }
+  return max_error;
+}
+}  // namespace
+
+int main()
+{
+  using tier4_autoware_utils::pi;
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> angle_dist(-2.0 * pi, 2.0 * pi);
+  std::uniform_real_distribution<double> position_dist(-100.0, 100.0);
+
+  std::cout << "#N [ns/element] sincos_libm sincos_table sincos_batch atan2_libm atan2_batch "
+               "from_yaw_tf2 from_yaw_batch get_yaw_tf2 get_yaw_batch"
+            << std::endl;
+  std::cout << "#N [max error] sincos_table sincos_batch atan2_batch from_yaw_batch get_yaw_batch"
+            << std::endl;
+  for (const size_t size : {100, 1000, 10000}) {
+    std::vector<double> radians(size);
+    std::vector<double> x(size);
+    std::vector<double> y(size);
+    for (size_t i = 0; i < size; ++i) {
+      radians.at(i) = angle_dist(engine);
+      x.at(i) = position_dist(engine);
+      y.at(i) = position_dist(engine);
+    }
+
+    // sin and cos
+    std::vector<double> libm_sin(size);
+    std::vector<double> libm_cos(size);
+    const double sincos_libm_time = measureNanosecondsPerElement(size, [&]() {
+      for (size_t i = 0; i < size; ++i) {
+        libm_sin[i] = std::sin(radians[i]);
+        libm_cos[i] = std::cos(radians[i]);
+      }
+    });
+    std::vector<double> table_sin(size);
+    std::vector<double> table_cos(size);
+    const double sincos_table_time = measureNanosecondsPerElement(size, [&]() {
+      for (size_t i = 0; i < size; ++i) {
+        table_sin[i] = tier4_autoware_utils::sin(static_cast<float>(radians[i]));
+        table_cos[i] = tier4_autoware_utils::cos(static_cast<float>(radians[i]));
+      }
+    });
+    std::vector<double> batch_sin(size);
+    std::vector<double> batch_cos(size);
+    const double sincos_batch_time = measureNanosecondsPerElement(
+      size, [&]() { tier4_autoware_utils::sinCos(radians, batch_sin, batch_cos); });
+
+    // atan2
+    std::vector<double> libm_atan2(size);
+    const double atan2_libm_time = measureNanosecondsPerElement(size, [&]() {
+      for (size_t i = 0; i < size; ++i) {
+        libm_atan2[i] = std::atan2(y[i], x[i]);
+      }
+    });
+    std::vector<double> batch_atan2(size);
+    const double atan2_batch_time = measureNanosecondsPerElement(size, [&]() {
+      tier4_autoware_utils::atan2(y.data(), x.data(), size, batch_atan2.data());
+    });
+
+    // yaw -> quaternion
+    std::vector<geometry_msgs::msg::Quaternion> tf2_quaternions(size);
+    const double from_yaw_tf2_time = measureNanosecondsPerElement(size, [&]() {
+      for (size_t i = 0; i < size; ++i) {
+        tf2_quaternions[i] = tier4_autoware_utils::createQuaternionFromYaw(radians[i]);
+      }
+    });
+    std::vector<geometry_msgs::msg::Quaternion> batch_quaternions;
+    const double from_yaw_batch_time = measureNanosecondsPerElement(size, [&]() {
+      batch_quaternions = tier4_autoware_utils::createQuaternionFromYaw(radians);
+    });
+    double from_yaw_error = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+      from_yaw_error = std::max(
+        {from_yaw_error, std::abs(batch_quaternions[i].z - tf2_quaternions[i].z),
+         std::abs(batch_quaternions[i].w - tf2_quaternions[i].w)});
+    }
+
+    // quaternion -> yaw
+    std::vector<double> tf2_yaws(size);
+    const double get_yaw_tf2_time = measureNanosecondsPerElement(size, [&]() {
+      for (size_t i = 0; i < size; ++i) {
+        tf2_yaws[i] = tf2::getYaw(tf2_quaternions[i]);
+      }
+    });
+    std::vector<double> batch_yaws;
+    const double get_yaw_batch_time = measureNanosecondsPerElement(
+      size, [&]() { batch_yaws = tier4_autoware_utils::getYaw(tf2_quaternions); });
+
+    std::cout << size << " " << sincos_libm_time << " " << sincos_table_time << " "
+              << sincos_batch_time << " " << atan2_libm_time << " " << atan2_batch_time << " "
+              << from_yaw_tf2_time << " " << from_yaw_batch_time << " " << get_yaw_tf2_time << " "
+              << get_yaw_batch_time << std::endl;
+    std::cout << size << " "
+              << std::max(calcMaxError(table_sin, libm_sin), calcMaxError(table_cos, libm_cos))
+              << " "
+              << std::max(calcMaxError(batch_sin, libm_sin), calcMaxError(batch_cos, libm_cos))
+              << " " << calcMaxError(batch_atan2, libm_atan2) << " " << from_yaw_error << " "
+              << calcMaxError(batch_yaws, tf2_yaws) << std::endl;
+  }
+  return 0;
+}
@@ -317,6 +317,29 @@ geometry_msgs::msg::Quaternion createQuaternionFromRPY(
 
 geometry_msgs::msg::Quaternion createQuaternionFromYaw(const double yaw);
 
+/**
+ * @brief create quaternions from the arrays of roll, pitch and yaw at once. The trigonometric
+ *        functions are calculated by the vectorized kernels, so it is faster than calling
+ *        createQuaternionFromRPY for each angle.
+ * @throw std::invalid_argument if the sizes of the arrays are different
+ */
+std::vector<geometry_msgs::msg::Quaternion> createQuaternionFromRPY(
+  const std::vector<double> & rolls, const std::vector<double> & pitches,
+  const std::vector<double> & yaws);
+
+/**
+ * @brief create quaternions from the array of yaw at once, which is faster than calling
+ *        createQuaternionFromYaw for each yaw
+ */
+std::vector<geometry_msgs::msg::Quaternion> createQuaternionFromYaw(
+  const std::vector<double> & yaws);
+
+/**
+ * @brief get the yaws of the quaternions at once, which is faster than calling tf2::getYaw for
+ *        each quaternion. The results are the same as tf2::getYaw including the gimbal lock.
+ */
+std::vector<double> getYaw(const std::vector<geometry_msgs::msg::Quaternion> & quaternions);
+
 template <class Point1, class Point2>
 double calcDistance2d(const Point1 & point1, const Point2 & point2)
 {
@@ -15,6 +15,9 @@
 #ifndef TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 #define TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 
+#include <cstddef>
+#include <vector>
+
 namespace tier4_autoware_utils
 {
 
@@ -22,6 +25,34 @@ float sin(float radian);
 
 float cos(float radian);
 
+/**
+ * @brief calculate sin and cos of each angle in double precision
+ * @details The kernel has no branch so that the compiler can vectorize the loop. The angles
+ *          larger than 1e5 in absolute value, inf and NaN are calculated by std::sin and std::cos.
+ * @param radians input angles of size
+ * @param size number of angles
+ * @param sin_values [out] sin of the angles, whose size is at least size
+ * @param cos_values [out] cos of the angles, whose size is at least size
+ */
+void sinCos(const double * radians, const size_t size, double * sin_values, double * cos_values);
+
+void sinCos(
+  const std::vector<double> & radians, std::vector<double> & sin_values,
+  std::vector<double> & cos_values);
+
+/**
+ * @brief calculate atan2(y, x) of each pair in double precision
+ * @details The kernel has no branch so that the compiler can vectorize the loop. The pairs
+ *          including inf or NaN are calculated by std::atan2.
+ * @param y input y of size
+ * @param x input x of size
+ * @param size number of pairs
+ * @param radians [out] angles in [-pi, pi], whose size is at least size
+ */
+void atan2(const double * y, const double * x, const size_t size, double * radians);
+
+std::vector<double> atan2(const std::vector<double> & y, const std::vector<double> & x);
+
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
@@ -0,0 +1,101 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__THREAD_POOL_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief fixed size pool of worker threads which are kept alive between the calls, so that the
+ *        tasks can be run in parallel without the cost of spawning threads at every cycle.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @param num_threads number of the worker threads. the number of hardware threads is used if 0.
+   */
+  explicit ThreadPool(const size_t num_threads = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+  ThreadPool & operator=(ThreadPool &&) = delete;
+
+  /**
+   * @brief queue the task to run on a worker thread.
+   * @return future to get the result (or the exception thrown) of the task.
+   */
+  template <class F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F && f)
+  {
+    using ResultT = std::invoke_result_t<std::decay_t<F>>;
+    auto task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<F>(f));
+    auto future = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.emplace([task]() { (*task)(); });
+    }
+    cv_.notify_one();
+    return future;
+  }
+
+  /**
+   * @brief run f(i) for i in [0, n) on the worker threads and wait until all of them finish.
+   *        the exception thrown in a task is rethrown in the caller thread.
+   */
+  template <class F>
+  void parallelFor(const size_t n, F && f)
+  {
+    std::vector<std::future<void>> futures;
+    futures.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      futures.push_back(submit([&f, i]() { f(i); }));
+    }
+    for (auto & future : futures) {
+      future.wait();
+    }
+    for (auto & future : futures) {
+      future.get();
+    }
+  }
+
+  size_t size() const { return workers_.size(); }
+
+private:
+  void work();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool is_stopped_{false};
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__THREAD_POOL_HPP_
@@ -0,0 +1,191 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__SYSTEM__TRACER_HPP_
+#define TIER4_AUTOWARE_UTILS__SYSTEM__TRACER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+struct SpanRecord
+{
+  const char * name{nullptr};  // string literal given to TIER4_TRACE_SCOPE
+  int64_t begin_ns{0};
+  int64_t end_ns{0};
+  uint32_t thread_id{0};
+  uint32_t depth{0};  // nesting level of the span in the thread, 0 for the outermost one
+};
+
+struct SpanStatistics
+{
+  std::string name;
+  size_t count{0};  // number of the spans recorded since the tracer was enabled
+  // the following values are computed over the latest spans in the statistics window [ms]
+  double mean{0.0};
+  double p50{0.0};
+  double p90{0.0};
+  double p99{0.0};
+  double max{0.0};
+};
+
+struct TracerOptions
+{
+  // the chrome trace (loadable in chrome://tracing and Perfetto) is written on disable() if set
+  std::string trace_file{};
+  // number of the latest spans kept for the trace file. the older spans are discarded.
+  size_t max_records{1 << 20};
+  // number of the latest spans per name used for the statistics
+  size_t statistics_window{1000};
+  // period to move the spans from the per-thread buffers to the tracer
+  std::chrono::milliseconds collect_period{100};
+  // number of the spans each thread can hold until the next collection
+  size_t buffer_capacity{1 << 14};
+};
+
+/**
+ * @brief single producer single consumer ring buffer of the spans. the owner thread pushes the
+ *        spans without locking and the tracer drains them. the spans are dropped when it is full.
+ */
+class SpanBuffer
+{
+public:
+  SpanBuffer(const uint32_t thread_id, const size_t capacity);
+
+  bool push(const SpanRecord & record) noexcept;
+  size_t drain(std::vector<SpanRecord> & records);
+
+  bool empty() const
+  {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+  uint32_t threadId() const { return thread_id_; }
+  uint64_t droppedCount() const { return dropped_count_.load(std::memory_order_relaxed); }
+
+private:
+  const uint32_t thread_id_;
+  const size_t mask_;
+  std::vector<SpanRecord> records_;
+  std::atomic<size_t> head_{0};  // written by the owner thread
+  std::atomic<size_t> tail_{0};  // written by the tracer
+  std::atomic<uint64_t> dropped_count_{0};
+};
+
+/**
+ * @brief process-wide collector of the spans recorded with TIER4_TRACE_SCOPE. the tracer is
+ *        disabled by default and the spans cost only a check of the flag in that case.
+ *        it is enabled with enable(), or at startup when the environment variable
+ *        TIER4_TRACE_FILE (trace file path) or TIER4_TRACE (statistics only) is set. the pid is
+ *        appended to TIER4_TRACE_FILE so that the processes do not overwrite the others' trace.
+ */
+class Tracer
+{
+public:
+  static Tracer & getInstance();
+  static bool isEnabled() noexcept { return is_enabled_.load(std::memory_order_relaxed); }
+
+  ~Tracer();
+  Tracer(const Tracer &) = delete;
+  Tracer & operator=(const Tracer &) = delete;
+
+  void enable(const TracerOptions & options = TracerOptions{});
+  // stop collecting, and write the trace file if it is given
+  void disable();
+
+  void record(const SpanRecord & record) noexcept;
+
+  // move the spans in the per-thread buffers to the tracer, which is done periodically when enabled
+  void collect();
+
+  // spans kept for the trace file (only when the trace file is given)
+  std::vector<SpanRecord> getRecords() const;
+  std::vector<SpanStatistics> getStatistics() const;
+  // number of the spans dropped since the per-thread buffers are full
+  uint64_t getDroppedCount() const;
+  // number of the spans discarded from the trace file since max_records is exceeded
+  uint64_t getDiscardedCount() const;
+
+  // insert the pid before the extension, e.g. /tmp/trace.json -> /tmp/trace.1234.json
+  static std::string getProcessTraceFilePath(const std::string & trace_file);
+
+  static std::string toChromeTraceJson(const std::vector<SpanRecord> & records);
+  static std::string toString(const std::vector<SpanStatistics> & statistics);
+
+private:
+  Tracer();
+
+  std::shared_ptr<SpanBuffer> createBuffer();
+  void runCollector();
+
+  inline static std::atomic<bool> is_enabled_{false};
+
+  TracerOptions options_{};
+
+  std::mutex buffers_mutex_;
+  std::vector<std::shared_ptr<SpanBuffer>> buffers_;
+  std::atomic<uint32_t> next_thread_id_{0};
+  std::atomic<uint64_t> generation_{0};  // incremented on enable() to renew the thread buffers
+
+  mutable std::mutex collect_mutex_;
+  std::deque<SpanRecord> records_;
+  std::map<std::string, std::deque<double>> durations_;
+  std::map<std::string, size_t> counts_;
+  uint64_t dropped_count_{0};
+  uint64_t discarded_count_{0};
+
+  std::mutex collector_mutex_;
+  std::condition_variable collector_cv_;
+  std::thread collector_;
+  bool is_collector_stopped_{false};
+};
+
+/**
+ * @brief record the span from the construction to the destruction of the object.
+ */
+class ScopedSpan
+{
+public:
+  explicit ScopedSpan(const char * name) noexcept;
+  ~ScopedSpan();
+
+  ScopedSpan(const ScopedSpan &) = delete;
+  ScopedSpan & operator=(const ScopedSpan &) = delete;
+
+private:
+  const char * name_{nullptr};
+  int64_t begin_ns_{0};
+  uint32_t depth_{0};
+};
+}  // namespace tier4_autoware_utils
+
+#define TIER4_TRACE_CONCAT_IMPL(x, y) x##y
+#define TIER4_TRACE_CONCAT(x, y) TIER4_TRACE_CONCAT_IMPL(x, y)
+
+// the name must be a string literal so that the span keeps only the pointer to it
+#define TIER4_TRACE_SCOPE(name)                                                      \
+  const ::tier4_autoware_utils::ScopedSpan TIER4_TRACE_CONCAT(tier4_trace_span_, __LINE__)( \
+    "" name "")
+
+#endif  // TIER4_AUTOWARE_UTILS__SYSTEM__TRACER_HPP_
@@ -14,12 +14,17 @@
 
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
+#include "tier4_autoware_utils/math/trigonometry.hpp"
+
 #include <Eigen/Geometry>
 
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 
 #include <tf2/convert.h>
 
+#include <stdexcept>
+#include <vector>
+
 namespace tf2
 {
 void fromMsg(const geometry_msgs::msg::PoseStamped & msg, tf2::Stamped<tf2::Transform> & out)
@@ -94,6 +99,84 @@ geometry_msgs::msg::Quaternion createQuaternionFromYaw(const double yaw)
   return tf2::toMsg(q);
 }
 
+std::vector<geometry_msgs::msg::Quaternion> createQuaternionFromRPY(
+  const std::vector<double> & rolls, const std::vector<double> & pitches,
+  const std::vector<double> & yaws)
+{
+  if (rolls.size() != pitches.size() || rolls.size() != yaws.size()) {
+    throw std::invalid_argument("The sizes of rolls, pitches and yaws must be the same.");
+  }
+
+  const size_t size = yaws.size();
+  std::vector<double> half_angles(3 * size);
+  for (size_t i = 0; i < size; ++i) {
+    half_angles.at(i) = rolls.at(i) * 0.5;
+    half_angles.at(size + i) = pitches.at(i) * 0.5;
+    half_angles.at(2 * size + i) = yaws.at(i) * 0.5;
+  }
+  std::vector<double> sin_values;
+  std::vector<double> cos_values;
+  sinCos(half_angles, sin_values, cos_values);
+
+  // same as tf2::Quaternion::setRPY
+  std::vector<geometry_msgs::msg::Quaternion> quaternions(size);
+  for (size_t i = 0; i < size; ++i) {
+    const double sin_roll = sin_values.at(i);
+    const double cos_roll = cos_values.at(i);
+    const double sin_pitch = sin_values.at(size + i);
+    const double cos_pitch = cos_values.at(size + i);
+    const double sin_yaw = sin_values.at(2 * size + i);
+    const double cos_yaw = cos_values.at(2 * size + i);
+    auto & q = quaternions.at(i);
+    q.x = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+    q.y = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+    q.z = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
+    q.w = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+  }
+  return quaternions;
+}
+
+std::vector<geometry_msgs::msg::Quaternion> createQuaternionFromYaw(
+  const std::vector<double> & yaws)
+{
+  std::vector<double> half_yaws(yaws.size());
+  for (size_t i = 0; i < yaws.size(); ++i) {
+    half_yaws.at(i) = yaws.at(i) * 0.5;
+  }
+  std::vector<double> sin_values;
+  std::vector<double> cos_values;
+  sinCos(half_yaws, sin_values, cos_values);
+
+  std::vector<geometry_msgs::msg::Quaternion> quaternions(yaws.size());
+  for (size_t i = 0; i < yaws.size(); ++i) {
+    quaternions.at(i) = createQuaternion(0.0, 0.0, sin_values.at(i), cos_values.at(i));
+  }
+  return quaternions;
+}
+
+std::vector<double> getYaw(const std::vector<geometry_msgs::msg::Quaternion> & quaternions)
+{
+  std::vector<double> y(quaternions.size());
+  std::vector<double> x(quaternions.size());
+  for (size_t i = 0; i < quaternions.size(); ++i) {
+    const auto & q = quaternions.at(i);
+    y.at(i) = 2.0 * (q.x * q.y + q.w * q.z);
+    x.at(i) = q.w * q.w + q.x * q.x - q.y * q.y - q.z * q.z;
+  }
+  auto yaws = atan2(y, x);
+
+  // NOTE: tf2::getYaw uses another formula near the gimbal lock, which is rare on the road.
+  for (size_t i = 0; i < quaternions.size(); ++i) {
+    const auto & q = quaternions.at(i);
+    const double squared_norm = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+    const double sin_pitch = -2.0 * (q.x * q.z - q.w * q.y) / squared_norm;
+    if (!(std::abs(sin_pitch) < 0.99999)) {
+      yaws.at(i) = tf2::getYaw(q);
+    }
+  }
+  return yaws;
+}
+
 double calcElevationAngle(
   const geometry_msgs::msg::Point & p_from, const geometry_msgs::msg::Point & p_to)
 {
@@ -18,9 +18,79 @@
 #include "tier4_autoware_utils/math/sin_table.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
 
 namespace tier4_autoware_utils
 {
+namespace
+{
+// pi / 2 split into three parts, whose first part times an integer less than 2^20 is exact
+constexpr double pio2_1 = 1.57079632673412561417e+00;
+constexpr double pio2_2 = 6.07710050630396597660e-11;
+constexpr double pio2_3 = 2.02226624879595063154e-21;
+constexpr double two_over_pi = 6.36619772367581382433e-01;
+constexpr double max_reducible_radian = 1.0e5;
+
+// adding and subtracting 1.5 * 2^52 rounds a double to the nearest integer, which is stored in the
+// lowest bits of the mantissa of the sum
+constexpr double round_shifter = 6755399441055744.0;
+
+// minimax polynomials of sin and cos on [-pi/4, pi/4], which are the same as fdlibm
+constexpr double sin_coef1 = -1.66666666666666324348e-01;
+constexpr double sin_coef2 = 8.33333333332248946124e-03;
+constexpr double sin_coef3 = -1.98412698298579493134e-04;
+constexpr double sin_coef4 = 2.75573137070700676789e-06;
+constexpr double sin_coef5 = -2.50507602534068634195e-08;
+constexpr double sin_coef6 = 1.58969099521155010221e-10;
+constexpr double cos_coef1 = 4.16666666666666019037e-02;
+constexpr double cos_coef2 = -1.38888888888741095749e-03;
+constexpr double cos_coef3 = 2.48015872894767294178e-05;
+constexpr double cos_coef4 = -2.75573143513906633035e-07;
+constexpr double cos_coef5 = 2.08757232129817482790e-09;
+constexpr double cos_coef6 = -1.13596475577881948265e-11;
+
+// rational approximation of atan on [-0.66, 0.66], which is the same as Cephes
+constexpr double atan_p0 = -8.750608600031904122785e-01;
+constexpr double atan_p1 = -1.615753718733365076637e+01;
+constexpr double atan_p2 = -7.500855792314704667340e+01;
+constexpr double atan_p3 = -1.228866684490136173410e+02;
+constexpr double atan_p4 = -6.485021904942025371773e+01;
+constexpr double atan_q0 = 2.485846490142306297962e+01;
+constexpr double atan_q1 = 1.650270098316988542046e+02;
+constexpr double atan_q2 = 4.328810604912902668951e+02;
+constexpr double atan_q3 = 4.853903996359136964868e+02;
+constexpr double atan_q4 = 1.945506571482613964425e+02;
+constexpr double pio4 = 7.85398163397448309616e-01;
+constexpr double pio2 = 1.57079632679489661923e+00;
+constexpr double pi_hi = 3.14159265358979311600e+00;
+constexpr double pi_lo = 1.22464679914735317720e-16;
+
+uint64_t toBits(const double value)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double fromBits(const uint64_t bits)
+{
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// NOTE: The compiler moves the calculation of the operand used only in either case of the
+// conditional operator into a branch, and the loop is not vectorized without fast-math since the
+// floating point operations may trap. Both operands are used by blending their bits.
+double select(const bool condition, const double true_value, const double false_value)
+{
+  const uint64_t mask = ~(static_cast<uint64_t>(condition) - 1U);
+  return fromBits((toBits(true_value) & mask) | (toBits(false_value) & ~mask));
+}
+}  // namespace
 
 float sin(float radian)
 {
@@ -49,4 +119,100 @@ float cos(float radian)
   return sin(radian + static_cast<float>(tier4_autoware_utils::pi) / 2.f);
 }
 
+void sinCos(const double * radians, const size_t size, double * sin_values, double * cos_values)
+{
+  for (size_t i = 0; i < size; ++i) {
+    // reduce the angle to r in [-pi/4, pi/4] where radian = r + q * pi / 2
+    const double radian = radians[i];
+    const double shifted_q = radian * two_over_pi + round_shifter;
+    const double q = shifted_q - round_shifter;
+    uint64_t quadrant;
+    std::memcpy(&quadrant, &shifted_q, sizeof(quadrant));
+    const double r = ((radian - q * pio2_1) - q * pio2_2) - q * pio2_3;
+
+    const double z = r * r;
+    const double sin_r =
+      r + r * z *
+            (sin_coef1 +
+             z * (sin_coef2 + z * (sin_coef3 + z * (sin_coef4 + z * (sin_coef5 + z * sin_coef6)))));
+    const double cos_r =
+      1.0 - 0.5 * z +
+      z * z *
+        (cos_coef1 +
+         z * (cos_coef2 + z * (cos_coef3 + z * (cos_coef4 + z * (cos_coef5 + z * cos_coef6)))));
+
+    // sin and cos are swapped in the odd quadrants, sin is negative in the quadrants 2 and 3, and
+    // cos is negative in the quadrants 1 and 2
+    const bool is_swapped = (quadrant & 1U) != 0U;
+    const double abs_sin = is_swapped ? cos_r : sin_r;
+    const double abs_cos = is_swapped ? sin_r : cos_r;
+    sin_values[i] = (quadrant & 2U) != 0U ? -abs_sin : abs_sin;
+    cos_values[i] = ((quadrant + 1U) & 2U) != 0U ? -abs_cos : abs_cos;
+  }
+
+  // NOTE: The reduction above loses the accuracy for large angles.
+  for (size_t i = 0; i < size; ++i) {
+    if (!(std::abs(radians[i]) <= max_reducible_radian)) {
+      sin_values[i] = std::sin(radians[i]);
+      cos_values[i] = std::cos(radians[i]);
+    }
+  }
+}
+
+void sinCos(
+  const std::vector<double> & radians, std::vector<double> & sin_values,
+  std::vector<double> & cos_values)
+{
+  sin_values.resize(radians.size());
+  cos_values.resize(radians.size());
+  sinCos(radians.data(), radians.size(), sin_values.data(), cos_values.data());
+}
+
+void atan2(const double * y, const double * x, const size_t size, double * radians)
+{
+  for (size_t i = 0; i < size; ++i) {
+    // reduce to atan(a) with a in [0, 1]
+    const double abs_y = std::abs(y[i]);
+    const double abs_x = std::abs(x[i]);
+    const bool is_steep = abs_x < abs_y;
+    const double numerator = select(is_steep, abs_x, abs_y);
+    const double denominator = select(is_steep, abs_y, abs_x);
+    const double a = numerator / select(denominator == 0.0, 1.0, denominator);
+
+    // reduce to atan(t) with t in [-0.66, 0.66] since atan(a) = pi / 4 + atan((a - 1) / (a + 1))
+    const bool is_large = 0.66 < a;
+    const double t = select(is_large, (a - 1.0) / (a + 1.0), a);
+    const double z = t * t;
+    const double p = (((atan_p0 * z + atan_p1) * z + atan_p2) * z + atan_p3) * z + atan_p4;
+    const double q = ((((z + atan_q0) * z + atan_q1) * z + atan_q2) * z + atan_q3) * z + atan_q4;
+    const double atan_t = t + t * z * p / q;
+    const double atan_a = select(is_large, pio4 + (atan_t + 0.25 * pi_lo), atan_t);
+
+    // atan2(|y|, |x|) = pi / 2 - atan(a) if |y| > |x|, and atan2(y, x) = pi - atan2(|y|, |x|) if
+    // x < 0
+    const double first_quadrant = select(is_steep, (pio2 - atan_a) + 0.5 * pi_lo, atan_a);
+    const bool is_negative_x = (toBits(x[i]) >> 63U) != 0U;  // std::signbit is not vectorized
+    const double upper_half =
+      select(is_negative_x, (pi_hi - first_quadrant) + pi_lo, first_quadrant);
+    radians[i] = std::copysign(upper_half, y[i]);
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    if (!std::isfinite(x[i]) || !std::isfinite(y[i])) {
+      radians[i] = std::atan2(y[i], x[i]);
+    }
+  }
+}
+
+std::vector<double> atan2(const std::vector<double> & y, const std::vector<double> & x)
+{
+  if (y.size() != x.size()) {
+    throw std::invalid_argument("The sizes of y and x must be the same.");
+  }
+
+  std::vector<double> radians(y.size());
+  atan2(y.data(), x.data(), y.size(), radians.data());
+  return radians;
+}
+
 }  // namespace tier4_autoware_utils
@@ -0,0 +1,61 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace tier4_autoware_utils
+{
+ThreadPool::ThreadPool(const size_t num_threads)
+{
+  const size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+  const size_t size = num_threads == 0 ? hardware_threads : num_threads;
+
+  workers_.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    workers_.emplace_back([this]() { work(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_ = true;
+  }
+  cv_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::work()
+{
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() { return is_stopped_ || !tasks_.empty(); });
+      // finish the queued tasks before stopping not to leave the futures unsatisfied
+      if (is_stopped_ && tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+}  // namespace tier4_autoware_utils
@@ -0,0 +1,402 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/tracer.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+int64_t nowNs() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+size_t ceilPowerOfTwo(const size_t n)
+{
+  size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+double percentile(const std::vector<double> & sorted, const double ratio)
+{
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  const auto idx = static_cast<size_t>(ratio * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted.at(std::min(idx, sorted.size() - 1));
+}
+
+std::string escapeJson(const std::string & str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+struct ThreadState
+{
+  std::shared_ptr<tier4_autoware_utils::SpanBuffer> buffer{};
+  uint64_t generation{0};
+  uint32_t depth{0};
+};
+
+ThreadState & threadState()
+{
+  thread_local ThreadState state;
+  return state;
+}
+}  // namespace
+
+namespace tier4_autoware_utils
+{
+SpanBuffer::SpanBuffer(const uint32_t thread_id, const size_t capacity)
+: thread_id_(thread_id),
+  mask_(ceilPowerOfTwo(std::max<size_t>(capacity, 2)) - 1),
+  records_(mask_ + 1)
+{
+}
+
+bool SpanBuffer::push(const SpanRecord & record) noexcept
+{
+  const auto head = head_.load(std::memory_order_relaxed);
+  const auto tail = tail_.load(std::memory_order_acquire);
+  if (head - tail > mask_) {
+    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  records_[head & mask_] = record;
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+size_t SpanBuffer::drain(std::vector<SpanRecord> & records)
+{
+  const auto tail = tail_.load(std::memory_order_relaxed);
+  const auto head = head_.load(std::memory_order_acquire);
+  for (auto i = tail; i != head; ++i) {
+    records.push_back(records_[i & mask_]);
+  }
+  tail_.store(head, std::memory_order_release);
+  return head - tail;
+}
+
+Tracer & Tracer::getInstance()
+{
+  static Tracer tracer;
+  return tracer;
+}
+
+Tracer::Tracer()
+{
+  const char * trace_file = std::getenv("TIER4_TRACE_FILE");
+  const char * trace = std::getenv("TIER4_TRACE");
+  if (trace_file != nullptr || (trace != nullptr && std::string(trace) != "0")) {
+    TracerOptions options;
+    if (trace_file != nullptr) {
+      // the environment variable is shared by all the processes launched together
+      options.trace_file = getProcessTraceFilePath(trace_file);
+    }
+    enable(options);
+  }
+}
+
+Tracer::~Tracer()
+{
+  disable();
+}
+
+void Tracer::enable(const TracerOptions & options)
+{
+  disable();
+
+  {
+    std::lock_guard<std::mutex> lock(collect_mutex_);
+    options_ = options;
+    records_.clear();
+    durations_.clear();
+    counts_.clear();
+    dropped_count_ = 0;
+    discarded_count_ = 0;
+  }
+  generation_.fetch_add(1);
+
+  {
+    std::lock_guard<std::mutex> lock(collector_mutex_);
+    is_collector_stopped_ = false;
+  }
+  collector_ = std::thread([this]() { runCollector(); });
+
+  is_enabled_.store(true);
+}
+
+void Tracer::disable()
+{
+  is_enabled_.store(false);
+
+  {
+    std::lock_guard<std::mutex> lock(collector_mutex_);
+    is_collector_stopped_ = true;
+  }
+  collector_cv_.notify_all();
+  if (collector_.joinable()) {
+    collector_.join();
+  }
+
+  collect();
+
+  std::string trace_file;
+  {
+    std::lock_guard<std::mutex> lock(collect_mutex_);
+    trace_file = options_.trace_file;
+  }
+  if (!trace_file.empty()) {
+    std::ofstream ofs(trace_file);
+    ofs << toChromeTraceJson(getRecords());
+  }
+
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  buffers_.clear();
+}
+
+void Tracer::record(const SpanRecord & record) noexcept
+{
+  auto & state = threadState();
+  const auto generation = generation_.load(std::memory_order_relaxed);
+  if (!state.buffer || state.generation != generation) {
+    try {
+      state.buffer = createBuffer();
+      state.generation = generation;
+    } catch (...) {
+      return;
+    }
+  }
+  auto span = record;
+  span.thread_id = state.buffer->threadId();
+  state.buffer->push(span);
+}
+
+std::shared_ptr<SpanBuffer> Tracer::createBuffer()
+{
+  size_t capacity{};
+  {
+    std::lock_guard<std::mutex> lock(collect_mutex_);
+    capacity = options_.buffer_capacity;
+  }
+
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  auto buffer = std::make_shared<SpanBuffer>(next_thread_id_.fetch_add(1), capacity);
+  buffers_.push_back(buffer);
+  return buffer;
+}
+
+void Tracer::collect()
+{
+  std::vector<std::shared_ptr<SpanBuffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers = buffers_;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(collect_mutex_);
+
+    std::vector<SpanRecord> records;
+    uint64_t dropped_count = 0;
+    for (const auto & buffer : buffers) {
+      buffer->drain(records);
+      dropped_count += buffer->droppedCount();
+    }
+    dropped_count_ = dropped_count;
+
+    for (const auto & record : records) {
+      auto & durations = durations_[record.name];
+      durations.push_back(static_cast<double>(record.end_ns - record.begin_ns) * 1e-6);
+      while (durations.size() > options_.statistics_window) {
+        durations.pop_front();
+      }
+      ++counts_[record.name];
+    }
+
+    if (!options_.trace_file.empty()) {
+      records_.insert(records_.end(), records.begin(), records.end());
+      if (records_.size() > options_.max_records) {
+        const auto num_discarded = records_.size() - options_.max_records;
+        records_.erase(records_.begin(), records_.begin() + num_discarded);
+        discarded_count_ += num_discarded;
+      }
+    }
+  }
+
+  // release the buffers of the finished threads
+  buffers.clear();
+  std::lock_guard<std::mutex> buffers_lock(buffers_mutex_);
+  buffers_.erase(
+    std::remove_if(
+      buffers_.begin(), buffers_.end(),
+      [](const auto & buffer) { return buffer.use_count() == 1 && buffer->empty(); }),
+    buffers_.end());
+}
+
+void Tracer::runCollector()
+{
+  std::unique_lock<std::mutex> lock(collector_mutex_);
+  while (!is_collector_stopped_) {
+    collector_cv_.wait_for(lock, options_.collect_period, [this]() {
+      return is_collector_stopped_;
+    });
+    lock.unlock();
+    collect();
+    lock.lock();
+  }
+}
+
+std::vector<SpanRecord> Tracer::getRecords() const
+{
+  std::lock_guard<std::mutex> lock(collect_mutex_);
+  return {records_.begin(), records_.end()};
+}
+
+std::vector<SpanStatistics> Tracer::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock(collect_mutex_);
+
+  std::vector<SpanStatistics> statistics;
+  for (const auto & [name, durations] : durations_) {
+    if (durations.empty()) {
+      continue;
+    }
+    std::vector<double> sorted(durations.begin(), durations.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    SpanStatistics stat;
+    stat.name = name;
+    stat.count = counts_.at(name);
+    double sum = 0.0;
+    for (const auto d : sorted) {
+      sum += d;
+    }
+    stat.mean = sum / static_cast<double>(sorted.size());
+    stat.p50 = percentile(sorted, 0.5);
+    stat.p90 = percentile(sorted, 0.9);
+    stat.p99 = percentile(sorted, 0.99);
+    stat.max = sorted.back();
+    statistics.push_back(stat);
+  }
+  return statistics;
+}
+
+uint64_t Tracer::getDroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(collect_mutex_);
+  return dropped_count_;
+}
+
+uint64_t Tracer::getDiscardedCount() const
+{
+  std::lock_guard<std::mutex> lock(collect_mutex_);
+  return discarded_count_;
+}
+
+std::string Tracer::getProcessTraceFilePath(const std::string & trace_file)
+{
+  const auto pid = std::to_string(getpid());
+  const auto slash_pos = trace_file.find_last_of('/');
+  const auto name_pos = slash_pos == std::string::npos ? 0 : slash_pos + 1;
+  const auto dot_pos = trace_file.find_last_of('.');
+  // no extension, or a hidden file without extension such as .trace
+  if (dot_pos == std::string::npos || dot_pos <= name_pos) {
+    return trace_file + "." + pid;
+  }
+  return trace_file.substr(0, dot_pos) + "." + pid + trace_file.substr(dot_pos);
+}
+
+std::string Tracer::toChromeTraceJson(const std::vector<SpanRecord> & records)
+{
+  const auto pid = static_cast<int64_t>(getpid());
+
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "{\"traceEvents\":[";
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto & record = records.at(i);
+    if (i != 0) {
+      ss << ",";
+    }
+    // complete event, whose time is in microseconds
+    ss << "\n{\"name\":\"" << escapeJson(record.name) << "\",\"ph\":\"X\",\"pid\":" << pid
+       << ",\"tid\":" << record.thread_id
+       << ",\"ts\":" << static_cast<double>(record.begin_ns) * 1e-3
+       << ",\"dur\":" << static_cast<double>(record.end_ns - record.begin_ns) * 1e-3
+       << ",\"args\":{\"depth\":" << record.depth << "}}";
+  }
+  ss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return ss.str();
+}
+
+std::string Tracer::toString(const std::vector<SpanStatistics> & statistics)
+{
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "name, count, mean[ms], p50[ms], p90[ms], p99[ms], max[ms]\n";
+  for (const auto & stat : statistics) {
+    ss << stat.name << ", " << stat.count << ", " << stat.mean << ", " << stat.p50 << ", "
+       << stat.p90 << ", " << stat.p99 << ", " << stat.max << "\n";
+  }
+  return ss.str();
+}
+
+ScopedSpan::ScopedSpan(const char * name) noexcept
+{
+  // getInstance() enables the tracer with the environment variables at the first call
+  if (!Tracer::getInstance().isEnabled()) {
+    return;
+  }
+  name_ = name;
+  depth_ = threadState().depth++;
+  begin_ns_ = nowNs();
+}
+
+ScopedSpan::~ScopedSpan()
+{
+  if (name_ == nullptr) {
+    return;
+  }
+  const auto end_ns = nowNs();
+  --threadState().depth;
+  SpanRecord record;
+  record.name = name_;
+  record.begin_ns = begin_ns_;
+  record.end_ns = end_ns;
+  record.depth = depth_;
+  Tracer::getInstance().record(record);
+}
+}  // namespace tier4_autoware_utils
@@ -19,7 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 constexpr double epsilon = 1e-6;
 
@@ -418,6 +420,85 @@ TEST(geometry, createQuaternionFromYaw)
   }
 }
 
+TEST(geometry, createQuaternionFromRPY_batch)
+{
+  using tier4_autoware_utils::createQuaternionFromRPY;
+  using tier4_autoware_utils::deg2rad;
+
+  std::vector<double> rolls;
+  std::vector<double> pitches;
+  std::vector<double> yaws;
+  for (int i = -36; i <= 36; ++i) {
+    rolls.push_back(deg2rad(5.0 * i));
+    pitches.push_back(deg2rad(2.5 * i));
+    yaws.push_back(deg2rad(10.0 * i));
+  }
+
+  const auto quaternions = createQuaternionFromRPY(rolls, pitches, yaws);
+  ASSERT_EQ(quaternions.size(), yaws.size());
+  for (size_t i = 0; i < yaws.size(); ++i) {
+    const auto q_expected = createQuaternionFromRPY(rolls.at(i), pitches.at(i), yaws.at(i));
+    EXPECT_NEAR(quaternions.at(i).x, q_expected.x, epsilon);
+    EXPECT_NEAR(quaternions.at(i).y, q_expected.y, epsilon);
+    EXPECT_NEAR(quaternions.at(i).z, q_expected.z, epsilon);
+    EXPECT_NEAR(quaternions.at(i).w, q_expected.w, epsilon);
+  }
+
+  EXPECT_TRUE(createQuaternionFromRPY({}, {}, {}).empty());
+  EXPECT_THROW(createQuaternionFromRPY({0.0}, {0.0}, {}), std::invalid_argument);
+}
+
+TEST(geometry, createQuaternionFromYaw_batch)
+{
+  using tier4_autoware_utils::createQuaternionFromYaw;
+  using tier4_autoware_utils::deg2rad;
+
+  std::vector<double> yaws;
+  for (int i = -72; i <= 72; ++i) {
+    yaws.push_back(deg2rad(5.0 * i));
+  }
+
+  const auto quaternions = createQuaternionFromYaw(yaws);
+  ASSERT_EQ(quaternions.size(), yaws.size());
+  for (size_t i = 0; i < yaws.size(); ++i) {
+    const auto q_expected = createQuaternionFromYaw(yaws.at(i));
+    EXPECT_DOUBLE_EQ(quaternions.at(i).x, 0.0);
+    EXPECT_DOUBLE_EQ(quaternions.at(i).y, 0.0);
+    EXPECT_NEAR(quaternions.at(i).z, q_expected.z, epsilon);
+    EXPECT_NEAR(quaternions.at(i).w, q_expected.w, epsilon);
+  }
+
+  // exact for the yaw of 0
+  const auto q_zero = createQuaternionFromYaw(std::vector<double>{0.0}).front();
+  EXPECT_DOUBLE_EQ(q_zero.z, 0.0);
+  EXPECT_DOUBLE_EQ(q_zero.w, 1.0);
+}
+
+TEST(geometry, getYaw_batch)
+{
+  using tier4_autoware_utils::createQuaternion;
+  using tier4_autoware_utils::createQuaternionFromRPY;
+  using tier4_autoware_utils::deg2rad;
+  using tier4_autoware_utils::getYaw;
+
+  std::vector<geometry_msgs::msg::Quaternion> quaternions;
+  for (int i = -36; i <= 36; ++i) {
+    quaternions.push_back(
+      createQuaternionFromRPY(deg2rad(5.0 * i), deg2rad(2.0 * i), deg2rad(10.0 * i)));
+  }
+  // gimbal lock
+  quaternions.push_back(createQuaternionFromRPY(deg2rad(10.0), deg2rad(90.0), deg2rad(30.0)));
+  quaternions.push_back(createQuaternionFromRPY(0.0, deg2rad(-90.0), deg2rad(-60.0)));
+  // not normalized
+  quaternions.push_back(createQuaternion(0.0, 0.0, 2.0, 2.0));
+
+  const auto yaws = getYaw(quaternions);
+  ASSERT_EQ(yaws.size(), quaternions.size());
+  for (size_t i = 0; i < quaternions.size(); ++i) {
+    EXPECT_NEAR(yaws.at(i), tf2::getYaw(quaternions.at(i)), epsilon);
+  }
+}
+
 TEST(geometry, calcElevationAngle)
 {
   using tier4_autoware_utils::calcElevationAngle;
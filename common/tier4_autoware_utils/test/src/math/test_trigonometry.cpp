@@ -18,6 +18,10 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -40,3 +44,75 @@ TEST(trigonometry, cos)
         tier4_autoware_utils::cos(x * static_cast<float>(i))) < 10e-5);
   }
 }
+
+TEST(trigonometry, sinCos)
+{
+  std::vector<double> radians;
+  for (int i = -1000; i <= 1000; i++) {
+    radians.push_back(0.0123 * i);
+  }
+  // multiples of pi / 2, large angles and special values
+  for (int i = -8; i <= 8; i++) {
+    radians.push_back(tier4_autoware_utils::pi / 2.0 * i);
+  }
+  radians.push_back(1.0e4 + 0.5);
+  radians.push_back(-1.0e6 - 0.5);
+  radians.push_back(1.0e300);
+  radians.push_back(std::numeric_limits<double>::infinity());
+  radians.push_back(std::numeric_limits<double>::quiet_NaN());
+
+  std::vector<double> sin_values;
+  std::vector<double> cos_values;
+  tier4_autoware_utils::sinCos(radians, sin_values, cos_values);
+  ASSERT_EQ(sin_values.size(), radians.size());
+  ASSERT_EQ(cos_values.size(), radians.size());
+  for (size_t i = 0; i < radians.size(); i++) {
+    if (std::isnan(std::sin(radians.at(i)))) {
+      EXPECT_TRUE(std::isnan(sin_values.at(i)));
+      EXPECT_TRUE(std::isnan(cos_values.at(i)));
+      continue;
+    }
+    EXPECT_NEAR(sin_values.at(i), std::sin(radians.at(i)), 1e-15);
+    EXPECT_NEAR(cos_values.at(i), std::cos(radians.at(i)), 1e-15);
+  }
+
+  // exact for 0
+  tier4_autoware_utils::sinCos({0.0}, sin_values, cos_values);
+  EXPECT_EQ(sin_values.front(), 0.0);
+  EXPECT_EQ(cos_values.front(), 1.0);
+}
+
+TEST(trigonometry, atan2)
+{
+  std::vector<double> y;
+  std::vector<double> x;
+  for (int i = -50; i <= 50; i++) {
+    for (int j = -50; j <= 50; j++) {
+      y.push_back(0.37 * i);
+      x.push_back(0.41 * j);
+    }
+  }
+  // signed zeros, tiny and huge values, and special values
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  const std::vector<std::pair<double, double>> special_values{
+    {0.0, -0.0}, {-0.0, -0.0}, {-0.0, 1.0}, {1e-300, 1.0}, {1.0, 1e-300}, {1e300, -1e-300},
+    {inf, inf},  {-inf, 1.0},  {1.0, -inf}, {inf, -inf},   {std::nan(""), 1.0}};
+  for (const auto & [special_y, special_x] : special_values) {
+    y.push_back(special_y);
+    x.push_back(special_x);
+  }
+
+  const auto radians = tier4_autoware_utils::atan2(y, x);
+  ASSERT_EQ(radians.size(), y.size());
+  for (size_t i = 0; i < y.size(); i++) {
+    const double expected = std::atan2(y.at(i), x.at(i));
+    if (std::isnan(expected)) {
+      EXPECT_TRUE(std::isnan(radians.at(i)));
+      continue;
+    }
+    EXPECT_NEAR(radians.at(i), expected, 1e-15);
+    EXPECT_EQ(std::signbit(radians.at(i)), std::signbit(expected));
+  }
+
+  EXPECT_THROW(tier4_autoware_utils::atan2({1.0}, {}), std::invalid_argument);
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(system, ThreadPool_submit)
+{
+  tier4_autoware_utils::ThreadPool pool(2);
+  EXPECT_EQ(pool.size(), 2u);
+
+  auto future_1 = pool.submit([]() { return 1; });
+  auto future_2 = pool.submit([]() { return 2.0; });
+  EXPECT_EQ(future_1.get(), 1);
+  EXPECT_DOUBLE_EQ(future_2.get(), 2.0);
+
+  auto future_throw = pool.submit([]() -> int { throw std::runtime_error("error"); });
+  EXPECT_THROW(future_throw.get(), std::runtime_error);
+}
+
+TEST(system, ThreadPool_parallelFor)
+{
+  tier4_autoware_utils::ThreadPool pool(4);
+
+  constexpr size_t n = 1000;
+  std::vector<size_t> results(n, 0);
+  std::atomic<size_t> count{0};
+  pool.parallelFor(n, [&](const size_t i) {
+    results.at(i) = i * i;
+    ++count;
+  });
+
+  EXPECT_EQ(count.load(), n);
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(results.at(i), i * i);
+  }
+
+  EXPECT_THROW(
+    pool.parallelFor(
+      n,
+      [](const size_t i) {
+        if (i == 10) {
+          throw std::runtime_error("error");
+        }
+      }),
+    std::runtime_error);
+}
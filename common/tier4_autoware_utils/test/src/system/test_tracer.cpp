@@ -0,0 +1,152 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/system/tracer.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void nested()
+{
+  TIER4_TRACE_SCOPE("outer");
+  {
+    TIER4_TRACE_SCOPE("inner");
+  }
+}
+}  // namespace
+
+TEST(system, Tracer_disabled)
+{
+  auto & tracer = tier4_autoware_utils::Tracer::getInstance();
+  tracer.disable();
+
+  nested();
+  tracer.collect();
+  EXPECT_TRUE(tracer.getStatistics().empty());
+}
+
+TEST(system, Tracer_nestedSpans)
+{
+  auto & tracer = tier4_autoware_utils::Tracer::getInstance();
+  tier4_autoware_utils::TracerOptions options;
+  options.trace_file = "";
+  tracer.enable(options);
+
+  for (size_t i = 0; i < 10; ++i) {
+    nested();
+  }
+  tracer.collect();
+
+  const auto statistics = tracer.getStatistics();
+  ASSERT_EQ(statistics.size(), 2u);
+  for (const auto & stat : statistics) {
+    EXPECT_EQ(stat.count, 10u);
+    EXPECT_LE(stat.p50, stat.p90);
+    EXPECT_LE(stat.p90, stat.p99);
+    EXPECT_LE(stat.p99, stat.max);
+  }
+  // records are kept only for the trace file
+  EXPECT_TRUE(tracer.getRecords().empty());
+
+  tracer.disable();
+}
+
+TEST(system, Tracer_multiThread)
+{
+  auto & tracer = tier4_autoware_utils::Tracer::getInstance();
+  tier4_autoware_utils::TracerOptions options;
+  options.trace_file = "/tmp/test_tier4_autoware_utils_tracer.json";
+  tracer.enable(options);
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([]() {
+      for (size_t j = 0; j < 100; ++j) {
+        nested();
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  tracer.collect();
+
+  const auto records = tracer.getRecords();
+  ASSERT_EQ(records.size(), 800u);
+  for (const auto & record : records) {
+    EXPECT_LE(record.begin_ns, record.end_ns);
+    EXPECT_EQ(record.depth, std::string(record.name) == "outer" ? 0u : 1u);
+  }
+  EXPECT_EQ(tracer.getDroppedCount(), 0u);
+
+  const auto json = tier4_autoware_utils::Tracer::toChromeTraceJson(records);
+  EXPECT_NE(json.find("\"name\":\"inner\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+
+  tracer.disable();
+}
+
+TEST(system, Tracer_maxRecords)
+{
+  auto & tracer = tier4_autoware_utils::Tracer::getInstance();
+  tier4_autoware_utils::TracerOptions options;
+  options.trace_file = "/tmp/test_tier4_autoware_utils_tracer_max_records.json";
+  options.max_records = 50;
+  tracer.enable(options);
+
+  for (size_t i = 0; i < 100; ++i) {
+    nested();
+  }
+  tracer.collect();
+
+  // the latest spans are kept
+  EXPECT_EQ(tracer.getRecords().size(), 50u);
+  EXPECT_EQ(tracer.getDiscardedCount(), 150u);
+  for (const auto & stat : tracer.getStatistics()) {
+    EXPECT_EQ(stat.count, 100u);
+  }
+
+  tracer.disable();
+}
+
+TEST(system, Tracer_processTraceFilePath)
+{
+  using tier4_autoware_utils::Tracer;
+  const auto pid = std::to_string(getpid());
+  EXPECT_EQ(Tracer::getProcessTraceFilePath("/tmp/trace.json"), "/tmp/trace." + pid + ".json");
+  EXPECT_EQ(Tracer::getProcessTraceFilePath("trace.json"), "trace." + pid + ".json");
+  EXPECT_EQ(Tracer::getProcessTraceFilePath("/tmp.d/trace"), "/tmp.d/trace." + pid);
+  EXPECT_EQ(Tracer::getProcessTraceFilePath("/tmp/.trace"), "/tmp/.trace." + pid);
+}
+
+TEST(system, SpanBuffer_overflow)
+{
+  tier4_autoware_utils::SpanBuffer buffer(0, 4);
+  tier4_autoware_utils::SpanRecord record;
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_TRUE(buffer.push(record));
+  }
+  EXPECT_FALSE(buffer.push(record));
+  EXPECT_EQ(buffer.droppedCount(), 1u);
+
+  std::vector<tier4_autoware_utils::SpanRecord> records;
+  EXPECT_EQ(buffer.drain(records), 4u);
+  EXPECT_TRUE(buffer.push(record));
+}
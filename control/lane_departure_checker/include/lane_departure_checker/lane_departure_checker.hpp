@@ -51,11 +51,15 @@ using autoware_auto_planning_msgs::msg::PathWithLaneId;
 using autoware_auto_planning_msgs::msg::Trajectory;
 using autoware_auto_planning_msgs::msg::TrajectoryPoint;
 using autoware_planning_msgs::msg::LaneletRoute;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::PoseDeviation;
 using tier4_autoware_utils::Segment2d;
 using TrajectoryPoints = std::vector<TrajectoryPoint>;
 typedef boost::geometry::index::rtree<Segment2d, boost::geometry::index::rstar<16>> SegmentRtree;
+// bounding box of the lanelet polygon and its index
+typedef boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>
+  LaneletRtree;
 
 struct Param
 {
@@ -121,11 +125,12 @@ public:
   std::vector<std::pair<double, lanelet::Lanelet>> getLaneletsFromPath(
     const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const;
 
+  // NOTE: The fused polygon is cached in the instance, so this is not const.
   std::optional<lanelet::BasicPolygon2d> getFusedLaneletPolygonForPath(
-    const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const;
+    const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path);
 
   bool checkPathWillLeaveLane(
-    const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const;
+    const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path);
 
   PathWithLaneId cropPointsOutsideOfLanes(
     const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path,
@@ -138,6 +143,49 @@ private:
   Param param_;
   std::shared_ptr<vehicle_info_util::VehicleInfo> vehicle_info_ptr_;
 
+  // NOTE: The following caches are internal states, so each thread should have its own instance.
+  // polygons of the route and shoulder lanelets, which are rebuilt only when the lanelets change
+  struct RouteLaneletsCache
+  {
+    std::weak_ptr<const lanelet::LaneletMap> lanelet_map{};
+    std::vector<lanelet::Id> lanelet_ids{};
+    lanelet::ConstLanelets lanelets{};
+    std::vector<lanelet::BasicPolygon2d> polygons{};
+    LaneletRtree rtree{};
+  };
+  RouteLaneletsCache route_lanelets_cache_{};
+
+  // segments of the uncrossable boundaries in the whole map, which are rebuilt only when the map
+  // or the boundary types change
+  struct UncrossableBoundariesCache
+  {
+    std::weak_ptr<const lanelet::LaneletMap> lanelet_map{};
+    std::vector<std::string> boundary_types{};
+    SegmentRtree rtree{};
+  };
+  UncrossableBoundariesCache uncrossable_boundaries_cache_{};
+
+  // lanelets fused so far and the fused polygon, which is reused when the lanelets of the next path
+  // start with the same ones
+  struct FusedLaneletPolygonCache
+  {
+    std::weak_ptr<const lanelet::LaneletMap> lanelet_map{};
+    std::vector<lanelet::Id> lanelet_ids{};
+    lanelet::BasicPolygon2d polygon{};
+  };
+  FusedLaneletPolygonCache fused_lanelet_polygon_cache_{};
+
+  void updateRouteLaneletsCache(const Input & input);
+
+  void updateUncrossableBoundariesCache(const Input & input);
+
+  lanelet::ConstLanelets getCandidateLanelets(
+    const std::vector<LinearRing2d> & vehicle_footprints) const;
+
+  bool isOutOfLane(const LinearRing2d & vehicle_footprint) const;
+
+  bool willLeaveLane(const std::vector<LinearRing2d> & vehicle_footprints) const;
+
   static PoseDeviation calcTrajectoryDeviation(
     const Trajectory & trajectory, const geometry_msgs::msg::Pose & pose,
     const double dist_threshold, const double yaw_threshold);
@@ -162,12 +210,12 @@ private:
   double calcMaxSearchLengthForBoundaries(const Trajectory & trajectory) const;
 
   static SegmentRtree extractUncrossableBoundaries(
-    const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-    const double max_search_length, const std::vector<std::string> & boundary_types_to_detect);
+    const lanelet::LaneletMap & lanelet_map,
+    const std::vector<std::string> & boundary_types_to_detect);
 
   static bool willCrossBoundary(
-    const std::vector<LinearRing2d> & vehicle_footprints,
-    const SegmentRtree & uncrossable_segments);
+    const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+    const geometry_msgs::msg::Point & ego_point, const double max_search_length);
 };
 }  // namespace lane_departure_checker
 
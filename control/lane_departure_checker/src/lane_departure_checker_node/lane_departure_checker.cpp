@@ -28,9 +28,12 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <string>
+#include <utility>
 #include <vector>
 
 using motion_utils::calcArcLength;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::LineString2d;
 using tier4_autoware_utils::MultiPoint2d;
@@ -94,6 +97,14 @@ lanelet::ConstLanelets getCandidateLanelets(
   return candidate_lanelets;
 }
 
+template <class Lanelets>
+void appendLaneletIds(const Lanelets & lanelets, std::vector<lanelet::Id> & lanelet_ids)
+{
+  for (const auto & lanelet : lanelets) {
+    lanelet_ids.push_back(lanelet.id());
+  }
+}
+
 }  // namespace
 
 namespace lane_departure_checker
@@ -129,34 +140,141 @@ Output LaneDepartureChecker::update(const Input & input)
   output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  const auto candidate_road_lanelets =
-    getCandidateLanelets(input.route_lanelets, output.vehicle_footprints);
-  const auto candidate_shoulder_lanelets =
-    getCandidateLanelets(input.shoulder_lanelets, output.vehicle_footprints);
-  output.candidate_lanelets = candidate_road_lanelets;
-  output.candidate_lanelets.insert(
-    output.candidate_lanelets.end(), candidate_shoulder_lanelets.begin(),
-    candidate_shoulder_lanelets.end());
+  updateRouteLaneletsCache(input);
+  output.processing_time_map["updateRouteLaneletsCache"] = stop_watch.toc(true);
 
+  output.candidate_lanelets = getCandidateLanelets(output.vehicle_footprints);
   output.processing_time_map["getCandidateLanelets"] = stop_watch.toc(true);
 
-  output.will_leave_lane = willLeaveLane(output.candidate_lanelets, output.vehicle_footprints);
+  output.will_leave_lane = willLeaveLane(output.vehicle_footprints);
   output.processing_time_map["willLeaveLane"] = stop_watch.toc(true);
 
-  output.is_out_of_lane = isOutOfLane(output.candidate_lanelets, output.vehicle_footprints.front());
+  output.is_out_of_lane = isOutOfLane(output.vehicle_footprints.front());
   output.processing_time_map["isOutOfLane"] = stop_watch.toc(true);
 
+  updateUncrossableBoundariesCache(input);
   const double max_search_length_for_boundaries =
     calcMaxSearchLengthForBoundaries(*input.predicted_trajectory);
-  const auto uncrossable_boundaries = extractUncrossableBoundaries(
-    *input.lanelet_map, input.predicted_trajectory->points.front().pose.position,
-    max_search_length_for_boundaries, input.boundary_types_to_detect);
-  output.will_cross_boundary = willCrossBoundary(output.vehicle_footprints, uncrossable_boundaries);
+  output.will_cross_boundary = willCrossBoundary(
+    output.vehicle_footprints, uncrossable_boundaries_cache_.rtree,
+    input.predicted_trajectory->points.front().pose.position, max_search_length_for_boundaries);
   output.processing_time_map["willCrossBoundary"] = stop_watch.toc(true);
 
   return output;
 }
 
+void LaneDepartureChecker::updateRouteLaneletsCache(const Input & input)
+{
+  auto & cache = route_lanelets_cache_;
+
+  std::vector<lanelet::Id> lanelet_ids;
+  lanelet_ids.reserve(input.route_lanelets.size() + input.shoulder_lanelets.size());
+  appendLaneletIds(input.route_lanelets, lanelet_ids);
+  appendLaneletIds(input.shoulder_lanelets, lanelet_ids);
+  if (cache.lanelet_map.lock() == input.lanelet_map && cache.lanelet_ids == lanelet_ids) {
+    return;
+  }
+
+  // the road lanelets come first and the shoulder lanelets follow, which is the order of the
+  // candidate lanelets
+  cache.lanelet_map = input.lanelet_map;
+  cache.lanelet_ids = std::move(lanelet_ids);
+  cache.lanelets = input.route_lanelets;
+  cache.lanelets.insert(
+    cache.lanelets.end(), input.shoulder_lanelets.begin(), input.shoulder_lanelets.end());
+  cache.polygons.clear();
+  cache.polygons.reserve(cache.lanelets.size());
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(cache.lanelets.size());
+  for (size_t i = 0; i < cache.lanelets.size(); ++i) {
+    cache.polygons.push_back(cache.lanelets.at(i).polygon2d().basicPolygon());
+    Box2d box;
+    boost::geometry::envelope(cache.polygons.back(), box);
+    boxes.emplace_back(box, i);
+  }
+  cache.rtree = LaneletRtree(boxes);
+}
+
+void LaneDepartureChecker::updateUncrossableBoundariesCache(const Input & input)
+{
+  auto & cache = uncrossable_boundaries_cache_;
+  if (
+    cache.lanelet_map.lock() == input.lanelet_map &&
+    cache.boundary_types == input.boundary_types_to_detect) {
+    return;
+  }
+
+  cache.lanelet_map = input.lanelet_map;
+  cache.boundary_types = input.boundary_types_to_detect;
+  cache.rtree = extractUncrossableBoundaries(*input.lanelet_map, input.boundary_types_to_detect);
+}
+
+lanelet::ConstLanelets LaneDepartureChecker::getCandidateLanelets(
+  const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  const auto & cache = route_lanelets_cache_;
+
+  // Find lanes within the convex hull of footprints
+  const auto footprint_hull = createHullFromFootprints(vehicle_footprints);
+  Box2d footprint_hull_box;
+  boost::geometry::envelope(footprint_hull, footprint_hull_box);
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  cache.rtree.query(
+    boost::geometry::index::intersects(footprint_hull_box), std::back_inserter(boxes));
+
+  std::vector<size_t> candidate_indices;
+  for (const auto & box : boxes) {
+    if (!boost::geometry::disjoint(cache.polygons.at(box.second), footprint_hull)) {
+      candidate_indices.push_back(box.second);
+    }
+  }
+  // keep the order of the route lanelets
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
+  lanelet::ConstLanelets candidate_lanelets;
+  candidate_lanelets.reserve(candidate_indices.size());
+  for (const auto idx : candidate_indices) {
+    candidate_lanelets.push_back(cache.lanelets.at(idx));
+  }
+  return candidate_lanelets;
+}
+
+bool LaneDepartureChecker::isOutOfLane(const LinearRing2d & vehicle_footprint) const
+{
+  // NOTE: A lanelet containing a point of the footprint always intersects the convex hull of the
+  // footprints, so checking all the route lanelets gives the same result as checking only the
+  // candidate lanelets.
+  const auto & cache = route_lanelets_cache_;
+  const auto is_in_any_lane = [&](const Point2d & point) {
+    for (auto itr = cache.rtree.qbegin(boost::geometry::index::intersects(point));
+         itr != cache.rtree.qend(); ++itr) {
+      if (boost::geometry::within(point, cache.polygons.at(itr->second))) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (const auto & point : vehicle_footprint) {
+    if (!is_in_any_lane(point)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool LaneDepartureChecker::willLeaveLane(const std::vector<LinearRing2d> & vehicle_footprints) const
+{
+  for (const auto & vehicle_footprint : vehicle_footprints) {
+    if (isOutOfLane(vehicle_footprint)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool LaneDepartureChecker::checkPathWillLeaveLane(
   const lanelet::ConstLanelets & lanelets, const PathWithLaneId & path) const
 {
@@ -322,39 +440,48 @@ std::vector<std::pair<double, lanelet::Lanelet>> LaneDepartureChecker::getLanele
 }
 
 std::optional<lanelet::BasicPolygon2d> LaneDepartureChecker::getFusedLaneletPolygonForPath(
-  const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const
+  const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path)
 {
   const auto lanelets_distance_pair = getLaneletsFromPath(lanelet_map_ptr, path);
+  if (lanelets_distance_pair.empty()) return std::nullopt;
+
+  // The lanelets are fused one by one, so the fused polygon of the previous path is reused when
+  // its lanelets are the first ones of this path, e.g. for the candidate paths of the same lanes.
+  auto & cache = fused_lanelet_polygon_cache_;
+  const bool is_cache_reusable =
+    cache.lanelet_map.lock() == lanelet_map_ptr && !cache.lanelet_ids.empty() &&
+    cache.lanelet_ids.size() <= lanelets_distance_pair.size() &&
+    std::equal(
+      cache.lanelet_ids.begin(), cache.lanelet_ids.end(), lanelets_distance_pair.begin(),
+      [](const auto & id, const auto & pair) { return id == pair.second.id(); });
+  if (!is_cache_reusable) {
+    cache.lanelet_map = lanelet_map_ptr;
+    cache.lanelet_ids = {lanelets_distance_pair.front().second.id()};
+    cache.polygon = lanelets_distance_pair.front().second.polygon2d().basicPolygon();
+  }
+
   // Fuse lanelets into a single BasicPolygon2d
-  auto fused_lanelets = [&lanelets_distance_pair]() -> std::optional<lanelet::BasicPolygon2d> {
-    if (lanelets_distance_pair.empty()) return std::nullopt;
-    if (lanelets_distance_pair.size() == 1)
-      return lanelets_distance_pair.at(0).second.polygon2d().basicPolygon();
-
-    lanelet::BasicPolygon2d merged_polygon =
-      lanelets_distance_pair.at(0).second.polygon2d().basicPolygon();
-    for (size_t i = 1; i < lanelets_distance_pair.size(); ++i) {
-      const auto & route_lanelet = lanelets_distance_pair.at(i).second;
-      const auto & poly = route_lanelet.polygon2d().basicPolygon();
-
-      std::vector<lanelet::BasicPolygon2d> lanelet_union_temp;
-      boost::geometry::union_(poly, merged_polygon, lanelet_union_temp);
-
-      // Update merged_polygon by accumulating all merged results
-      merged_polygon.clear();
-      for (const auto & temp_poly : lanelet_union_temp) {
-        merged_polygon.insert(merged_polygon.end(), temp_poly.begin(), temp_poly.end());
-      }
+  for (size_t i = cache.lanelet_ids.size(); i < lanelets_distance_pair.size(); ++i) {
+    const auto & route_lanelet = lanelets_distance_pair.at(i).second;
+    const auto & poly = route_lanelet.polygon2d().basicPolygon();
+
+    std::vector<lanelet::BasicPolygon2d> lanelet_union_temp;
+    boost::geometry::union_(poly, cache.polygon, lanelet_union_temp);
+
+    // Update the fused polygon by accumulating all merged results
+    cache.polygon.clear();
+    for (const auto & temp_poly : lanelet_union_temp) {
+      cache.polygon.insert(cache.polygon.end(), temp_poly.begin(), temp_poly.end());
     }
-    if (merged_polygon.empty()) return std::nullopt;
-    return merged_polygon;
-  }();
+    cache.lanelet_ids.push_back(route_lanelet.id());
+  }
 
-  return fused_lanelets;
+  if (cache.polygon.empty()) return std::nullopt;
+  return cache.polygon;
 }
 
 bool LaneDepartureChecker::checkPathWillLeaveLane(
-  const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path) const
+  const lanelet::LaneletMapPtr lanelet_map_ptr, const PathWithLaneId & path)
 {
   // check if the footprint is not fully contained within the fused lanelets polygon
   const std::vector<LinearRing2d> vehicle_footprints = createVehicleFootprints(path);
@@ -411,8 +538,8 @@ double LaneDepartureChecker::calcMaxSearchLengthForBoundaries(const Trajectory &
 }
 
 SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
-  const lanelet::LaneletMap & lanelet_map, const geometry_msgs::msg::Point & ego_point,
-  const double max_search_length, const std::vector<std::string> & boundary_types_to_detect)
+  const lanelet::LaneletMap & lanelet_map,
+  const std::vector<std::string> & boundary_types_to_detect)
 {
   const auto has_types =
     [](const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types) {
@@ -421,33 +548,33 @@ SegmentRtree LaneDepartureChecker::extractUncrossableBoundaries(
       return (type != no_type && std::find(types.begin(), types.end(), type) != types.end());
     };
 
-  SegmentRtree uncrossable_segments_in_range;
+  // NOTE: The segments are extracted from the whole map once and packed into the R-tree, and the
+  // ones out of the search range are skipped in willCrossBoundary.
+  std::vector<Segment2d> uncrossable_segments;
   LineString2d line;
-  const auto ego_p = Point2d{ego_point.x, ego_point.y};
   for (const auto & ls : lanelet_map.lineStringLayer) {
     if (has_types(ls, boundary_types_to_detect)) {
       line.clear();
       for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
       for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx) {
-        const Segment2d segment = {line[segment_idx], line[segment_idx + 1]};
-        if (boost::geometry::distance(segment, ego_p) < max_search_length) {
-          uncrossable_segments_in_range.insert(segment);
-        }
+        uncrossable_segments.push_back({line[segment_idx], line[segment_idx + 1]});
       }
     }
   }
-  return uncrossable_segments_in_range;
+  return SegmentRtree(uncrossable_segments);
 }
 
 bool LaneDepartureChecker::willCrossBoundary(
-  const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments)
+  const std::vector<LinearRing2d> & vehicle_footprints, const SegmentRtree & uncrossable_segments,
+  const geometry_msgs::msg::Point & ego_point, const double max_search_length)
 {
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
   for (const auto & footprint : vehicle_footprints) {
-    std::vector<Segment2d> intersection_result;
-    uncrossable_segments.query(
-      boost::geometry::index::intersects(footprint), std::back_inserter(intersection_result));
-    if (!intersection_result.empty()) {
-      return true;
+    for (auto itr = uncrossable_segments.qbegin(boost::geometry::index::intersects(footprint));
+         itr != uncrossable_segments.qend(); ++itr) {
+      if (boost::geometry::distance(*itr, ego_p) < max_search_length) {
+        return true;
+      }
     }
   }
   return false;
@@ -0,0 +1,326 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lane_departure_checker/lane_departure_checker.hpp"
+
+#include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using lane_departure_checker::Input;
+using lane_departure_checker::LaneDepartureChecker;
+using lane_departure_checker::Output;
+using lane_departure_checker::Param;
+using tier4_autoware_utils::LinearRing2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Segment2d;
+
+namespace
+{
+constexpr int num_rows = 5;
+constexpr int num_cols = 10;
+constexpr double lanelet_length = 10.0;
+constexpr double lanelet_width = 4.0;
+const std::vector<std::string> boundary_types_to_detect{"road_border"};
+
+vehicle_info_util::VehicleInfo createVehicleInfo()
+{
+  return vehicle_info_util::createVehicleInfo(
+    0.39, 0.42, 2.74, 1.63, 1.0, 1.03, 0.1, 0.1, 2.5, 0.7);
+}
+
+Param createParam()
+{
+  Param param{};
+  param.footprint_margin_scale = 1.0;
+  param.resample_interval = 0.3;
+  param.max_deceleration = 2.8;
+  param.delay_time = 1.3;
+  param.min_braking_distance = 0.0;
+  param.ego_nearest_dist_threshold = 100.0;
+  param.ego_nearest_yaw_threshold = M_PI;
+  return param;
+}
+
+// lanelets on a grid with gaps, whose corners are shifted randomly so that the lanelets overlap or
+// are apart from each other. some of the bounds are road borders.
+lanelet::Lanelets createRandomLanelets(std::mt19937 & engine)
+{
+  std::uniform_real_distribution<double> jitter_dist(-0.4, 0.4);
+  std::bernoulli_distribution exist_dist(0.8);
+  std::bernoulli_distribution border_dist(0.3);
+
+  const auto create_point = [&](const double x, const double y) {
+    return lanelet::Point3d(
+      lanelet::utils::getId(), x + jitter_dist(engine), y + jitter_dist(engine));
+  };
+  const auto create_bound = [&](const double x, const double y) {
+    lanelet::LineString3d bound(
+      lanelet::utils::getId(), {create_point(x, y), create_point(x + lanelet_length, y)});
+    if (border_dist(engine)) {
+      bound.attributes()[lanelet::AttributeName::Type] = boundary_types_to_detect.front();
+    }
+    return bound;
+  };
+
+  lanelet::Lanelets lanelets;
+  for (int r = 0; r < num_rows; ++r) {
+    for (int c = 0; c < num_cols; ++c) {
+      if (!exist_dist(engine)) {
+        continue;
+      }
+      const double x = lanelet_length * c;
+      const double y = lanelet_width * r;
+      lanelets.emplace_back(
+        lanelet::utils::getId(), create_bound(x, y + lanelet_width), create_bound(x, y));
+    }
+  }
+  return lanelets;
+}
+
+Input createRandomInput(
+  std::mt19937 & engine, const lanelet::LaneletMapPtr & lanelet_map,
+  const lanelet::Lanelets & lanelets)
+{
+  std::uniform_real_distribution<double> x_dist(0.0, lanelet_length * num_cols);
+  std::uniform_real_distribution<double> y_dist(0.0, lanelet_width * num_rows);
+  std::uniform_real_distribution<double> yaw_dist(-0.5, 0.5);
+  std::uniform_real_distribution<double> velocity_dist(0.0, 10.0);
+  std::uniform_int_distribution<int> lane_type_dist(0, 2);
+  std::uniform_int_distribution<size_t> lanelet_idx_dist(0, lanelets.size() - 1);
+  std::bernoulli_distribution on_lanelet_dist(0.5);
+
+  Input input{};
+  input.lanelet_map = lanelet_map;
+  input.boundary_types_to_detect = boundary_types_to_detect;
+  for (const auto & lanelet : lanelets) {
+    const int lane_type = lane_type_dist(engine);
+    if (lane_type == 0) {
+      input.route_lanelets.push_back(lanelet);
+    } else if (lane_type == 1) {
+      input.shoulder_lanelets.push_back(lanelet);
+    }
+  }
+
+  // a straight trajectory from the ego, which is at a random position, or at the rear of a lanelet
+  // and stops soon
+  auto odom = std::make_shared<nav_msgs::msg::Odometry>();
+  if (on_lanelet_dist(engine)) {
+    const auto & lanelet = lanelets.at(lanelet_idx_dist(engine));
+    const auto & left = lanelet.leftBound();
+    const auto & right = lanelet.rightBound();
+    odom->pose.pose.position.x = (left.front().x() + right.front().x()) / 2.0 + 2.0;
+    odom->pose.pose.position.y =
+      (left.front().y() + left.back().y() + right.front().y() + right.back().y()) / 4.0;
+    odom->pose.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(0.0);
+    odom->twist.twist.linear.x = 0.5 * velocity_dist(engine) / 10.0;
+  } else {
+    odom->pose.pose.position.x = x_dist(engine);
+    odom->pose.pose.position.y = y_dist(engine);
+    odom->pose.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw_dist(engine));
+    odom->twist.twist.linear.x = velocity_dist(engine);
+  }
+
+  auto trajectory = std::make_shared<autoware_auto_planning_msgs::msg::Trajectory>();
+  for (int i = 0; i < 60; ++i) {
+    autoware_auto_planning_msgs::msg::TrajectoryPoint p;
+    p.pose = tier4_autoware_utils::calcOffsetPose(odom->pose.pose, 0.5 * i, 0.0, 0.0);
+    trajectory->points.push_back(p);
+  }
+  input.current_odom = odom;
+  input.reference_trajectory = trajectory;
+  input.predicted_trajectory = trajectory;
+  return input;
+}
+
+// the candidate lanelets of the linear scan over the route and the shoulder lanelets
+lanelet::ConstLanelets getCandidateLanelets(
+  const Input & input, const std::vector<LinearRing2d> & vehicle_footprints)
+{
+  tier4_autoware_utils::MultiPoint2d points;
+  for (const auto & footprint : vehicle_footprints) {
+    points.insert(points.end(), footprint.begin(), footprint.end());
+  }
+  LinearRing2d footprint_hull;
+  boost::geometry::convex_hull(points, footprint_hull);
+
+  lanelet::ConstLanelets candidate_lanelets;
+  for (const auto & lanelets : {input.route_lanelets, input.shoulder_lanelets}) {
+    for (const auto & lanelet : lanelets) {
+      if (!boost::geometry::disjoint(lanelet.polygon2d().basicPolygon(), footprint_hull)) {
+        candidate_lanelets.push_back(lanelet);
+      }
+    }
+  }
+  return candidate_lanelets;
+}
+
+// the linear scan over all the segments of the uncrossable boundaries in the search range
+bool willCrossBoundary(
+  const Input & input, const std::vector<LinearRing2d> & vehicle_footprints,
+  const vehicle_info_util::VehicleInfo & vehicle_info)
+{
+  const double max_search_length =
+    motion_utils::calcArcLength(input.predicted_trajectory->points) +
+    std::hypot(
+      std::max(
+        std::abs(vehicle_info.max_longitudinal_offset_m),
+        std::abs(vehicle_info.min_longitudinal_offset_m)),
+      std::max(
+        std::abs(vehicle_info.max_lateral_offset_m), std::abs(vehicle_info.min_lateral_offset_m)));
+  const auto & ego_position = input.predicted_trajectory->points.front().pose.position;
+  const Point2d ego_point{ego_position.x, ego_position.y};
+
+  for (const auto & ls : input.lanelet_map->lineStringLayer) {
+    const std::string type = ls.attributeOr(lanelet::AttributeName::Type, "");
+    if (type != boundary_types_to_detect.front()) {
+      continue;
+    }
+    for (size_t i = 0; i + 1 < ls.size(); ++i) {
+      const Segment2d segment{
+        Point2d{ls[i].x(), ls[i].y()}, Point2d{ls[i + 1].x(), ls[i + 1].y()}};
+      if (boost::geometry::distance(segment, ego_point) >= max_search_length) {
+        continue;
+      }
+      for (const auto & footprint : vehicle_footprints) {
+        if (boost::geometry::intersects(segment, footprint)) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+std::vector<lanelet::Id> toIds(const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<lanelet::Id> ids;
+  for (const auto & lanelet : lanelets) {
+    ids.push_back(lanelet.id());
+  }
+  return ids;
+}
+
+autoware_auto_planning_msgs::msg::PathWithLaneId createStraightPath(
+  const double y, const double length)
+{
+  autoware_auto_planning_msgs::msg::PathWithLaneId path;
+  for (double x = 1.0; x <= length; x += 1.0) {
+    autoware_auto_planning_msgs::msg::PathPointWithLaneId p;
+    p.point.pose.position.x = x;
+    p.point.pose.position.y = y;
+    p.point.pose.orientation.w = 1.0;
+    path.points.push_back(p);
+  }
+  return path;
+}
+}  // namespace
+
+TEST(LaneDepartureChecker, updateSameAsLinearScan)
+{
+  std::mt19937 engine(0);
+  const auto vehicle_info = createVehicleInfo();
+
+  // the same checker is used for all the trials, so the R-trees are rebuilt when the map or the
+  // route lanelets change and are reused otherwise
+  LaneDepartureChecker checker;
+  checker.setParam(createParam(), vehicle_info);
+
+  size_t num_leave_lane = 0;
+  size_t num_cross_boundary = 0;
+  for (int map_trial = 0; map_trial < 5; ++map_trial) {
+    const auto lanelets = createRandomLanelets(engine);
+    const lanelet::LaneletMapPtr lanelet_map = lanelet::utils::createMap(lanelets);
+    for (int trial = 0; trial < 20; ++trial) {
+      const auto input = createRandomInput(engine, lanelet_map, lanelets);
+      for (int repeat = 0; repeat < 2; ++repeat) {
+        const auto output = checker.update(input);
+        ASSERT_FALSE(output.vehicle_footprints.empty());
+
+        const auto candidate_lanelets = getCandidateLanelets(input, output.vehicle_footprints);
+        EXPECT_EQ(toIds(output.candidate_lanelets), toIds(candidate_lanelets));
+
+        bool will_leave_lane = false;
+        for (const auto & footprint : output.vehicle_footprints) {
+          will_leave_lane |= LaneDepartureChecker::isOutOfLane(candidate_lanelets, footprint);
+        }
+        EXPECT_EQ(output.will_leave_lane, will_leave_lane);
+        EXPECT_EQ(
+          output.is_out_of_lane,
+          LaneDepartureChecker::isOutOfLane(
+            candidate_lanelets, output.vehicle_footprints.front()));
+
+        const bool will_cross_boundary =
+          willCrossBoundary(input, output.vehicle_footprints, vehicle_info);
+        EXPECT_EQ(output.will_cross_boundary, will_cross_boundary);
+
+        num_leave_lane += will_leave_lane ? 1 : 0;
+        num_cross_boundary += will_cross_boundary ? 1 : 0;
+      }
+    }
+  }
+
+  // both results appear in the random inputs
+  EXPECT_GT(num_leave_lane, 0u);
+  EXPECT_LT(num_leave_lane, 200u);
+  EXPECT_GT(num_cross_boundary, 0u);
+  EXPECT_LT(num_cross_boundary, 200u);
+}
+
+TEST(LaneDepartureChecker, fusedLaneletPolygonSameAsWithoutCache)
+{
+  std::mt19937 engine(1);
+  const auto vehicle_info = createVehicleInfo();
+  const auto lanelets = createRandomLanelets(engine);
+  const lanelet::LaneletMapPtr lanelet_map = lanelet::utils::createMap(lanelets);
+
+  LaneDepartureChecker checker;
+  checker.setVehicleInfo(vehicle_info);
+
+  // the paths share their first lanelets, so the fused polygon of the previous path is reused
+  std::uniform_real_distribution<double> y_dist(0.0, lanelet_width * num_rows);
+  std::uniform_real_distribution<double> length_dist(5.0, lanelet_length * num_cols);
+  for (int trial = 0; trial < 30; ++trial) {
+    const auto path = createStraightPath(trial < 15 ? 2.0 : y_dist(engine), length_dist(engine));
+
+    LaneDepartureChecker checker_without_cache;
+    checker_without_cache.setVehicleInfo(vehicle_info);
+    const auto expected = checker_without_cache.getFusedLaneletPolygonForPath(lanelet_map, path);
+    const auto polygon = checker.getFusedLaneletPolygonForPath(lanelet_map, path);
+    ASSERT_EQ(polygon.has_value(), expected.has_value());
+    if (expected) {
+      EXPECT_NEAR(boost::geometry::area(*polygon), boost::geometry::area(*expected), 1e-6);
+    }
+    EXPECT_EQ(
+      checker.checkPathWillLeaveLane(lanelet_map, path),
+      checker_without_cache.checkPathWillLeaveLane(lanelet_map, path));
+  }
+}
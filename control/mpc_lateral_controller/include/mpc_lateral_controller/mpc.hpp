@@ -15,6 +15,7 @@
 #ifndef MPC_LATERAL_CONTROLLER__MPC_HPP_
 #define MPC_LATERAL_CONTROLLER__MPC_HPP_
 
+#include "interpolation/linear_interpolation.hpp"
 #include "mpc_lateral_controller/lowpass_filter.hpp"
 #include "mpc_lateral_controller/mpc_trajectory.hpp"
 #include "mpc_lateral_controller/qp_solver/qp_solver_interface.hpp"
@@ -120,6 +121,10 @@ struct MPCParam
 
   // Curvature threshold to determine when to use "low curvature" parameter settings.
   double low_curvature_thresh_curvature;
+
+  // Flag to solve the problem in the sparse (non-condensed) form, which keeps the predicted states
+  // as decision variables. It is used only when the QP solver supports the sparse form.
+  bool use_sparse_formulation = false;
 };
 
 struct TrajectoryFilteringParam
@@ -174,6 +179,11 @@ struct MPCData
  * Xex = Aex * X0 + Bex * Uex * Wex
  * Yex = Cex * Xex
  * Cost = Xex' * Qex * Xex + (Uex - Uref_ex)' * R1ex * (Uex - Uref_ex) +  Uex' * R2ex * Uex
+ *
+ * In the sparse formulation, the condensed matrices (Aex, Bex, Wex, Cex, Qex) are not generated
+ * and the stage-wise matrices are stored instead:
+ * x(k+1) = Ad_vec[k] * x(k) + Bd_vec[k] * u(k) + Wd_vec[k]
+ * y(k+1) = Cd_vec[k] * x(k+1)
  */
 struct MPCMatrix
 {
@@ -186,7 +196,15 @@ struct MPCMatrix
   MatrixXd R2ex;
   MatrixXd Uref_ex;
 
+  std::vector<MatrixXd> Ad_vec;
+  std::vector<MatrixXd> Bd_vec;
+  std::vector<MatrixXd> Wd_vec;
+  std::vector<MatrixXd> Cd_vec;
+  std::vector<MatrixXd> Q_vec;
+
   MPCMatrix() = default;
+
+  bool isSparse() const { return !Ad_vec.empty(); }
 };
 
 /**
@@ -221,7 +239,21 @@ private:
 
   double m_min_prediction_length = 5.0;  // Minimum prediction distance.
 
+  // Previous solution of the sparse formulation [Uex; Xex] used for warm start.
+  VectorXd m_prev_sparse_solution;
+
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_frenet_predicted_trajectory_pub;
+
+  // Buffers reused over the control cycles so that the trajectories are not reallocated for each
+  // calculation once their capacities are large enough.
+  MPCTrajectory m_filtered_reference_trajectory;   // Reference trajectory with filtered velocity.
+  MPCTrajectory m_resampled_reference_trajectory;  // Reference trajectory in MPC time steps.
+  Trajectory m_autoware_trajectory;                // Reference trajectory for the nearest search.
+  std::vector<double> m_resample_times;            // Relative times of the MPC time steps.
+  interpolation::LerpWeights m_resample_weights;   // Weights to resample at m_resample_times.
+  MPCTrajectory m_predicted_trajectory;            // Predicted trajectory in world coordinate.
+  MPCTrajectory m_clipped_predicted_trajectory;    // Predicted trajectory clipped by the length.
+
   /**
    * @brief Get variables for MPC calculation.
    * @param trajectory The reference trajectory.
@@ -273,24 +305,67 @@ private:
     const MPCMatrix & mpc_matrix, const VectorXd & x0, const double prediction_dt,
     const MPCTrajectory & trajectory, const double current_velocity);
 
+  /**
+   * @brief Execute the optimization in the sparse form, where the predicted states are kept as
+   * decision variables z = [Uex; Xex] with the dynamics as equality constraints.
+   * @param mpc_matrix The parameters matrix used for optimization.
+   * @param x0 The initial state vector.
+   * @param prediction_dt The prediction time step.
+   * @param [in] trajectory mpc reference trajectory
+   * @param [in] current_velocity current ego velocity
+   * @return A pair of a boolean flag indicating success and the optimized input vector.
+   */
+  std::pair<bool, VectorXd> executeOptimizationSparse(
+    const MPCMatrix & mpc_matrix, const VectorXd & x0, const double prediction_dt,
+    const MPCTrajectory & trajectory, const double current_velocity);
+
+  /**
+   * @brief Get the initial guess for the sparse formulation by shifting the previous solution
+   * with the control period.
+   * @param prediction_dt The prediction time step.
+   * @param dim_z The dimension of the decision variables.
+   * @return The initial guess. Empty if the previous solution is not available.
+   */
+  VectorXd getSparseWarmStartSolution(const double prediction_dt, const int dim_z) const;
+
+  /**
+   * @brief Check if the sparse formulation is used for the optimization.
+   */
+  inline bool useSparseFormulation() const
+  {
+    return m_param.use_sparse_formulation && m_qpsolver_ptr->isSparseSupported();
+  }
+
+  /**
+   * @brief Calculate the predicted states Xex from the initial state and the input.
+   * @param m The MPC matrix used for optimization.
+   * @param x0 The initial state vector.
+   * @param Uex The input vector.
+   * @return The predicted states.
+   */
+  VectorXd calcPredictedStates(
+    const MPCMatrix & m, const VectorXd & x0, const VectorXd & Uex) const;
+
   /**
    * @brief Resample the trajectory with the MPC resampling time.
    * @param start_time The start time for resampling.
    * @param prediction_dt The prediction time step.
    * @param input The input trajectory.
-   * @return A pair of a boolean flag indicating success and the resampled trajectory.
+   * @param output The resampled trajectory, whose buffers are reused.
+   * @return True if the resampling is successful, false otherwise.
    */
-  std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByTime(
-    const double start_time, const double prediction_dt, const MPCTrajectory & input) const;
+  bool resampleMPCTrajectoryByTime(
+    const double start_time, const double prediction_dt, const MPCTrajectory & input,
+    MPCTrajectory & output);
 
   /**
    * @brief Apply the velocity dynamics filter to the trajectory using the current kinematics.
    * @param trajectory The input trajectory.
    * @param current_kinematics The current vehicle kinematics.
-   * @return The filtered trajectory.
+   * @param output The filtered trajectory, whose buffers are reused.
    */
-  MPCTrajectory applyVelocityDynamicsFilter(
-    const MPCTrajectory & trajectory, const Odometry & current_kinematics) const;
+  void applyVelocityDynamicsFilter(
+    const MPCTrajectory & trajectory, const Odometry & current_kinematics, MPCTrajectory & output);
 
   /**
    * @brief Get the prediction time step for MPC. If the trajectory length is shorter than
@@ -301,8 +376,7 @@ private:
    * @return The prediction time step.
    */
   double getPredictionDeltaTime(
-    const double start_time, const MPCTrajectory & input,
-    const Odometry & current_kinematics) const;
+    const double start_time, const MPCTrajectory & input, const Odometry & current_kinematics);
 
   /**
    * @brief Add weights related to lateral jerk, steering rate, and steering acceleration to the R
@@ -341,11 +415,12 @@ private:
    * @param Uex optimized input.
    * @param mpc_resampled_ref_traj reference trajectory resampled in the mpc time-step
    * @param dt delta time used in the mpc problem.
-   * @return predicted path
+   * @param predicted_trajectory predicted path, whose points are reused.
    */
-  Trajectory calculatePredictedTrajectory(
+  void calculatePredictedTrajectory(
     const MPCMatrix & mpc_matrix, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-    const MPCTrajectory & mpc_resampled_ref_traj, const double dt) const;
+    const MPCTrajectory & mpc_resampled_ref_traj, const double dt,
+    Trajectory & predicted_trajectory);
 
   /**
    * @brief Check if the MPC matrix has any invalid values.
@@ -374,12 +449,12 @@ private:
    * @param ctrl_cmd The control command.
    * @param Uex The optimized input vector.
    * @param current_kinematics The current vehicle kinematics.
-   * @return The generated diagnostic data.
+   * @param diagnostic The generated diagnostic data, whose buffer is reused.
    */
-  Float32MultiArrayStamped generateDiagData(
+  void generateDiagData(
     const MPCTrajectory & reference_trajectory, const MPCData & mpc_data,
     const MPCMatrix & mpc_matrix, const AckermannLateralCommand & ctrl_cmd, const VectorXd & Uex,
-    const Odometry & current_kinematics) const;
+    const Odometry & current_kinematics, Float32MultiArrayStamped & diagnostic) const;
 
   /**
    * @brief calculate steering rate limit along with the target trajectory
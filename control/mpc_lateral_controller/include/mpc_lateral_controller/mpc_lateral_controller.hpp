@@ -112,6 +112,10 @@ private:
 
   Trajectory m_current_trajectory;  // Current reference trajectory for path following.
 
+  // Output buffers of the MPC, which are reused over the control cycles to avoid reallocation.
+  Trajectory m_predicted_trajectory;       // Predicted trajectory based on the MPC result.
+  Float32MultiArrayStamped m_debug_values;  // Diagnostic data of the MPC.
+
   double m_steer_cmd_prev = 0.0;  // MPC output in the previous period.
 
   // Flag indicating whether the previous control command is initialized.
@@ -26,6 +26,7 @@
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #endif
 
+#include "interpolation/linear_interpolation.hpp"
 #include "mpc_lateral_controller/mpc_trajectory.hpp"
 
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
@@ -85,6 +86,14 @@ MPCTrajectory convertToMPCTrajectory(const Trajectory & input);
  */
 Trajectory convertToAutowareTrajectory(const MPCTrajectory & input);
 
+/**
+ * @brief convert the given MPCTrajectory to a Trajectory msg reusing the points of the output, so
+ * that it does not allocate once the output has enough capacity. The header is not changed.
+ * @param [in] input MPCTrajectory to be converted
+ * @param [out] output converted Trajectory msg
+ */
+void convertToAutowareTrajectory(const MPCTrajectory & input, Trajectory & output);
+
 /**
  * @brief calculate the arc length at each point of the given trajectory
  * @param [in] trajectory trajectory for which to calculate the arc length
@@ -121,6 +130,21 @@ bool linearInterpMPCTrajectory(
   const std::vector<double> & in_index, const MPCTrajectory & in_traj,
   const std::vector<double> & out_index, MPCTrajectory & out_traj);
 
+/**
+ * @brief same as above, but the segments are searched only once for all the fields and the
+ * buffers of the weights and the output are reused, so that it does not allocate once their
+ * capacities are large enough
+ * @param [in] in_index indexes for each trajectory point
+ * @param [in] in_traj MPCTrajectory to interpolate
+ * @param [in] out_index desired interpolated indexes
+ * @param [out] out_traj resulting interpolated MPCTrajectory
+ * @param [inout] weights workspace of the interpolation weights
+ */
+bool linearInterpMPCTrajectory(
+  const std::vector<double> & in_index, const MPCTrajectory & in_traj,
+  const std::vector<double> & out_index, MPCTrajectory & out_traj,
+  interpolation::LerpWeights & weights);
+
 /**
  * @brief fill the relative_time field of the given MPCTrajectory
  * @param [in] traj MPCTrajectory for which to fill in the relative_time
@@ -209,6 +233,15 @@ void extendTrajectoryInYawDirection(
  */
 MPCTrajectory clipTrajectoryByLength(const MPCTrajectory & trajectory, const double length);
 
+/**
+ * @brief clip trajectory size by length
+ * @param [in] trajectory original trajectory
+ * @param [in] length clip length
+ * @param [out] clipped_trajectory clipped trajectory, whose capacity is reused
+ */
+void clipTrajectoryByLength(
+  const MPCTrajectory & trajectory, const double length, MPCTrajectory & clipped_trajectory);
+
 /**
  * @brief Updates the value of a parameter with the given name.
  * @tparam T The type of the parameter value.
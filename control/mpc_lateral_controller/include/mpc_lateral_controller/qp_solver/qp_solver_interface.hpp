@@ -16,6 +16,7 @@
 #define MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_INTERFACE_HPP_
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 namespace autoware::motion::control::mpc_lateral_controller
 {
@@ -46,6 +47,33 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) = 0;
 
+  /**
+   * @brief solve QP problem in the sparse form : minimize j = 1/2 * z' * p * z + q' * z
+   *        subject to l < a * z < u
+   * @param [in] p upper triangular part of the hessian matrix in object function
+   * @param [in] q gradient vector in object function
+   * @param [in] a constraint matrix for l < a*z < u
+   * @param [in] l lower bound of the constraint l < a*z < u
+   * @param [in] u upper bound of the constraint l < a*z < u
+   * @param [in] z_init initial guess of the optimal variable vector for warm start (can be empty)
+   * @param [out] z optimal variable vector
+   * @return true if the problem was solved
+   */
+  virtual bool solveSparse(
+    [[maybe_unused]] const Eigen::SparseMatrix<double> & p,
+    [[maybe_unused]] const Eigen::VectorXd & q,
+    [[maybe_unused]] const Eigen::SparseMatrix<double> & a,
+    [[maybe_unused]] const Eigen::VectorXd & l, [[maybe_unused]] const Eigen::VectorXd & u,
+    [[maybe_unused]] const Eigen::VectorXd & z_init, [[maybe_unused]] Eigen::VectorXd & z)
+  {
+    return false;
+  }
+
+  /**
+   * @brief check if the solver can solve the problem in the sparse form with solveSparse()
+   */
+  virtual bool isSparseSupported() const { return false; }
+
   virtual int64_t getTakenIter() const { return 0; }
   virtual double getRunTime() const { return 0.0; }
   virtual double getObjVal() const { return 0.0; }
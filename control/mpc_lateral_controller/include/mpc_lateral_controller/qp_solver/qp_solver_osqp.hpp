@@ -19,6 +19,9 @@
 #include "osqp_interface/osqp_interface.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <tuple>
+#include <vector>
+
 namespace autoware::motion::control::mpc_lateral_controller
 {
 
@@ -53,6 +56,27 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) override;
 
+  /**
+   * @brief solve QP problem in the sparse form : minimize j = 1/2 * z' * p * z + q' * z
+   *        subject to l < a * z < u
+   * @details The OSQP workspace is kept while the sparsity patterns of p and a are unchanged, so
+   *          that only the values are updated and the previous solution is used as warm start.
+   * @param [in] p upper triangular part of the hessian matrix in object function
+   * @param [in] q gradient vector in object function
+   * @param [in] a constraint matrix for l < a*z < u
+   * @param [in] l lower bound of the constraint l < a*z < u
+   * @param [in] u upper bound of the constraint l < a*z < u
+   * @param [in] z_init initial guess of the optimal variable vector for warm start (can be empty)
+   * @param [out] z optimal variable vector
+   * @return true if the problem was solved
+   */
+  bool solveSparse(
+    const Eigen::SparseMatrix<double> & p, const Eigen::VectorXd & q,
+    const Eigen::SparseMatrix<double> & a, const Eigen::VectorXd & l, const Eigen::VectorXd & u,
+    const Eigen::VectorXd & z_init, Eigen::VectorXd & z) override;
+
+  bool isSparseSupported() const override { return true; }
+
   int64_t getTakenIter() const override { return osqpsolver_.getTakenIter(); }
   double getRunTime() const override { return osqpsolver_.getRunTime(); }
   double getObjVal() const override { return osqpsolver_.getObjVal(); }
@@ -60,6 +84,20 @@ public:
 private:
   autoware::common::osqp::OSQPInterface osqpsolver_;
   rclcpp::Logger logger_;
+
+  // sparsity pattern of the problem set up in the workspace by solveSparse()
+  autoware::common::osqp::CSC_Matrix prev_p_csc_;
+  autoware::common::osqp::CSC_Matrix prev_a_csc_;
+  bool is_sparse_workspace_initialized_ = false;
+
+  /**
+   * @brief check the solver result and log the reason of the failure
+   * @param [in] result result of the osqp solver
+   * @return true if the problem was solved
+   */
+  bool checkResult(
+    const std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> & result)
+    const;
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_HPP_
@@ -87,15 +87,17 @@ public:
 
   std::string modelName() override { return "kinematics_no_delay"; };
 
-  MPCTrajectory calculatePredictedTrajectoryInWorldCoordinate(
+  void calculatePredictedTrajectoryInWorldCoordinate(
     const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
     const Eigen::MatrixXd & w_d, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-    const MPCTrajectory & reference_trajectory, const double dt) const override;
+    const MPCTrajectory & reference_trajectory, const double dt,
+    MPCTrajectory & predicted_trajectory) const override;
 
-  MPCTrajectory calculatePredictedTrajectoryInFrenetCoordinate(
+  void calculatePredictedTrajectoryInFrenetCoordinate(
     const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
     const Eigen::MatrixXd & w_d, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-    const MPCTrajectory & reference_trajectory, const double dt) const override;
+    const MPCTrajectory & reference_trajectory, const double dt,
+    MPCTrajectory & predicted_trajectory) const override;
 
 private:
   double m_steer_lim;  //!< @brief steering angle limit [rad]
@@ -123,12 +123,13 @@ public:
    * @param Uex The optimized input vector.
    * @param reference_trajectory The resampled reference trajectory.
    * @param dt delta time used in the optimization
-   * @return The predicted trajectory.
+   * @param predicted_trajectory [out] The predicted trajectory, whose capacity is reused.
    */
-  virtual MPCTrajectory calculatePredictedTrajectoryInWorldCoordinate(
+  virtual void calculatePredictedTrajectoryInWorldCoordinate(
     const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
     const Eigen::MatrixXd & w_d, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-    const MPCTrajectory & reference_trajectory, const double dt) const = 0;
+    const MPCTrajectory & reference_trajectory, const double dt,
+    MPCTrajectory & predicted_trajectory) const = 0;
 
   /**
    * @brief Calculate the predicted trajectory for the ego vehicle based on the MPC result in Frenet
@@ -141,12 +142,13 @@ public:
    * @param Uex The optimized input vector.
    * @param reference_trajectory The resampled reference trajectory.
    * @param dt delta time used in the optimization
-   * @return The predicted trajectory.
+   * @param predicted_trajectory [out] The predicted trajectory, whose capacity is reused.
    */
-  virtual MPCTrajectory calculatePredictedTrajectoryInFrenetCoordinate(
+  virtual void calculatePredictedTrajectoryInFrenetCoordinate(
     const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
     const Eigen::MatrixXd & w_d, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-    const MPCTrajectory & reference_trajectory, const double dt) const = 0;
+    const MPCTrajectory & reference_trajectory, const double dt,
+    MPCTrajectory & predicted_trajectory) const = 0;
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // MPC_LATERAL_CONTROLLER__VEHICLE_MODEL__VEHICLE_MODEL_INTERFACE_HPP_
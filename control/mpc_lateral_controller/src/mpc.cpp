@@ -21,7 +21,9 @@
 #include "tier4_autoware_utils/math/unit_conversion.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
 {
@@ -42,8 +44,9 @@ bool MPC::calculateMPC(
 {
   // since the reference trajectory does not take into account the current velocity of the ego
   // vehicle, it needs to calculate the trajectory velocity considering the longitudinal dynamics.
-  const auto reference_trajectory =
-    applyVelocityDynamicsFilter(m_reference_trajectory, current_kinematics);
+  applyVelocityDynamicsFilter(
+    m_reference_trajectory, current_kinematics, m_filtered_reference_trajectory);
+  const auto & reference_trajectory = m_filtered_reference_trajectory;
 
   // get the necessary data
   const auto [success_data, mpc_data] =
@@ -67,9 +70,9 @@ bool MPC::calculateMPC(
   const double prediction_dt =
     getPredictionDeltaTime(mpc_start_time, reference_trajectory, current_kinematics);
 
-  const auto [success_resample, mpc_resampled_ref_trajectory] =
-    resampleMPCTrajectoryByTime(mpc_start_time, prediction_dt, reference_trajectory);
-  if (!success_resample) {
+  const auto & mpc_resampled_ref_trajectory = m_resampled_reference_trajectory;
+  if (!resampleMPCTrajectoryByTime(
+        mpc_start_time, prediction_dt, reference_trajectory, m_resampled_reference_trajectory)) {
     return fail_warn_throttle("trajectory resampling failed. Stop MPC.");
   }
 
@@ -105,22 +108,23 @@ bool MPC::calculateMPC(
   m_raw_steer_cmd_prev = Uex(0);
 
   /* calculate predicted trajectory */
-  predicted_trajectory =
-    calculatePredictedTrajectory(mpc_matrix, x0, Uex, mpc_resampled_ref_trajectory, prediction_dt);
+  calculatePredictedTrajectory(
+    mpc_matrix, x0, Uex, mpc_resampled_ref_trajectory, prediction_dt, predicted_trajectory);
 
   // prepare diagnostic message
-  diagnostic =
-    generateDiagData(reference_trajectory, mpc_data, mpc_matrix, ctrl_cmd, Uex, current_kinematics);
+  generateDiagData(
+    reference_trajectory, mpc_data, mpc_matrix, ctrl_cmd, Uex, current_kinematics, diagnostic);
 
   return true;
 }
 
-Float32MultiArrayStamped MPC::generateDiagData(
+void MPC::generateDiagData(
   const MPCTrajectory & reference_trajectory, const MPCData & mpc_data,
   const MPCMatrix & mpc_matrix, const AckermannLateralCommand & ctrl_cmd, const VectorXd & Uex,
-  const Odometry & current_kinematics) const
+  const Odometry & current_kinematics, Float32MultiArrayStamped & diagnostic) const
 {
-  Float32MultiArrayStamped diagnostic;
+  // NOTE: the data is cleared but its capacity is kept, so that it is not reallocated.
+  diagnostic.data.clear();
 
   // prepare diagnostic message
   const double nearest_k = reference_trajectory.k.at(mpc_data.nearest_idx);
@@ -159,8 +163,6 @@ Float32MultiArrayStamped MPC::generateDiagData(
   append_diag(iteration_num);             // [18] iteration number
   append_diag(runtime);                   // [19] runtime of the latest problem solved
   append_diag(objective_value);           // [20] objective value of the latest problem solved
-
-  return diagnostic;
 }
 
 void MPC::setReferenceTrajectory(
@@ -249,6 +251,9 @@ void MPC::resetPrevResult(const SteeringReport & current_steer)
   const float steer_lim_f = static_cast<float>(m_steer_lim);
   m_raw_steer_cmd_prev = std::clamp(current_steer.steering_tire_angle, -steer_lim_f, steer_lim_f);
   m_raw_steer_cmd_pprev = std::clamp(current_steer.steering_tire_angle, -steer_lim_f, steer_lim_f);
+
+  // the previous solution is not consistent with the current steering anymore
+  m_prev_sparse_solution.resize(0);
 }
 
 std::pair<bool, MPCData> MPC::getData(
@@ -298,19 +303,19 @@ std::pair<bool, MPCData> MPC::getData(
   return {true, data};
 }
 
-std::pair<bool, MPCTrajectory> MPC::resampleMPCTrajectoryByTime(
-  const double ts, const double prediction_dt, const MPCTrajectory & input) const
+bool MPC::resampleMPCTrajectoryByTime(
+  const double ts, const double prediction_dt, const MPCTrajectory & input, MPCTrajectory & output)
 {
-  MPCTrajectory output;
-  std::vector<double> mpc_time_v;
-  for (double i = 0; i < static_cast<double>(m_param.prediction_horizon); ++i) {
-    mpc_time_v.push_back(ts + i * prediction_dt);
+  m_resample_times.resize(static_cast<size_t>(std::max(m_param.prediction_horizon, 0)));
+  for (size_t i = 0; i < m_resample_times.size(); ++i) {
+    m_resample_times.at(i) = ts + static_cast<double>(i) * prediction_dt;
   }
-  if (!MPCUtils::linearInterpMPCTrajectory(input.relative_time, input, mpc_time_v, output)) {
+  if (!MPCUtils::linearInterpMPCTrajectory(
+        input.relative_time, input, m_resample_times, output, m_resample_weights)) {
     warn_throttle("calculateMPC: mpc resample error. stop mpc calculation. check code!");
-    return {false, {}};
+    return false;
   }
-  return {true, output};
+  return true;
 }
 
 VectorXd MPC::getInitialState(const MPCData & data)
@@ -379,19 +384,21 @@ std::pair<bool, VectorXd> MPC::updateStateForDelayCompensation(
   return {true, x_curr};
 }
 
-MPCTrajectory MPC::applyVelocityDynamicsFilter(
-  const MPCTrajectory & input, const Odometry & current_kinematics) const
+void MPC::applyVelocityDynamicsFilter(
+  const MPCTrajectory & input, const Odometry & current_kinematics, MPCTrajectory & output)
 {
-  const auto autoware_traj = MPCUtils::convertToAutowareTrajectory(input);
-  if (autoware_traj.points.empty()) {
-    return input;
+  // NOTE: the copy assignment reuses the buffers of the output when their capacities are enough.
+  output = input;
+
+  MPCUtils::convertToAutowareTrajectory(input, m_autoware_trajectory);
+  if (m_autoware_trajectory.points.empty()) {
+    return;
   }
 
   const size_t nearest_seg_idx = motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
-    autoware_traj.points, current_kinematics.pose.pose, ego_nearest_dist_threshold,
+    m_autoware_trajectory.points, current_kinematics.pose.pose, ego_nearest_dist_threshold,
     ego_nearest_yaw_threshold);
 
-  MPCTrajectory output = input;
   MPCUtils::dynamicSmoothingVelocity(
     nearest_seg_idx, current_kinematics.twist.twist.linear.x, m_param.acceleration_limit,
     m_param.velocity_time_constant, output);
@@ -400,7 +407,6 @@ MPCTrajectory MPC::applyVelocityDynamicsFilter(
   last_point.relative_time += 100.0;  // extra time to prevent mpc calc failure due to short time
   last_point.vx = 0.0;                // stop velocity at a terminal point
   output.push_back(last_point);
-  return output;
 }
 
 /*
@@ -417,12 +423,24 @@ MPCMatrix MPC::generateMPCMatrix(
   const int DIM_U = m_vehicle_model_ptr->getDimU();
   const int DIM_Y = m_vehicle_model_ptr->getDimY();
 
+  // the sparse formulation uses the stage-wise matrices instead of the condensed ones, which need
+  // O(N^2) memory and O(N^3) computation for the hessian.
+  const bool is_sparse = useSparseFormulation();
+
   MPCMatrix m;
-  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
-  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
-  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
-  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
-  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
+  if (is_sparse) {
+    m.Ad_vec.reserve(N);
+    m.Bd_vec.reserve(N);
+    m.Wd_vec.reserve(N);
+    m.Cd_vec.reserve(N);
+    m.Q_vec.reserve(N);
+  } else {
+    m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
+    m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
+    m.Wex = MatrixXd::Zero(DIM_X * N, 1);
+    m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
+    m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
+  }
   m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
   m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
   m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
@@ -475,22 +493,30 @@ MPCMatrix MPC::generateMPCMatrix(
     int idx_x_i_prev = (i - 1) * DIM_X;
     int idx_u_i = i * DIM_U;
     int idx_y_i = i * DIM_Y;
-    if (i == 0) {
-      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
-      m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
-      m.Wex.block(0, 0, DIM_X, 1) = Wd;
+    if (is_sparse) {
+      m.Ad_vec.push_back(Ad);
+      m.Bd_vec.push_back(Bd);
+      m.Wd_vec.push_back(Wd);
+      m.Cd_vec.push_back(Cd);
+      m.Q_vec.push_back(Q_adaptive);
     } else {
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
-      for (int j = 0; j < i; ++j) {
-        int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
-          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
+      if (i == 0) {
+        m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
+        m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
+        m.Wex.block(0, 0, DIM_X, 1) = Wd;
+      } else {
+        m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+        for (int j = 0; j < i; ++j) {
+          int idx_u_j = j * DIM_U;
+          m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
+            Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
+        }
+        m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
       }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+      m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
+      m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
+      m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
     }
-    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
-    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
-    m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
     m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R_adaptive;
 
     // get reference input (feed-forward)
@@ -549,6 +575,10 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
     return {false, {}};
   }
 
+  if (m.isSparse()) {
+    return executeOptimizationSparse(m, x0, prediction_dt, traj, current_velocity);
+  }
+
   const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
@@ -599,6 +629,196 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   return {true, Uex};
 }
 
+/*
+ * solve quadratic optimization in the sparse form.
+ * decision variables: z = [Uex; Xex] = [u0, ..., uN-1, x1, ..., xN]
+ * cost function: J = 1/2 * z' * P * z + q' * z
+ *                , P = blkdiag(R1ex + R2ex, C0'*Q0*C0, ..., CN-1'*QN-1*CN-1)
+ *                , q = [-R1ex * Uref_ex + f_steer; 0]
+ * constraint matrix : l < A*z < u
+ *  - dynamics (equality) : x(k+1) - Ad(k) * x(k) - Bd(k) * u(k) = Wd(k), (x0 is given)
+ *  - steering limit : lb < u < ub
+ *  - steering rate limit : lbA < Au < ubA (same as the condensed formulation)
+ *
+ * The sparsity pattern of P and A depends only on the horizon and the model dimensions, so the
+ * structural non-zeros are always inserted (even if the value is zero) to keep the pattern, which
+ * allows the solver to update only the values and warm start from the previous solution.
+ */
+std::pair<bool, VectorXd> MPC::executeOptimizationSparse(
+  const MPCMatrix & m, const VectorXd & x0, const double prediction_dt, const MPCTrajectory & traj,
+  const double current_velocity)
+{
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int DIM_U_N = N * DIM_U;
+  const int DIM_X_N = N * DIM_X;
+  const int DIM_Z = DIM_U_N + DIM_X_N;
+  const int DIM_CONSTRAINT = DIM_X_N + 2 * DIM_U_N;
+
+  // the input weight is banded since only the adjacent inputs are coupled by the steering rate and
+  // acceleration weights
+  constexpr int INPUT_WEIGHT_BANDWIDTH = 2;
+
+  using Triplet = Eigen::Triplet<double>;
+
+  // hessian (upper triangular part)
+  std::vector<Triplet> p_triplets;
+  p_triplets.reserve(DIM_U_N * (INPUT_WEIGHT_BANDWIDTH + 1) + N * DIM_X * (DIM_X + 1) / 2);
+  const MatrixXd R = m.R1ex + m.R2ex;
+  for (int i = 0; i < DIM_U_N; ++i) {
+    for (int j = i; j < std::min(DIM_U_N, i + INPUT_WEIGHT_BANDWIDTH + 1); ++j) {
+      p_triplets.emplace_back(i, j, R(i, j));
+    }
+  }
+  for (int k = 0; k < N; ++k) {
+    const MatrixXd CQC = m.Cd_vec.at(k).transpose() * m.Q_vec.at(k) * m.Cd_vec.at(k);
+    const int idx_x = DIM_U_N + k * DIM_X;
+    for (int i = 0; i < DIM_X; ++i) {
+      for (int j = i; j < DIM_X; ++j) {
+        p_triplets.emplace_back(idx_x + i, idx_x + j, CQC(i, j));
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> P(DIM_Z, DIM_Z);
+  P.setFromTriplets(p_triplets.begin(), p_triplets.end());
+
+  // gradient
+  MatrixXd f = -m.Uref_ex.transpose() * m.R1ex;
+  addSteerWeightF(prediction_dt, f);
+  VectorXd q = VectorXd::Zero(DIM_Z);
+  q.head(DIM_U_N) = f.transpose();
+
+  // constraints
+  std::vector<Triplet> a_triplets;
+  a_triplets.reserve(N * DIM_X * (1 + DIM_X + DIM_U) + 3 * DIM_U_N);
+  VectorXd l = VectorXd::Zero(DIM_CONSTRAINT);
+  VectorXd u = VectorXd::Zero(DIM_CONSTRAINT);
+
+  // dynamics
+  for (int k = 0; k < N; ++k) {
+    const int idx_row = k * DIM_X;
+    const int idx_x = DIM_U_N + k * DIM_X;
+    const int idx_x_prev = DIM_U_N + (k - 1) * DIM_X;
+    const int idx_u = k * DIM_U;
+    const auto & Ad = m.Ad_vec.at(k);
+    const auto & Bd = m.Bd_vec.at(k);
+    for (int i = 0; i < DIM_X; ++i) {
+      a_triplets.emplace_back(idx_row + i, idx_x + i, 1.0);
+      for (int j = 0; j < DIM_U; ++j) {
+        a_triplets.emplace_back(idx_row + i, idx_u + j, -Bd(i, j));
+      }
+      if (k > 0) {
+        for (int j = 0; j < DIM_X; ++j) {
+          a_triplets.emplace_back(idx_row + i, idx_x_prev + j, -Ad(i, j));
+        }
+      }
+    }
+    const VectorXd w = k == 0 ? VectorXd(Ad * x0 + m.Wd_vec.at(k)) : VectorXd(m.Wd_vec.at(k));
+    l.segment(idx_row, DIM_X) = w;
+    u.segment(idx_row, DIM_X) = w;
+  }
+
+  // steering angle limit
+  for (int i = 0; i < DIM_U_N; ++i) {
+    a_triplets.emplace_back(DIM_X_N + i, i, 1.0);
+  }
+  l.segment(DIM_X_N, DIM_U_N).setConstant(-m_steer_lim);
+  u.segment(DIM_X_N, DIM_U_N).setConstant(m_steer_lim);
+
+  // steering angle rate limit
+  const int idx_rate = DIM_X_N + DIM_U_N;
+  for (int i = 0; i < DIM_U_N; ++i) {
+    a_triplets.emplace_back(idx_rate + i, i, 1.0);
+    if (i > 0) {
+      a_triplets.emplace_back(idx_rate + i, i - 1, -1.0);
+    }
+  }
+  const VectorXd steer_rate_limits = calcSteerRateLimitOnTrajectory(traj, current_velocity);
+  l.segment(idx_rate, DIM_U_N) = -steer_rate_limits * prediction_dt;
+  u.segment(idx_rate, DIM_U_N) = steer_rate_limits * prediction_dt;
+  l(idx_rate) = m_raw_steer_cmd_prev - steer_rate_limits(0) * m_ctrl_period;
+  u(idx_rate) = m_raw_steer_cmd_prev + steer_rate_limits(0) * m_ctrl_period;
+
+  Eigen::SparseMatrix<double> A(DIM_CONSTRAINT, DIM_Z);
+  A.setFromTriplets(a_triplets.begin(), a_triplets.end());
+
+  const VectorXd z_init = getSparseWarmStartSolution(prediction_dt, DIM_Z);
+
+  VectorXd z;
+  auto t_start = std::chrono::system_clock::now();
+  bool solve_result = m_qpsolver_ptr->solveSparse(P, q, A, l, u, z_init, z);
+  auto t_end = std::chrono::system_clock::now();
+  if (!solve_result) {
+    m_prev_sparse_solution.resize(0);
+    warn_throttle("qp solver error");
+    return {false, {}};
+  }
+
+  {
+    auto t = std::chrono::duration_cast<std::chrono::milliseconds>(t_end - t_start).count();
+    RCLCPP_DEBUG(m_logger, "sparse qp solver calculation time = %ld [ms]", t);
+  }
+
+  if (z.array().isNaN().any()) {
+    m_prev_sparse_solution.resize(0);
+    warn_throttle("model Uex includes NaN, stop MPC.");
+    return {false, {}};
+  }
+
+  m_prev_sparse_solution = z;
+  return {true, z.head(DIM_U_N)};
+}
+
+VectorXd MPC::getSparseWarmStartSolution(const double prediction_dt, const int dim_z) const
+{
+  const auto & z_prev = m_prev_sparse_solution;
+  if (z_prev.size() != dim_z) {
+    return VectorXd{};
+  }
+
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+
+  // the horizon moves forward by the control period at every cycle
+  const int shift =
+    std::clamp(static_cast<int>(std::round(m_ctrl_period / prediction_dt)), 0, N - 1);
+  if (shift == 0) {
+    return z_prev;
+  }
+
+  VectorXd z_init(dim_z);
+  for (int k = 0; k < N; ++k) {
+    // hold the terminal value for the steps beyond the previous horizon
+    const int k_prev = std::min(k + shift, N - 1);
+    z_init.segment(k * DIM_U, DIM_U) = z_prev.segment(k_prev * DIM_U, DIM_U);
+    z_init.segment(N * DIM_U + k * DIM_X, DIM_X) =
+      z_prev.segment(N * DIM_U + k_prev * DIM_X, DIM_X);
+  }
+  return z_init;
+}
+
+VectorXd MPC::calcPredictedStates(
+  const MPCMatrix & m, const VectorXd & x0, const VectorXd & Uex) const
+{
+  if (!m.isSparse()) {
+    return m.Aex * x0 + m.Bex * Uex + m.Wex;
+  }
+
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int N = static_cast<int>(m.Ad_vec.size());
+
+  VectorXd Xex(N * DIM_X);
+  VectorXd x = x0;
+  for (int k = 0; k < N; ++k) {
+    x = m.Ad_vec.at(k) * x + m.Bd_vec.at(k) * Uex.segment(k * DIM_U, DIM_U) + m.Wd_vec.at(k);
+    Xex.segment(k * DIM_X, DIM_X) = x;
+  }
+  return Xex;
+}
+
 void MPC::addSteerWeightR(const double prediction_dt, MatrixXd & R) const
 {
   const int N = m_param.prediction_horizon;
@@ -669,12 +889,12 @@ void MPC::addSteerWeightF(const double prediction_dt, MatrixXd & f) const
 }
 
 double MPC::getPredictionDeltaTime(
-  const double start_time, const MPCTrajectory & input, const Odometry & current_kinematics) const
+  const double start_time, const MPCTrajectory & input, const Odometry & current_kinematics)
 {
   // Calculate the time min_prediction_length ahead from current_pose
-  const auto autoware_traj = MPCUtils::convertToAutowareTrajectory(input);
+  MPCUtils::convertToAutowareTrajectory(input, m_autoware_trajectory);
   const size_t nearest_idx = motion_utils::findFirstNearestIndexWithSoftConstraints(
-    autoware_traj.points, current_kinematics.pose.pose, ego_nearest_dist_threshold,
+    m_autoware_trajectory.points, current_kinematics.pose.pose, ego_nearest_dist_threshold,
     ego_nearest_yaw_threshold);
   double sum_dist = 0;
   const double target_time = [&]() {
@@ -712,8 +932,7 @@ double MPC::calcDesiredSteeringRate(
   }
 
   // calculate predicted states to get the steering motion
-  const auto & m = mpc_matrix;
-  const MatrixXd Xex = m.Aex * x0 + m.Bex * Uex + m.Wex;
+  const VectorXd Xex = calcPredictedStates(mpc_matrix, x0, Uex);
 
   const size_t STEER_IDX = 2;  // for kinematics model
 
@@ -777,33 +996,45 @@ VectorXd MPC::calcSteerRateLimitOnTrajectory(
   return steer_rate_limits;
 }
 
-Trajectory MPC::calculatePredictedTrajectory(
+void MPC::calculatePredictedTrajectory(
   const MPCMatrix & mpc_matrix, const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-  const MPCTrajectory & reference_trajectory, const double dt) const
+  const MPCTrajectory & reference_trajectory, const double dt,
+  Trajectory & predicted_trajectory)
 {
-  const auto predicted_mpc_trajectory =
-    m_vehicle_model_ptr->calculatePredictedTrajectoryInWorldCoordinate(
-      mpc_matrix.Aex, mpc_matrix.Bex, mpc_matrix.Cex, mpc_matrix.Wex, x0, Uex, reference_trajectory,
-      dt);
+  // there is no condensed matrix in the sparse formulation. pass the predicted states as the offset
+  // term with zero coefficient matrices, since some vehicle models (e.g. the dynamics model)
+  // calculate the predicted trajectory with the condensed matrices.
+  const bool is_sparse = mpc_matrix.isSparse();
+  MatrixXd sparse_Aex, sparse_Bex, sparse_Wex;
+  if (is_sparse) {
+    sparse_Wex = calcPredictedStates(mpc_matrix, x0, Uex);
+    sparse_Aex = MatrixXd::Zero(sparse_Wex.rows(), x0.rows());
+    sparse_Bex = MatrixXd::Zero(sparse_Wex.rows(), Uex.rows());
+  }
+  const MatrixXd & Aex = is_sparse ? sparse_Aex : mpc_matrix.Aex;
+  const MatrixXd & Bex = is_sparse ? sparse_Bex : mpc_matrix.Bex;
+  const MatrixXd & Cex = mpc_matrix.Cex;
+  const MatrixXd & Wex = is_sparse ? sparse_Wex : mpc_matrix.Wex;
+
+  m_vehicle_model_ptr->calculatePredictedTrajectoryInWorldCoordinate(
+    Aex, Bex, Cex, Wex, x0, Uex, reference_trajectory, dt, m_predicted_trajectory);
 
   // do not over the reference trajectory
   const auto predicted_length = MPCUtils::calcMPCTrajectoryArcLength(reference_trajectory);
-  const auto clipped_trajectory =
-    MPCUtils::clipTrajectoryByLength(predicted_mpc_trajectory, predicted_length);
+  MPCUtils::clipTrajectoryByLength(
+    m_predicted_trajectory, predicted_length, m_clipped_predicted_trajectory);
 
-  const auto predicted_trajectory = MPCUtils::convertToAutowareTrajectory(clipped_trajectory);
+  MPCUtils::convertToAutowareTrajectory(m_clipped_predicted_trajectory, predicted_trajectory);
 
   // Publish trajectory in relative coordinate for debug purpose.
   if (m_debug_publish_predicted_trajectory) {
-    const auto frenet = m_vehicle_model_ptr->calculatePredictedTrajectoryInFrenetCoordinate(
-      mpc_matrix.Aex, mpc_matrix.Bex, mpc_matrix.Cex, mpc_matrix.Wex, x0, Uex, reference_trajectory,
-      dt);
+    MPCTrajectory frenet;
+    m_vehicle_model_ptr->calculatePredictedTrajectoryInFrenetCoordinate(
+      Aex, Bex, Cex, Wex, x0, Uex, reference_trajectory, dt, frenet);
     const auto frenet_clipped = MPCUtils::convertToAutowareTrajectory(
       MPCUtils::clipTrajectoryByLength(frenet, predicted_length));
     m_debug_frenet_predicted_trajectory_pub->publish(frenet_clipped);
   }
-
-  return predicted_trajectory;
 }
 
 bool MPC::isValid(const MPCMatrix & m) const
@@ -822,6 +1053,16 @@ bool MPC::isValid(const MPCMatrix & m) const
     return false;
   }
 
+  const auto is_finite = [](const std::vector<MatrixXd> & mats) {
+    return std::all_of(
+      mats.begin(), mats.end(), [](const MatrixXd & mat) { return mat.allFinite(); });
+  };
+  if (
+    !is_finite(m.Ad_vec) || !is_finite(m.Bd_vec) || !is_finite(m.Wd_vec) ||
+    !is_finite(m.Cd_vec) || !is_finite(m.Q_vec)) {
+    return false;
+  }
+
   return true;
 }
 }  // namespace autoware::motion::control::mpc_lateral_controller
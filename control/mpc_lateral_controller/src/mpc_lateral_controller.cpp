@@ -240,8 +240,9 @@ trajectory_follower::LateralOutput MpcLateralController::run(
   }
 
   AckermannLateralCommand ctrl_cmd;
-  Trajectory predicted_traj;
-  Float32MultiArrayStamped debug_values;
+  // NOTE: the buffers keep their capacity. They are published as empty when MPC is not solved.
+  m_predicted_trajectory.points.clear();
+  m_debug_values.data.clear();
 
   if (!m_is_ctrl_cmd_prev_initialized) {
     m_ctrl_cmd_prev = getInitialControlCommand();
@@ -249,7 +250,8 @@ trajectory_follower::LateralOutput MpcLateralController::run(
   }
 
   const bool is_mpc_solved = m_mpc->calculateMPC(
-    m_current_steering, m_current_kinematic_state, ctrl_cmd, predicted_traj, debug_values);
+    m_current_steering, m_current_kinematic_state, ctrl_cmd, m_predicted_trajectory,
+    m_debug_values);
 
   // reset previous MPC result
   // Note: When a large deviation from the trajectory occurs, the optimization stops and
@@ -269,8 +271,8 @@ trajectory_follower::LateralOutput MpcLateralController::run(
     ctrl_cmd.steering_tire_angle += steering_offset_->getOffset();
   }
 
-  publishPredictedTraj(predicted_traj);
-  publishDebugValues(debug_values);
+  publishPredictedTraj(m_predicted_trajectory);
+  publishDebugValues(m_debug_values);
 
   const auto createLateralOutput = [this](const auto & cmd, const bool is_mpc_solved) {
     trajectory_follower::LateralOutput output;
@@ -510,6 +512,8 @@ void MpcLateralController::declareMPCparameters(rclcpp::Node & node)
 {
   m_mpc->m_param.prediction_horizon = node.declare_parameter<int>("mpc_prediction_horizon");
   m_mpc->m_param.prediction_dt = node.declare_parameter<double>("mpc_prediction_dt");
+  m_mpc->m_param.use_sparse_formulation =
+    node.declare_parameter<bool>("mpc_use_sparse_formulation");
 
   const auto dp = [&](const auto & param) { return node.declare_parameter<double>(param); };
 
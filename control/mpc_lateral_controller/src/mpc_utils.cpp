@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -155,30 +156,43 @@ std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
 bool linearInterpMPCTrajectory(
   const std::vector<double> & in_index, const MPCTrajectory & in_traj,
   const std::vector<double> & out_index, MPCTrajectory & out_traj)
+{
+  interpolation::LerpWeights weights;
+  return linearInterpMPCTrajectory(in_index, in_traj, out_index, out_traj, weights);
+}
+
+bool linearInterpMPCTrajectory(
+  const std::vector<double> & in_index, const MPCTrajectory & in_traj,
+  const std::vector<double> & out_index, MPCTrajectory & out_traj,
+  interpolation::LerpWeights & weights)
 {
   if (in_traj.empty()) {
     out_traj = in_traj;
     return true;
   }
 
-  std::vector<double> in_traj_yaw = in_traj.yaw;
-  convertEulerAngleToMonotonic(in_traj_yaw);
-
-  const auto lerp_arc_length = [&](const auto & input_value) {
-    return interpolation::lerp(in_index, input_value, out_index);
+  const auto lerp_arc_length = [&](const auto & input_value, auto & output_value) {
+    if (input_value.size() != weights.base_size) {
+      throw std::invalid_argument("The size of base_keys and base_values are not the same.");
+    }
+    output_value.resize(weights.indices.size());
+    interpolation::lerp(weights, input_value.data(), output_value.data());
   };
 
   try {
-    out_traj.x = lerp_arc_length(in_traj.x);
-    out_traj.y = lerp_arc_length(in_traj.y);
-    out_traj.z = lerp_arc_length(in_traj.z);
-    out_traj.yaw = lerp_arc_length(in_traj.yaw);
-    out_traj.vx = lerp_arc_length(in_traj.vx);
-    out_traj.k = lerp_arc_length(in_traj.k);
-    out_traj.smooth_k = lerp_arc_length(in_traj.smooth_k);
-    out_traj.relative_time = lerp_arc_length(in_traj.relative_time);
+    interpolation::calcLerpWeights(in_index, out_index, weights);
+    lerp_arc_length(in_traj.x, out_traj.x);
+    lerp_arc_length(in_traj.y, out_traj.y);
+    lerp_arc_length(in_traj.z, out_traj.z);
+    lerp_arc_length(in_traj.yaw, out_traj.yaw);
+    lerp_arc_length(in_traj.vx, out_traj.vx);
+    lerp_arc_length(in_traj.k, out_traj.k);
+    lerp_arc_length(in_traj.smooth_k, out_traj.smooth_k);
+    lerp_arc_length(in_traj.relative_time, out_traj.relative_time);
   } catch (const std::exception & e) {
     std::cerr << "linearInterpMPCTrajectory error!: " << e.what() << std::endl;
+    // the output may be partially overwritten
+    out_traj.clear();
   }
 
   if (out_traj.empty()) {
@@ -276,20 +290,23 @@ MPCTrajectory convertToMPCTrajectory(const Trajectory & input)
 Trajectory convertToAutowareTrajectory(const MPCTrajectory & input)
 {
   Trajectory output;
-  TrajectoryPoint p;
-  for (size_t i = 0; i < input.size(); ++i) {
+  convertToAutowareTrajectory(input, output);
+  return output;
+}
+
+void convertToAutowareTrajectory(const MPCTrajectory & input, Trajectory & output)
+{
+  output.points.resize(std::min(input.size(), output.points.max_size()));
+  for (size_t i = 0; i < output.points.size(); ++i) {
+    auto & p = output.points.at(i);
+    p = TrajectoryPoint{};
     p.pose.position.x = input.x.at(i);
     p.pose.position.y = input.y.at(i);
     p.pose.position.z = input.z.at(i);
     p.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(input.yaw.at(i));
     p.longitudinal_velocity_mps =
       static_cast<decltype(p.longitudinal_velocity_mps)>(input.vx.at(i));
-    output.points.push_back(p);
-    if (output.points.size() == output.points.max_size()) {
-      break;
-    }
   }
-  return output;
 }
 
 bool calcMPCTrajectoryTime(MPCTrajectory & traj)
@@ -470,6 +487,14 @@ void extendTrajectoryInYawDirection(
 MPCTrajectory clipTrajectoryByLength(const MPCTrajectory & trajectory, const double length)
 {
   MPCTrajectory clipped_trajectory;
+  clipTrajectoryByLength(trajectory, length, clipped_trajectory);
+  return clipped_trajectory;
+}
+
+void clipTrajectoryByLength(
+  const MPCTrajectory & trajectory, const double length, MPCTrajectory & clipped_trajectory)
+{
+  clipped_trajectory.clear();
   clipped_trajectory.push_back(trajectory.at(0));
 
   double current_length = 0.0;
@@ -480,8 +505,6 @@ MPCTrajectory clipTrajectoryByLength(const MPCTrajectory & trajectory, const dou
     }
     clipped_trajectory.push_back(trajectory.at(i));
   }
-
-  return clipped_trajectory;
 }
 
 }  // namespace MPCUtils
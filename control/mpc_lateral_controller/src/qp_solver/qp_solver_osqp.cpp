@@ -14,7 +14,9 @@
 
 #include "mpc_lateral_controller/qp_solver/qp_solver_osqp.hpp"
 
+#include <algorithm>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
@@ -54,15 +56,89 @@ bool QPSolverOSQP::solve(
   /* execute optimization */
   auto result = osqpsolver_.optimize(h_mat, osqpA, f, lower_bound, upper_bound);
 
+  // the workspace is set up again with the dense problem
+  is_sparse_workspace_initialized_ = false;
+
   std::vector<double> U_osqp = std::get<0>(result);
   u = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>>(
     &U_osqp[0], static_cast<Eigen::Index>(U_osqp.size()), 1);
 
+  return checkResult(result);
+}
+
+bool QPSolverOSQP::solveSparse(
+  const Eigen::SparseMatrix<double> & p, const Eigen::VectorXd & q,
+  const Eigen::SparseMatrix<double> & a, const Eigen::VectorXd & l, const Eigen::VectorXd & u,
+  const Eigen::VectorXd & z_init, Eigen::VectorXd & z)
+{
+  using autoware::common::osqp::CSC_Matrix;
+
+  const auto to_csc = [](const Eigen::SparseMatrix<double> & mat) {
+    Eigen::SparseMatrix<double> compressed = mat;
+    compressed.makeCompressed();
+    CSC_Matrix csc;
+    csc.m_vals.assign(compressed.valuePtr(), compressed.valuePtr() + compressed.nonZeros());
+    csc.m_row_idxs.assign(
+      compressed.innerIndexPtr(), compressed.innerIndexPtr() + compressed.nonZeros());
+    csc.m_col_idxs.assign(
+      compressed.outerIndexPtr(), compressed.outerIndexPtr() + compressed.outerSize() + 1);
+    return csc;
+  };
+  const auto has_same_pattern = [](const CSC_Matrix & m1, const CSC_Matrix & m2) {
+    return m1.m_row_idxs == m2.m_row_idxs && m1.m_col_idxs == m2.m_col_idxs;
+  };
+
+  const auto p_csc = to_csc(p);
+  const auto a_csc = to_csc(a);
+  const std::vector<double> q_vec(q.data(), q.data() + q.size());
+  const std::vector<double> l_vec(l.data(), l.data() + l.size());
+  const std::vector<double> u_vec(u.data(), u.data() + u.size());
+
+  const bool can_update = is_sparse_workspace_initialized_ &&
+                          has_same_pattern(p_csc, prev_p_csc_) &&
+                          has_same_pattern(a_csc, prev_a_csc_);
+  if (can_update) {
+    // keep the workspace and the previous solution, and update only the values
+    osqpsolver_.updateCscP(p_csc);
+    osqpsolver_.updateCscA(a_csc);
+    osqpsolver_.updateQ(q_vec);
+    osqpsolver_.updateBounds(l_vec, u_vec);
+  } else {
+    osqpsolver_.initializeProblem(p_csc, a_csc, q_vec, l_vec, u_vec);
+    prev_p_csc_ = p_csc;
+    prev_a_csc_ = a_csc;
+    is_sparse_workspace_initialized_ = true;
+  }
+
+  if (z_init.size() == q.size()) {
+    osqpsolver_.setPrimalVariables(
+      std::vector<double>(z_init.data(), z_init.data() + z_init.size()));
+  }
+
+  /* execute optimization */
+  const auto result = osqpsolver_.optimize();
+
+  const std::vector<double> & z_osqp = std::get<0>(result);
+  z = Eigen::Map<const Eigen::VectorXd>(z_osqp.data(), static_cast<Eigen::Index>(z_osqp.size()));
+
+  if (!checkResult(result)) {
+    // set up the workspace from scratch next time not to warm start from the failed solution
+    is_sparse_workspace_initialized_ = false;
+    return false;
+  }
+  return true;
+}
+
+bool QPSolverOSQP::checkResult(
+  const std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> & result)
+  const
+{
   const int status_val = std::get<3>(result);
   if (status_val != 1) {
     RCLCPP_WARN(logger_, "optimization failed : %s", osqpsolver_.getStatusMessage().c_str());
     return false;
   }
+  const auto & U_osqp = std::get<0>(result);
   const auto has_nan =
     std::any_of(U_osqp.begin(), U_osqp.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
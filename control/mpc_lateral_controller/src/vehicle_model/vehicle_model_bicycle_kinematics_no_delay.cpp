@@ -60,11 +60,12 @@ void KinematicsBicycleModelNoDelay::calculateReferenceInput(Eigen::MatrixXd & u_
   u_ref(0, 0) = std::atan(m_wheelbase * m_curvature);
 }
 
-MPCTrajectory KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInWorldCoordinate(
+void KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInWorldCoordinate(
   [[maybe_unused]] const Eigen::MatrixXd & a_d, [[maybe_unused]] const Eigen::MatrixXd & b_d,
   [[maybe_unused]] const Eigen::MatrixXd & c_d, [[maybe_unused]] const Eigen::MatrixXd & w_d,
   const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-  const MPCTrajectory & reference_trajectory, const double dt) const
+  const MPCTrajectory & reference_trajectory, const double dt,
+  MPCTrajectory & predicted_trajectory) const
 {
   // Calculate predicted state in world coordinate since there is modeling errors in Frenet
   // Relative coordinate x = [lat_err, yaw_err]
@@ -101,28 +102,28 @@ MPCTrajectory KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInWorld
     return next_state;
   };
 
-  MPCTrajectory mpc_predicted_trajectory;
+  predicted_trajectory.clear();
   const auto DIM_U = getDimU();
   for (size_t i = 0; i < t.size(); ++i) {
     state_w = updateState(state_w, Uex.block(i * DIM_U, 0, DIM_U, 1), dt, t.vx.at(i));
-    mpc_predicted_trajectory.push_back(
+    predicted_trajectory.push_back(
       state_w(0), state_w(1), t.z.at(i), state_w(2), t.vx.at(i), t.k.at(i), t.smooth_k.at(i),
       t.relative_time.at(i));
   }
 
-  return mpc_predicted_trajectory;
 }
 
-MPCTrajectory KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInFrenetCoordinate(
+void KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInFrenetCoordinate(
   const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d,
   [[maybe_unused]] const Eigen::MatrixXd & c_d, const Eigen::MatrixXd & w_d,
   const Eigen::MatrixXd & x0, const Eigen::MatrixXd & Uex,
-  const MPCTrajectory & reference_trajectory, [[maybe_unused]] const double dt) const
+  const MPCTrajectory & reference_trajectory, [[maybe_unused]] const double dt,
+  MPCTrajectory & predicted_trajectory) const
 {
   // Relative coordinate x = [lat_err, yaw_err]
 
   Eigen::VectorXd Xex = a_d * x0 + b_d * Uex + w_d;
-  MPCTrajectory mpc_predicted_trajectory;
+  predicted_trajectory.clear();
   const auto DIM_X = getDimX();
   const auto & t = reference_trajectory;
 
@@ -132,9 +133,8 @@ MPCTrajectory KinematicsBicycleModelNoDelay::calculatePredictedTrajectoryInFrene
     const auto x = t.x.at(i) - std::sin(t.yaw.at(i)) * lateral_error;
     const auto y = t.y.at(i) + std::cos(t.yaw.at(i)) * lateral_error;
     const auto yaw = t.yaw.at(i) + yaw_error;
-    mpc_predicted_trajectory.push_back(
+    predicted_trajectory.push_back(
       x, y, t.z.at(i), yaw, t.vx.at(i), t.k.at(i), t.smooth_k.at(i), t.relative_time.at(i));
   }
-  return mpc_predicted_trajectory;
 }
 }  // namespace autoware::motion::control::mpc_lateral_controller
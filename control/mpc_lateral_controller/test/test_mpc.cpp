@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion::control::mpc_lateral_controller
@@ -302,6 +303,40 @@ TEST_F(MPCTest, OsqpCalculateRightTurn)
   EXPECT_LT(ctrl_cmd.steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, OsqpSparseCalculateRightTurn)
+{
+  auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+  const auto current_kinematics =
+    makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+  const auto odom = makeOdometry(pose_zero, default_velocity);
+
+  const auto calculate = [&](const bool use_sparse_formulation) {
+    auto mpc = std::make_unique<MPC>(node);
+    param.use_sparse_formulation = use_sparse_formulation;
+    initializeMPC(*mpc);
+    mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+    mpc->setVehicleModel(
+      std::make_shared<KinematicsBicycleModel>(wheelbase, steer_limit, steer_tau));
+    mpc->setQPSolver(std::make_shared<QPSolverOSQP>(logger));
+
+    // solve twice to check the solution with the updated workspace and warm start
+    AckermannLateralCommand ctrl_cmd;
+    Trajectory pred_traj;
+    Float32MultiArrayStamped diag;
+    EXPECT_TRUE(mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    EXPECT_TRUE(mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    return ctrl_cmd;
+  };
+
+  const auto condensed_cmd = calculate(false);
+  const auto sparse_cmd = calculate(true);
+
+  // the sparse formulation is equivalent to the condensed one
+  EXPECT_LT(sparse_cmd.steering_tire_angle, 0.0f);
+  EXPECT_LT(sparse_cmd.steering_tire_rotation_rate, 0.0f);
+  EXPECT_NEAR(sparse_cmd.steering_tire_angle, condensed_cmd.steering_tire_angle, 1e-3);
+}
+
 TEST_F(MPCTest, KinematicsNoDelayCalculate)
 {
   auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
@@ -388,6 +423,44 @@ TEST_F(MPCTest, DynamicCalculate)
   EXPECT_EQ(ctrl_cmd.steering_tire_rotation_rate, 0.0f);
 }
 
+TEST_F(MPCTest, DynamicSparseCalculateRightTurn)
+{
+  auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
+  const auto current_kinematics =
+    makeOdometry(dummy_right_turn_trajectory.points.front().pose, 0.0);
+  const auto odom = makeOdometry(pose_zero, default_velocity);
+
+  const auto calculate = [&](const bool use_sparse_formulation) {
+    auto mpc = std::make_unique<MPC>(node);
+    param.use_sparse_formulation = use_sparse_formulation;
+    initializeMPC(*mpc);
+    mpc->setReferenceTrajectory(dummy_right_turn_trajectory, trajectory_param, current_kinematics);
+    mpc->setVehicleModel(std::make_shared<DynamicsBicycleModel>(
+      wheelbase, mass_fl, mass_fr, mass_rl, mass_rr, cf, cr));
+    mpc->setQPSolver(std::make_shared<QPSolverOSQP>(logger));
+
+    AckermannLateralCommand ctrl_cmd;
+    Trajectory pred_traj;
+    Float32MultiArrayStamped diag;
+    EXPECT_TRUE(mpc->calculateMPC(neutral_steer, odom, ctrl_cmd, pred_traj, diag));
+    return std::make_pair(ctrl_cmd, pred_traj);
+  };
+
+  const auto [condensed_cmd, condensed_traj] = calculate(false);
+  const auto [sparse_cmd, sparse_traj] = calculate(true);
+
+  // the predicted trajectory is calculated from the predicted states of the sparse formulation
+  EXPECT_NEAR(sparse_cmd.steering_tire_angle, condensed_cmd.steering_tire_angle, 1e-3);
+  ASSERT_EQ(sparse_traj.points.size(), condensed_traj.points.size());
+  ASSERT_FALSE(sparse_traj.points.empty());
+  for (size_t i = 0; i < sparse_traj.points.size(); ++i) {
+    const auto & sparse_p = sparse_traj.points.at(i).pose.position;
+    const auto & condensed_p = condensed_traj.points.at(i).pose.position;
+    EXPECT_NEAR(sparse_p.x, condensed_p.x, 1e-2);
+    EXPECT_NEAR(sparse_p.y, condensed_p.y, 1e-2);
+  }
+}
+
 TEST_F(MPCTest, MultiSolveWithBuffer)
 {
   auto node = rclcpp::Node("mpc_test_node", rclcpp::NodeOptions{});
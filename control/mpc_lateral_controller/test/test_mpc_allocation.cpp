@@ -0,0 +1,180 @@
+// Copyright 2024 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "interpolation/linear_interpolation.hpp"
+#include "mpc_lateral_controller/mpc_trajectory.hpp"
+#include "mpc_lateral_controller/mpc_utils.hpp"
+
+#include "autoware_auto_planning_msgs/msg/trajectory.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// The global allocation functions are replaced to count the heap allocations in the test
+// executable. They only count the allocations and behave the same as the default ones otherwise.
+namespace
+{
+std::atomic<size_t> g_num_allocations{0};
+}  // namespace
+
+void * operator new(std::size_t size)
+{
+  ++g_num_allocations;
+  if (void * ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+namespace MPCUtils = autoware::motion::control::mpc_lateral_controller::MPCUtils;
+using autoware::motion::control::mpc_lateral_controller::MPCTrajectory;
+using autoware_auto_planning_msgs::msg::Trajectory;
+
+MPCTrajectory makeCircularTrajectory(const size_t num_points)
+{
+  MPCTrajectory traj;
+  constexpr double radius = 50.0;
+  constexpr double interval = 1.0;
+  constexpr double velocity = 5.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = interval * static_cast<double>(i) / radius;
+    traj.push_back(
+      radius * std::sin(theta), radius * (1.0 - std::cos(theta)), 0.0, theta, velocity,
+      1.0 / radius, 1.0 / radius, interval * static_cast<double>(i) / velocity);
+  }
+  return traj;
+}
+
+std::vector<double> makeResampleTimes(const double start_time, const double dt, const size_t size)
+{
+  std::vector<double> times(size);
+  for (size_t i = 0; i < size; ++i) {
+    times.at(i) = start_time + dt * static_cast<double>(i);
+  }
+  return times;
+}
+
+// counts the heap allocations in the given function
+template <class F>
+size_t countAllocations(F && f)
+{
+  const size_t num_allocations_before = g_num_allocations;
+  f();
+  return g_num_allocations - num_allocations_before;
+}
+
+/* cppcheck-suppress syntaxError */
+TEST(TestMPCAllocation, LinearInterpMPCTrajectoryWithoutAllocation)
+{
+  const auto in_traj = makeCircularTrajectory(100);
+  constexpr size_t horizon = 50;
+
+  MPCTrajectory out_traj;
+  interpolation::LerpWeights weights;
+
+  // the buffers are allocated in the first call
+  const auto first_times = makeResampleTimes(0.0, 0.1, horizon);
+  EXPECT_GT(countAllocations([&]() {
+              EXPECT_TRUE(MPCUtils::linearInterpMPCTrajectory(
+                in_traj.relative_time, in_traj, first_times, out_traj, weights));
+            }),
+            0u);
+
+  // no allocation in the steady state, where the resampled times change but the horizon does not
+  for (const double start_time : {0.5, 1.0, 3.0}) {
+    const auto times = makeResampleTimes(start_time, 0.2, horizon);
+    bool success = false;
+    EXPECT_EQ(countAllocations([&]() {
+                success = MPCUtils::linearInterpMPCTrajectory(
+                  in_traj.relative_time, in_traj, times, out_traj, weights);
+              }),
+              0u);
+    EXPECT_TRUE(success);
+
+    // same as the interpolation without the workspace
+    MPCTrajectory ans;
+    ASSERT_TRUE(MPCUtils::linearInterpMPCTrajectory(in_traj.relative_time, in_traj, times, ans));
+    ASSERT_EQ(out_traj.size(), horizon);
+    EXPECT_EQ(out_traj.x, ans.x);
+    EXPECT_EQ(out_traj.y, ans.y);
+    EXPECT_EQ(out_traj.yaw, ans.yaw);
+    EXPECT_EQ(out_traj.vx, ans.vx);
+    EXPECT_EQ(out_traj.relative_time, ans.relative_time);
+  }
+
+  // the output is cleared when the interpolation fails
+  const auto out_of_range_times = makeResampleTimes(100.0, 0.1, horizon);
+  EXPECT_FALSE(MPCUtils::linearInterpMPCTrajectory(
+    in_traj.relative_time, in_traj, out_of_range_times, out_traj, weights));
+  EXPECT_TRUE(out_traj.empty());
+}
+
+TEST(TestMPCAllocation, ConvertToAutowareTrajectoryWithoutAllocation)
+{
+  const auto in_traj = makeCircularTrajectory(100);
+
+  Trajectory out_traj;
+  MPCUtils::convertToAutowareTrajectory(in_traj, out_traj);
+
+  // no allocation once the points have enough capacity
+  const auto shorter_traj = makeCircularTrajectory(80);
+  EXPECT_EQ(countAllocations([&]() {
+              MPCUtils::convertToAutowareTrajectory(in_traj, out_traj);
+              MPCUtils::convertToAutowareTrajectory(shorter_traj, out_traj);
+            }),
+            0u);
+
+  // same as the conversion to a new message
+  const auto ans = MPCUtils::convertToAutowareTrajectory(shorter_traj);
+  EXPECT_EQ(out_traj, ans);
+}
+
+TEST(TestMPCAllocation, ClipTrajectoryByLengthWithoutAllocation)
+{
+  const auto in_traj = makeCircularTrajectory(100);
+
+  MPCTrajectory out_traj;
+  MPCUtils::clipTrajectoryByLength(in_traj, 80.0, out_traj);
+
+  // no allocation once the buffer has enough capacity
+  EXPECT_EQ(countAllocations([&]() {
+              MPCUtils::clipTrajectoryByLength(in_traj, 50.0, out_traj);
+              MPCUtils::clipTrajectoryByLength(in_traj, 20.0, out_traj);
+            }),
+            0u);
+
+  // same as the clipping to a new trajectory
+  const auto ans = MPCUtils::clipTrajectoryByLength(in_traj, 20.0);
+  ASSERT_EQ(out_traj.size(), ans.size());
+  EXPECT_EQ(out_traj.x, ans.x);
+  EXPECT_EQ(out_traj.y, ans.y);
+  EXPECT_EQ(out_traj.relative_time, ans.relative_time);
+}
+}  // namespace
@@ -224,6 +224,10 @@ private:
   // debug values
   DebugValues m_debug_values;
 
+  // debug messages, which are reused over the control cycles to avoid reallocation
+  tier4_debug_msgs::msg::Float32MultiArrayStamped m_debug_msg;
+  tier4_debug_msgs::msg::Float32MultiArrayStamped m_slope_msg;
+
   std::shared_ptr<rclcpp::Time> m_last_running_time{std::make_shared<rclcpp::Time>(clock_->now())};
 
   // Diagnostic
@@ -842,19 +842,17 @@ void PidLongitudinalController::publishDebugData(
   m_debug_values.setValues(DebugValues::TYPE::ACC_CMD_PUBLISHED, ctrl_cmd.acc);
 
   // publish debug values
-  tier4_debug_msgs::msg::Float32MultiArrayStamped debug_msg{};
-  debug_msg.stamp = clock_->now();
-  for (const auto & v : m_debug_values.getValues()) {
-    debug_msg.data.push_back(static_cast<decltype(debug_msg.data)::value_type>(v));
-  }
-  m_pub_debug->publish(debug_msg);
+  // NOTE: the data is assigned to the member messages so that their buffers are reused.
+  const auto debug_values = m_debug_values.getValues();
+  m_debug_msg.stamp = clock_->now();
+  m_debug_msg.data.assign(debug_values.begin(), debug_values.end());
+  m_pub_debug->publish(m_debug_msg);
 
   // slope angle
-  tier4_debug_msgs::msg::Float32MultiArrayStamped slope_msg{};
-  slope_msg.stamp = clock_->now();
-  slope_msg.data.push_back(
-    static_cast<decltype(slope_msg.data)::value_type>(control_data.slope_angle));
-  m_pub_slope->publish(slope_msg);
+  m_slope_msg.stamp = clock_->now();
+  m_slope_msg.data.assign(
+    1, static_cast<decltype(m_slope_msg.data)::value_type>(control_data.slope_angle));
+  m_pub_slope->publish(m_slope_msg);
 }
 
 double PidLongitudinalController::getDt()
@@ -20,6 +20,7 @@
 #include "tree_structured_parzen_estimator/tree_structured_parzen_estimator.hpp"
 
 #include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/system/tracer.hpp>
 #include <tier4_autoware_utils/transform/transforms.hpp>
 
 #include <boost/math/special_functions/erf.hpp>
@@ -306,6 +307,7 @@ void NDTScanMatcher::callback_regularization_pose(
 void NDTScanMatcher::callback_sensor_points(
   sensor_msgs::msg::PointCloud2::ConstSharedPtr sensor_points_msg_in_sensor_frame)
 {
+  TIER4_TRACE_SCOPE("ndt_scan_matcher::callback_sensor_points");
   if (sensor_points_msg_in_sensor_frame->data.empty()) {
     RCLCPP_WARN_STREAM_THROTTLE(this->get_logger(), *this->get_clock(), 1, "Empty sensor points!");
     return;
@@ -374,7 +376,10 @@ void NDTScanMatcher::callback_sensor_points(
   const Eigen::Matrix4f initial_pose_matrix =
     pose_to_matrix4f(interpolation_result.interpolated_pose.pose.pose);
   auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
-  ndt_ptr_->align(*output_cloud, initial_pose_matrix);
+  {
+    TIER4_TRACE_SCOPE("ndt_scan_matcher::align");
+    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
+  }
   const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
 
   const geometry_msgs::msg::Pose result_pose_msg = matrix4f_to_pose(ndt_result.pose);
@@ -46,6 +46,7 @@ private:
   using MapProjectorInfo = map_interface::MapProjectorInfo;
 
   void on_map_projector_info(const MapProjectorInfo::Message::ConstSharedPtr msg);
+  void publish_map_bin(const HADMapBin & map_bin_msg);
 
   component_interface_utils::Subscription<MapProjectorInfo>::SharedPtr sub_map_projector_info_;
   rclcpp::Publisher<HADMapBin>::SharedPtr pub_map_bin_;
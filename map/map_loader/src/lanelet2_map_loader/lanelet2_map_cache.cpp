@@ -0,0 +1,206 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache.hpp"
+
+#include <boost/archive/basic_archive.hpp>
+#include <boost/version.hpp>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// defined by CMake with the versions of the lanelet2 packages
+#ifndef LANELET2_MAP_SERIALIZER_VERSION
+#define LANELET2_MAP_SERIALIZER_VERSION "unknown"
+#endif
+
+namespace
+{
+constexpr std::array<char, 8> magic{'L', '2', 'M', 'C', 'A', 'C', 'H', 'E'};
+
+// FNV-1a, which gives the same hash on every build unlike std::hash
+class Fnv1a
+{
+public:
+  void update(const void * data, const size_t size)
+  {
+    const auto * bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 1099511628211ULL;
+    }
+  }
+  void update(const std::string & str)
+  {
+    const uint64_t size = str.size();
+    update(&size, sizeof(size));
+    update(str.data(), str.size());
+  }
+  void update(const double value) { update(&value, sizeof(value)); }
+  uint64_t digest() const { return hash_; }
+
+private:
+  uint64_t hash_{14695981039346656037ULL};
+};
+
+template <class T>
+void write_value(std::ofstream & ofs, const T & value)
+{
+  ofs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <class T>
+bool read_value(std::ifstream & ifs, T & value)
+{
+  return static_cast<bool>(ifs.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+void write_string(std::ofstream & ofs, const std::string & str)
+{
+  write_value(ofs, static_cast<uint32_t>(str.size()));
+  ofs.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+bool read_string(std::ifstream & ifs, std::string & str)
+{
+  uint32_t size{};
+  if (!read_value(ifs, size)) {
+    return false;
+  }
+  str.resize(size);
+  return static_cast<bool>(ifs.read(str.data(), size));
+}
+}  // namespace
+
+std::string get_lanelet2_map_cache_path(const std::string & lanelet2_filename)
+{
+  return lanelet2_filename + ".cache";
+}
+
+std::string get_lanelet2_map_serializer_version()
+{
+  return std::string(LANELET2_MAP_SERIALIZER_VERSION) + "/boost-" + std::to_string(BOOST_VERSION) +
+         "/archive-" + std::to_string(boost::archive::BOOST_ARCHIVE_VERSION());
+}
+
+std::optional<uint64_t> compute_lanelet2_map_cache_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution, const std::string & serializer_version)
+{
+  std::ifstream ifs(lanelet2_filename, std::ios::binary);
+  if (!ifs) {
+    return std::nullopt;
+  }
+
+  Fnv1a hash;
+  std::vector<char> buffer(1 << 20);
+  while (ifs) {
+    ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    hash.update(buffer.data(), static_cast<size_t>(ifs.gcount()));
+  }
+
+  hash.update(projector_info.projector_type);
+  hash.update(projector_info.vertical_datum);
+  hash.update(projector_info.mgrs_grid);
+  hash.update(projector_info.map_origin.latitude);
+  hash.update(projector_info.map_origin.longitude);
+  hash.update(projector_info.map_origin.altitude);
+  hash.update(center_line_resolution);
+  hash.update(serializer_version);
+
+  return hash.digest();
+}
+
+std::optional<autoware_auto_mapping_msgs::msg::HADMapBin> load_lanelet2_map_cache(
+  const std::string & cache_filename, const uint64_t key)
+{
+  std::ifstream ifs(cache_filename, std::ios::binary);
+  if (!ifs) {
+    return std::nullopt;
+  }
+
+  std::array<char, 8> cache_magic{};
+  uint32_t cache_version{};
+  uint64_t cache_key{};
+  if (
+    !ifs.read(cache_magic.data(), cache_magic.size()) || cache_magic != magic ||
+    !read_value(ifs, cache_version) || cache_version != LANELET2_MAP_CACHE_VERSION ||
+    !read_value(ifs, cache_key) || cache_key != key) {
+    return std::nullopt;
+  }
+
+  autoware_auto_mapping_msgs::msg::HADMapBin map_bin_msg;
+  uint64_t data_size{};
+  if (
+    !read_string(ifs, map_bin_msg.format_version) || !read_string(ifs, map_bin_msg.map_version) ||
+    !read_value(ifs, data_size)) {
+    return std::nullopt;
+  }
+
+  // reject the truncated file before allocating the data
+  const auto data_begin = ifs.tellg();
+  ifs.seekg(0, std::ios::end);
+  if (static_cast<uint64_t>(ifs.tellg() - data_begin) != data_size) {
+    return std::nullopt;
+  }
+  ifs.seekg(data_begin);
+
+  map_bin_msg.data.resize(data_size);
+  if (!ifs.read(
+        reinterpret_cast<char *>(map_bin_msg.data.data()),
+        static_cast<std::streamsize>(data_size))) {
+    return std::nullopt;
+  }
+
+  map_bin_msg.header.frame_id = "map";
+  return map_bin_msg;
+}
+
+bool save_lanelet2_map_cache(
+  const std::string & cache_filename, const uint64_t key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg)
+{
+  // write to a temporary file and rename it so that the loader never reads a partial cache
+  const auto tmp_filename = cache_filename + ".tmp";
+  bool is_written = false;
+  {
+    std::ofstream ofs(tmp_filename, std::ios::binary | std::ios::trunc);
+    if (!ofs) {
+      return false;
+    }
+    ofs.write(magic.data(), magic.size());
+    write_value(ofs, LANELET2_MAP_CACHE_VERSION);
+    write_value(ofs, key);
+    write_string(ofs, map_bin_msg.format_version);
+    write_string(ofs, map_bin_msg.map_version);
+    write_value(ofs, static_cast<uint64_t>(map_bin_msg.data.size()));
+    ofs.write(
+      reinterpret_cast<const char *>(map_bin_msg.data.data()),
+      static_cast<std::streamsize>(map_bin_msg.data.size()));
+    ofs.close();
+    is_written = !ofs.fail();
+  }
+
+  std::error_code ec;
+  if (is_written) {
+    std::filesystem::rename(tmp_filename, cache_filename, ec);
+  }
+  if (!is_written || ec) {
+    std::filesystem::remove(tmp_filename, ec);
+    return false;
+  }
+  return true;
+}
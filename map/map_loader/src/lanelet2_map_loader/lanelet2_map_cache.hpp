@@ -0,0 +1,60 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+#include <tier4_map_msgs/msg/map_projector_info.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+// The lanelet2 map cache stores the HADMapBin data of the projected map with the key of the
+// source .osm file so that the map loader can publish it without parsing the .osm file.
+//
+// layout (little endian):
+//   char[8]   magic "L2MCACHE"
+//   uint32    cache format version
+//   uint64    key
+//   uint32    size + char[]  format_version
+//   uint32    size + char[]  map_version
+//   uint64    size + uint8[] serialized lanelet map (HADMapBin::data)
+
+constexpr uint32_t LANELET2_MAP_CACHE_VERSION = 1;
+
+// <lanelet2_map_path>.cache
+std::string get_lanelet2_map_cache_path(const std::string & lanelet2_filename);
+
+// versions of lanelet2 and boost serialization, which the serialized map depends on
+std::string get_lanelet2_map_serializer_version();
+
+// hash of the .osm file contents, the projector info, the center line resolution and the
+// serializer version, so that the cache built by another version of lanelet2 is not loaded
+std::optional<uint64_t> compute_lanelet2_map_cache_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution,
+  const std::string & serializer_version = get_lanelet2_map_serializer_version());
+
+// return std::nullopt if the cache does not exist, is broken, or is built with a different key
+std::optional<autoware_auto_mapping_msgs::msg::HADMapBin> load_lanelet2_map_cache(
+  const std::string & cache_filename, const uint64_t key);
+
+bool save_lanelet2_map_cache(
+  const std::string & cache_filename, const uint64_t key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg);
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
@@ -0,0 +1,71 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Build the lanelet2 map cache offline so that the first launch of lanelet2_map_loader also skips
+// parsing the .osm file.
+//
+// usage: lanelet2_map_cache_builder <lanelet2_map.osm> <map_projector_info.yaml>
+//                                   [center_line_resolution]
+
+#include "lanelet2_map_cache.hpp"
+#include "map_loader/lanelet2_map_loader_node.hpp"
+
+#include <lanelet2_extension/utility/utilities.hpp>
+#include <map_projection_loader/map_projection_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char ** argv)
+{
+  if (argc < 3) {
+    std::cerr << "usage: " << argv[0]
+              << " <lanelet2_map.osm> <map_projector_info.yaml> [center_line_resolution]"
+              << std::endl;
+    return 1;
+  }
+
+  const std::string lanelet2_filename = argv[1];
+  const std::string projector_info_filename = argv[2];
+  // same as the default of config/lanelet2_map_loader.param.yaml
+  const double center_line_resolution = argc > 3 ? std::stod(argv[3]) : 5.0;
+
+  const auto projector_info = load_map_projector_info(projector_info_filename, lanelet2_filename);
+  const auto cache_key =
+    compute_lanelet2_map_cache_key(lanelet2_filename, projector_info, center_line_resolution);
+  if (!cache_key) {
+    std::cerr << "Failed to read " << lanelet2_filename << std::endl;
+    return 1;
+  }
+
+  const auto map = Lanelet2MapLoaderNode::load_map(lanelet2_filename, projector_info);
+  if (!map) {
+    std::cerr << "Failed to load " << lanelet2_filename << std::endl;
+    return 1;
+  }
+  lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
+
+  const auto map_bin_msg =
+    Lanelet2MapLoaderNode::create_map_bin_msg(map, lanelet2_filename, rclcpp::Time(0, 0));
+
+  const auto cache_filename = get_lanelet2_map_cache_path(lanelet2_filename);
+  if (!save_lanelet2_map_cache(cache_filename, *cache_key, map_bin_msg)) {
+    std::cerr << "Failed to save " << cache_filename << std::endl;
+    return 1;
+  }
+
+  std::cout << "Saved " << cache_filename << std::endl;
+  return 0;
+}
@@ -34,6 +34,7 @@
 #include "map_loader/lanelet2_map_loader_node.hpp"
 
 #include "lanelet2_local_projector.hpp"
+#include "lanelet2_map_cache.hpp"
 
 #include <ament_index_cpp/get_package_prefix.hpp>
 #include <geography_utils/lanelet2_projector.hpp>
@@ -49,6 +50,7 @@
 #include <lanelet2_io/Io.h>
 #include <lanelet2_projection/UTM.h>
 
+#include <optional>
 #include <string>
 
 Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options)
@@ -63,6 +65,7 @@ Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options
 
   declare_parameter<std::string>("lanelet2_map_path");
   declare_parameter<double>("center_line_resolution");
+  declare_parameter<bool>("use_lanelet2_map_cache");
 }
 
 void Lanelet2MapLoaderNode::on_map_projector_info(
@@ -70,6 +73,27 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
 {
   const auto lanelet2_filename = get_parameter("lanelet2_map_path").as_string();
   const auto center_line_resolution = get_parameter("center_line_resolution").as_double();
+  const auto use_lanelet2_map_cache = get_parameter("use_lanelet2_map_cache").as_bool();
+
+  // load the projected map from the cache if it is built from the same file and projection
+  const auto cache_filename = get_lanelet2_map_cache_path(lanelet2_filename);
+  const auto cache_key =
+    use_lanelet2_map_cache
+      ? compute_lanelet2_map_cache_key(lanelet2_filename, *msg, center_line_resolution)
+      : std::nullopt;
+  if (cache_key) {
+    if (auto cached_map_bin_msg = load_lanelet2_map_cache(cache_filename, *cache_key)) {
+      cached_map_bin_msg->header.stamp = now();
+      publish_map_bin(*cached_map_bin_msg);
+      RCLCPP_INFO(
+        get_logger(), "Succeeded to load lanelet2_map from the cache %s. Map is published.",
+        cache_filename.c_str());
+      return;
+    }
+    RCLCPP_INFO(
+      get_logger(), "The cache %s is not found or outdated. Load the map from the file.",
+      cache_filename.c_str());
+  }
 
   // load map from file
   const auto map = load_map(lanelet2_filename, *msg);
@@ -84,11 +108,20 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
   // create map bin msg
   const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
 
+  publish_map_bin(map_bin_msg);
+  RCLCPP_INFO(get_logger(), "Succeeded to load lanelet2_map. Map is published.");
+
+  if (cache_key && !save_lanelet2_map_cache(cache_filename, *cache_key, map_bin_msg)) {
+    RCLCPP_WARN(get_logger(), "Failed to save the lanelet2_map cache %s.", cache_filename.c_str());
+  }
+}
+
+void Lanelet2MapLoaderNode::publish_map_bin(const HADMapBin & map_bin_msg)
+{
   // create publisher and publish
   pub_map_bin_ =
     create_publisher<HADMapBin>("output/lanelet2_map", rclcpp::QoS{1}.transient_local());
   pub_map_bin_->publish(map_bin_msg);
-  RCLCPP_INFO(get_logger(), "Succeeded to load lanelet2_map. Map is published.");
 }
 
 lanelet::LaneletMapPtr Lanelet2MapLoaderNode::load_map(
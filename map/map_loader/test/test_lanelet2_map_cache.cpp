@@ -0,0 +1,117 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_map_cache.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+class TestLanelet2MapCache : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    dir_ = fs::temp_directory_path() / "test_lanelet2_map_cache";
+    fs::create_directories(dir_);
+    osm_path_ = (dir_ / "lanelet2_map.osm").string();
+    write_osm("<osm version=\"0.6\"></osm>");
+
+    projector_info_.projector_type = tier4_map_msgs::msg::MapProjectorInfo::MGRS;
+    projector_info_.vertical_datum = tier4_map_msgs::msg::MapProjectorInfo::WGS84;
+    projector_info_.mgrs_grid = "54SUE";
+
+    map_bin_msg_.format_version = "1.0";
+    map_bin_msg_.map_version = "test";
+    map_bin_msg_.data = {0, 1, 2, 3, 4, 5, 6, 7};
+  }
+
+  void TearDown() override { fs::remove_all(dir_); }
+
+  void write_osm(const std::string & contents) const
+  {
+    std::ofstream ofs(osm_path_);
+    ofs << contents;
+  }
+
+  fs::path dir_;
+  std::string osm_path_;
+  tier4_map_msgs::msg::MapProjectorInfo projector_info_;
+  autoware_auto_mapping_msgs::msg::HADMapBin map_bin_msg_;
+};
+
+TEST_F(TestLanelet2MapCache, SaveAndLoad)
+{
+  const auto key = compute_lanelet2_map_cache_key(osm_path_, projector_info_, 5.0);
+  ASSERT_TRUE(key.has_value());
+
+  const auto cache_path = get_lanelet2_map_cache_path(osm_path_);
+  ASSERT_TRUE(save_lanelet2_map_cache(cache_path, *key, map_bin_msg_));
+
+  const auto loaded = load_lanelet2_map_cache(cache_path, *key);
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->format_version, map_bin_msg_.format_version);
+  EXPECT_EQ(loaded->map_version, map_bin_msg_.map_version);
+  EXPECT_THAT(loaded->data, ::testing::ContainerEq(map_bin_msg_.data));
+  EXPECT_EQ(loaded->header.frame_id, "map");
+}
+
+TEST_F(TestLanelet2MapCache, KeyChangesWithSource)
+{
+  const auto key = compute_lanelet2_map_cache_key(osm_path_, projector_info_, 5.0);
+  ASSERT_TRUE(key.has_value());
+
+  EXPECT_NE(key, compute_lanelet2_map_cache_key(osm_path_, projector_info_, 1.0));
+
+  auto other_projector_info = projector_info_;
+  other_projector_info.mgrs_grid = "53SPU";
+  EXPECT_NE(key, compute_lanelet2_map_cache_key(osm_path_, other_projector_info, 5.0));
+
+  // the cache built by another version of lanelet2 is not loaded
+  EXPECT_NE(
+    key, compute_lanelet2_map_cache_key(
+           osm_path_, projector_info_, 5.0, get_lanelet2_map_serializer_version() + "-other"));
+
+  write_osm("<osm version=\"0.6\"><node id=\"1\"/></osm>");
+  EXPECT_NE(key, compute_lanelet2_map_cache_key(osm_path_, projector_info_, 5.0));
+
+  EXPECT_FALSE(compute_lanelet2_map_cache_key(
+                 (dir_ / "not_exist.osm").string(), projector_info_, 5.0)
+                 .has_value());
+}
+
+TEST_F(TestLanelet2MapCache, RejectInvalidCache)
+{
+  const auto key = *compute_lanelet2_map_cache_key(osm_path_, projector_info_, 5.0);
+  const auto cache_path = get_lanelet2_map_cache_path(osm_path_);
+
+  // not exist
+  EXPECT_FALSE(load_lanelet2_map_cache(cache_path, key).has_value());
+
+  // outdated
+  ASSERT_TRUE(save_lanelet2_map_cache(cache_path, key, map_bin_msg_));
+  EXPECT_FALSE(load_lanelet2_map_cache(cache_path, key + 1).has_value());
+
+  // truncated
+  fs::resize_file(cache_path, fs::file_size(cache_path) - 1);
+  EXPECT_FALSE(load_lanelet2_map_cache(cache_path, key).has_value());
+
+  // not a cache file
+  EXPECT_FALSE(load_lanelet2_map_cache(osm_path_, key).has_value());
+}
@@ -33,6 +33,8 @@
 #include "multi_object_tracker/utils/utils.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
+#include <tier4_autoware_utils/system/tracer.hpp>
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include <rclcpp_components/register_node_macro.hpp>
@@ -241,6 +243,7 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
 void MultiObjectTracker::onMeasurement(
   const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_objects_msg)
 {
+  TIER4_TRACE_SCOPE("multi_object_tracker::onMeasurement");
   /* keep the latest input stamp and check transform*/
   debugger_->startMeasurementTime(rclcpp::Time(input_objects_msg->header.stamp));
   const auto self_transform = getTransformAnonymous(
@@ -263,9 +266,12 @@ void MultiObjectTracker::onMeasurement(
 
   /* global nearest neighbor */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
-  Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
-    transformed_objects, list_tracker_);  // row : tracker, col : measurement
-  data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  {
+    TIER4_TRACE_SCOPE("multi_object_tracker::dataAssociation");
+    Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
+      transformed_objects, list_tracker_);  // row : tracker, col : measurement
+    data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  }
 
   /* tracker measurement update */
   int tracker_idx = 0;
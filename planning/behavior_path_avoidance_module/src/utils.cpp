@@ -1961,7 +1961,7 @@ std::vector<ExtendedPredictedObject> getSafetyCheckTargetObjects(
 
   const auto append = [&](const auto & objects) {
     std::for_each(objects.objects.begin(), objects.objects.end(), [&](const auto & object) {
-      target_objects.push_back(utils::path_safety_checker::transform(
+      target_objects.push_back(planner_data->getExtendedPredictedObject(
         object, time_horizon, parameters->ego_predicted_path_params.time_resolution));
     });
   };
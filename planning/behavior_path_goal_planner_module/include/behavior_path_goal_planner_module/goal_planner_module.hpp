@@ -27,6 +27,7 @@
 #include "behavior_path_planner_common/utils/parking_departure/geometric_parallel_parking.hpp"
 #include "behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
 #include "behavior_path_planner_common/utils/utils.hpp"
+#include "tier4_autoware_utils/system/thread_pool.hpp"
 
 #include <freespace_planning_algorithms/astar_search.hpp>
 #include <freespace_planning_algorithms/rrtstar.hpp>
@@ -294,6 +295,7 @@ public:
 
   ~GoalPlannerModule()
   {
+    is_lane_parking_cancelled_.store(true);
     if (lane_parking_timer_) {
       lane_parking_timer_->cancel();
     }
@@ -447,6 +449,11 @@ private:
   rclcpp::TimerBase::SharedPtr lane_parking_timer_;
   rclcpp::CallbackGroup::SharedPtr lane_parking_timer_cb_group_;
   std::atomic<bool> is_lane_parking_cb_running_;
+  // set when the module exits to stop generating the lane parking paths
+  std::atomic<bool> is_lane_parking_cancelled_{false};
+  // generate lane parking paths for each goal candidate and planner in parallel
+  std::vector<std::vector<std::shared_ptr<PullOverPlannerBase>>> worker_pull_over_planners_;
+  std::unique_ptr<tier4_autoware_utils::ThreadPool> lane_parking_thread_pool_;
 
   // generate freespace parking paths in a separate thread
   rclcpp::TimerBase::SharedPtr freespace_parking_timer_;
@@ -18,13 +18,25 @@
 #include "behavior_path_goal_planner_module/goal_searcher_base.hpp"
 #include "behavior_path_planner_common/utils/occupancy_grid_based_collision_detector/occupancy_grid_based_collision_detector.hpp"
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace behavior_path_planner
 {
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using BasicPolygons2d = std::vector<lanelet::BasicPolygon2d>;
+// bounding box of the footprint and the id of the goal candidate
+using GoalFootprintRtree =
+  boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
 
 class GoalSearcher : public GoalSearcherBase
 {
@@ -50,6 +62,14 @@ private:
   bool checkCollision(const Pose & pose, const PredictedObjects & objects) const;
   bool checkCollisionWithLongitudinalDistance(
     const Pose & ego_pose, const PredictedObjects & objects) const;
+  bool isSafeGoal(const Pose & goal_pose, const PredictedObjects & objects) const;
+  /**
+   * @brief Find the goal candidates which can be affected by the objects added, moved or removed
+   *        since the last update.
+   * @return ids of the goal candidates to be re-evaluated. std::nullopt if all of them need to be.
+   */
+  std::optional<std::unordered_set<size_t>> findGoalIdsToUpdate(
+    const GoalCandidates & goal_candidates, const PredictedObjects & objects) const;
   BasicPolygons2d getNoParkingAreaPolygons(const lanelet::ConstLanelets & lanes) const;
   BasicPolygons2d getNoStoppingAreaPolygons(const lanelet::ConstLanelets & lanes) const;
   bool isInAreas(const LinearRing2d & footprint, const BasicPolygons2d & areas) const;
@@ -57,6 +77,14 @@ private:
   LinearRing2d vehicle_footprint_{};
   std::shared_ptr<OccupancyGridBasedCollisionDetector> occupancy_grid_map_{};
   bool left_side_parking_{true};
+
+  // footprints of the goal candidates generated in search()
+  GoalFootprintRtree goal_footprint_rtree_{};
+
+  // objects and safety of the goal candidates in the last update to update them incrementally
+  mutable std::mutex update_mutex_;
+  mutable std::unordered_map<std::string, PredictedObject> prev_objects_{};
+  mutable std::unordered_map<size_t, bool> prev_is_safe_{};
 };
 }  // namespace behavior_path_planner
 
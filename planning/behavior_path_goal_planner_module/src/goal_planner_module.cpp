@@ -24,6 +24,7 @@
 #include "behavior_path_planner_common/utils/utils.hpp"
 #include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
 #include "tier4_autoware_utils/math/unit_conversion.hpp"
+#include "tier4_autoware_utils/system/stop_watch.hpp"
 
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/query.hpp>
@@ -33,6 +34,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -76,23 +78,39 @@ GoalPlannerModule::GoalPlannerModule(
   // planner when goal modification is not allowed
   fixed_goal_planner_ = std::make_unique<DefaultFixedGoalPlanner>();
 
-  for (const std::string & planner_type : parameters_->efficient_path_order) {
-    if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
-      pull_over_planners_.push_back(std::make_shared<ShiftPullOver>(
-        node, *parameters, lane_departure_checker, occupancy_grid_map_));
-    } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, occupancy_grid_map_, /*is_forward*/ true));
-    } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
-      pull_over_planners_.push_back(std::make_shared<GeometricPullOver>(
-        node, *parameters, lane_departure_checker, occupancy_grid_map_, /*is_forward*/ false));
+  const auto create_pull_over_planners = [&]() {
+    std::vector<std::shared_ptr<PullOverPlannerBase>> planners{};
+    for (const std::string & planner_type : parameters_->efficient_path_order) {
+      if (planner_type == "SHIFT" && parameters_->enable_shift_parking) {
+        planners.push_back(std::make_shared<ShiftPullOver>(
+          node, *parameters, lane_departure_checker, occupancy_grid_map_));
+      } else if (planner_type == "ARC_FORWARD" && parameters_->enable_arc_forward_parking) {
+        planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, occupancy_grid_map_, /*is_forward*/ true));
+      } else if (planner_type == "ARC_BACKWARD" && parameters_->enable_arc_backward_parking) {
+        planners.push_back(std::make_shared<GeometricPullOver>(
+          node, *parameters, lane_departure_checker, occupancy_grid_map_, /*is_forward*/ false));
+      }
     }
-  }
+    return planners;
+  };
+
+  pull_over_planners_ = create_pull_over_planners();
 
   if (pull_over_planners_.empty()) {
     RCLCPP_ERROR(getLogger(), "Not found enabled planner");
   }
 
+  // the planners have internal states, so each worker thread has its own planners
+  if (parameters_->candidate_generation_thread_num > 0) {
+    const auto thread_num = static_cast<size_t>(parameters_->candidate_generation_thread_num);
+    worker_pull_over_planners_.push_back(pull_over_planners_);
+    for (size_t i = 1; i < thread_num; ++i) {
+      worker_pull_over_planners_.push_back(create_pull_over_planners());
+    }
+    lane_parking_thread_pool_ = std::make_unique<tier4_autoware_utils::ThreadPool>(thread_num);
+  }
+
   // set selected goal searcher
   // currently there is only one goal_searcher_type
   const auto vehicle_info = vehicle_info_util::VehicleInfoUtil(node).getVehicleInfo();
@@ -178,6 +196,7 @@ void GoalPlannerModule::onTimer()
   if (getCurrentStatus() == ModuleStatus::IDLE) {
     return;
   }
+  is_lane_parking_cancelled_.store(false);
 
   // goals are not yet available.
   if (thread_safe_data_.get_goal_candidates().empty()) {
@@ -211,36 +230,23 @@ void GoalPlannerModule::onTimer()
     return;
   }
 
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+
+  const auto planner_data = planner_data_;
   const auto previous_module_output = getPreviousModuleOutput();
   const auto goal_candidates = thread_safe_data_.get_goal_candidates();
 
   // generate valid pull over path candidates and calculate closest start pose
   const auto current_lanes = utils::getExtendedCurrentLanes(
-    planner_data_, parameters_->backward_goal_search_length,
+    planner_data, parameters_->backward_goal_search_length,
     parameters_->forward_goal_search_length,
     /*forward_only_in_route*/ false);
-  std::vector<PullOverPath> path_candidates{};
-  std::optional<Pose> closest_start_pose{};
-  double min_start_arc_length = std::numeric_limits<double>::max();
+
+  // pairs of the planner index and the goal candidate in the priority order
+  std::vector<std::pair<size_t, GoalCandidate>> planning_jobs{};
   const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    planner->setPlannerData(planner_data_);
-    planner->setPreviousModuleOutput(previous_module_output);
-    auto pull_over_path = planner->plan(goal_candidate.goal_pose);
-    if (pull_over_path) {
-      pull_over_path->goal_id = goal_candidate.id;
-      pull_over_path->id = path_candidates.size();
-      path_candidates.push_back(*pull_over_path);
-      // calculate closest pull over start pose for stop path
-      const double start_arc_length =
-        lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose).length;
-      if (start_arc_length < min_start_arc_length) {
-        min_start_arc_length = start_arc_length;
-        // closest start pose is stop point when not finding safe path
-        closest_start_pose = pull_over_path->start_pose;
-      }
-    }
+                                    const size_t planner_idx, const GoalCandidate & goal_candidate) {
+    planning_jobs.emplace_back(planner_idx, goal_candidate);
   };
 
   // todo: currently non centerline input path is supported only by shift pull over
@@ -252,23 +258,25 @@ void GoalPlannerModule::onTimer()
 
   // plan candidate paths and set them to the member variable
   if (parameters_->path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
+    for (size_t i = 0; i < pull_over_planners_.size(); ++i) {
+      const auto & planner = pull_over_planners_.at(i);
       // todo: temporary skip NON SHIFT planner when input path is not center line
       if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
         continue;
       }
       for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+        planCandidatePaths(i, goal_candidate);
       }
     }
   } else if (parameters_->path_priority == "close_goal") {
     for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
+      for (size_t i = 0; i < pull_over_planners_.size(); ++i) {
+        const auto & planner = pull_over_planners_.at(i);
         // todo: temporary skip NON SHIFT planner when input path is not center line
         if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
           continue;
         }
-        planCandidatePaths(planner, goal_candidate);
+        planCandidatePaths(i, goal_candidate);
       }
     }
   } else {
@@ -278,12 +286,82 @@ void GoalPlannerModule::onTimer()
     throw std::domain_error("[pull_over] invalid path_priority");
   }
 
+  // plan the jobs. in parallel planning, the jobs are distributed to the workers in turn and each
+  // worker uses its own planners.
+  std::vector<std::optional<PullOverPath>> planned_paths(planning_jobs.size());
+  std::vector<double> planning_times(planning_jobs.size(), 0.0);
+  const auto plan = [&](
+                      const std::vector<std::shared_ptr<PullOverPlannerBase>> & planners,
+                      const size_t job_idx) {
+    if (is_lane_parking_cancelled_.load()) {
+      return;
+    }
+    tier4_autoware_utils::StopWatch<std::chrono::milliseconds> job_stop_watch;
+    const auto & [planner_idx, goal_candidate] = planning_jobs.at(job_idx);
+    const auto & planner = planners.at(planner_idx);
+    planner->setPlannerData(planner_data);
+    planner->setPreviousModuleOutput(previous_module_output);
+    planned_paths.at(job_idx) = planner->plan(goal_candidate.goal_pose);
+    planning_times.at(job_idx) = job_stop_watch.toc();
+  };
+  if (lane_parking_thread_pool_) {
+    const size_t worker_num = worker_pull_over_planners_.size();
+    lane_parking_thread_pool_->parallelFor(worker_num, [&](const size_t worker_idx) {
+      for (size_t i = worker_idx; i < planning_jobs.size(); i += worker_num) {
+        plan(worker_pull_over_planners_.at(worker_idx), i);
+      }
+    });
+  } else {
+    for (size_t i = 0; i < planning_jobs.size(); ++i) {
+      plan(pull_over_planners_, i);
+    }
+  }
+
+  if (is_lane_parking_cancelled_.load()) {
+    RCLCPP_INFO(getLogger(), "pull over path candidates generation is cancelled");
+    return;
+  }
+
+  // collect the planned paths in the priority order
+  std::vector<PullOverPath> path_candidates{};
+  std::optional<Pose> closest_start_pose{};
+  double min_start_arc_length = std::numeric_limits<double>::max();
+  std::map<PullOverPlannerType, double> planning_time_by_type{};
+  for (size_t i = 0; i < planning_jobs.size(); ++i) {
+    const auto & [planner_idx, goal_candidate] = planning_jobs.at(i);
+    planning_time_by_type[pull_over_planners_.at(planner_idx)->getPlannerType()] +=
+      planning_times.at(i);
+
+    auto & pull_over_path = planned_paths.at(i);
+    if (!pull_over_path) {
+      continue;
+    }
+    pull_over_path->goal_id = goal_candidate.id;
+    pull_over_path->id = path_candidates.size();
+    path_candidates.push_back(*pull_over_path);
+    // calculate closest pull over start pose for stop path
+    const double start_arc_length =
+      lanelet::utils::getArcCoordinates(current_lanes, pull_over_path->start_pose).length;
+    if (start_arc_length < min_start_arc_length) {
+      min_start_arc_length = start_arc_length;
+      // closest start pose is stop point when not finding safe path
+      closest_start_pose = pull_over_path->start_pose;
+    }
+  }
+
   // set member variables
   {
     const std::lock_guard<std::recursive_mutex> lock(mutex_);
     thread_safe_data_.set_pull_over_path_candidates(path_candidates);
     thread_safe_data_.set_closest_start_pose(closest_start_pose);
-    RCLCPP_INFO(getLogger(), "generated %lu pull over path candidates", path_candidates.size());
+    RCLCPP_INFO(
+      getLogger(), "generated %lu pull over path candidates from %lu jobs in %.1f [ms]",
+      path_candidates.size(), planning_jobs.size(), stop_watch.toc());
+  }
+  for (const auto & [type, time] : planning_time_by_type) {
+    RCLCPP_DEBUG(
+      getLogger(), "total planning time of %s: %.1f [ms]",
+      magic_enum::enum_name(type).data(), time);
   }
 
   last_previous_module_output_ = previous_module_output;
@@ -412,6 +490,9 @@ void GoalPlannerModule::initializeSafetyCheckParameters()
 
 void GoalPlannerModule::processOnExit()
 {
+  // stop generating the pull over path candidates which are no longer used
+  is_lane_parking_cancelled_.store(true);
+
   resetPathCandidate();
   resetPathReference();
   debug_marker_.markers.clear();
@@ -1942,6 +2023,7 @@ void GoalPlannerModule::updateSafetyCheckTargetObjectsData(
 }
 
 static std::vector<utils::path_safety_checker::ExtendedPredictedObject> filterObjectsByWithinPolicy(
+  const std::shared_ptr<const PlannerData> & planner_data,
   const std::shared_ptr<const PredictedObjects> & objects,
   const lanelet::ConstLanelets & target_lanes,
   const std::shared_ptr<behavior_path_planner::utils::path_safety_checker::ObjectsFilteringParams> &
@@ -1979,7 +2061,7 @@ static std::vector<utils::path_safety_checker::ExtendedPredictedObject> filterOb
 
   std::vector<utils::path_safety_checker::ExtendedPredictedObject> refined_filtered_objects;
   for (const auto & within_filtered_object : within_filtered_objects) {
-    refined_filtered_objects.push_back(utils::path_safety_checker::transform(
+    refined_filtered_objects.push_back(planner_data->getExtendedPredictedObject(
       within_filtered_object, safety_check_time_horizon, safety_check_time_resolution));
   }
   return refined_filtered_objects;
@@ -2069,7 +2151,7 @@ std::pair<bool, bool> GoalPlannerModule::isSafePath() const
   debug_data_.expanded_pull_over_lane_between_ego = merged_expanded_pull_over_lanes;
 
   const auto filtered_objects = filterObjectsByWithinPolicy(
-    dynamic_object, {merged_expanded_pull_over_lanes}, objects_filtering_params_);
+    planner_data_, dynamic_object, {merged_expanded_pull_over_lanes}, objects_filtering_params_);
 
   const double hysteresis_factor =
     prev_data_.safety_status.is_safe ? 1.0 : parameters_->hysteresis_factor_expand_rate;
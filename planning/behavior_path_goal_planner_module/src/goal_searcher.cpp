@@ -22,12 +22,20 @@
 #include "lanelet2_extension/regulatory_elements/no_stopping_area.hpp"
 #include "lanelet2_extension/utility/utilities.hpp"
 #include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
+#include "tier4_autoware_utils/ros/uuid_helper.hpp"
 
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/union.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace behavior_path_planner
@@ -130,7 +138,11 @@ GoalCandidates GoalSearcher::search()
     route_handler->getCenterLinePath(pull_over_lanes, s_start, s_end),
     parameters_.goal_search_interval);
 
+  const auto no_parking_area_polygons = getNoParkingAreaPolygons(pull_over_lanes);
+  const auto no_stopping_area_polygons = getNoStoppingAreaPolygons(pull_over_lanes);
+
   std::vector<Pose> original_search_poses{};  // for search area visualizing
+  std::vector<std::pair<Box2d, size_t>> goal_footprint_boxes{};
   size_t goal_id = 0;
   for (const auto & p : center_line_path.points) {
     // todo(kosuke55): fix orientation for inverseTransformPoint temporarily
@@ -169,12 +181,12 @@ GoalCandidates GoalSearcher::search()
       const auto transformed_vehicle_footprint =
         transformVector(vehicle_footprint_, tier4_autoware_utils::pose2transform(search_pose));
 
-      if (isInAreas(transformed_vehicle_footprint, getNoParkingAreaPolygons(pull_over_lanes))) {
+      if (isInAreas(transformed_vehicle_footprint, no_parking_area_polygons)) {
         // break here to exclude goals located laterally in no_parking_areas
         break;
       }
 
-      if (isInAreas(transformed_vehicle_footprint, getNoStoppingAreaPolygons(pull_over_lanes))) {
+      if (isInAreas(transformed_vehicle_footprint, no_stopping_area_polygons)) {
         // break here to exclude goals located laterally in no_stopping_areas
         break;
       }
@@ -191,10 +203,22 @@ GoalCandidates GoalSearcher::search()
       // use longitudinal_distance as distance_from_original_goal
       goal_candidate.distance_from_original_goal = longitudinal_distance_from_original_goal;
       goal_candidates.push_back(goal_candidate);
+
+      Box2d footprint_box{};
+      boost::geometry::envelope(transformed_vehicle_footprint, footprint_box);
+      goal_footprint_boxes.emplace_back(footprint_box, goal_candidate.id);
     }
   }
   createAreaPolygons(original_search_poses);
 
+  goal_footprint_rtree_ = GoalFootprintRtree(goal_footprint_boxes);
+  {
+    // evaluate all the new goal candidates in update()
+    const std::lock_guard<std::mutex> lock(update_mutex_);
+    prev_objects_.clear();
+    prev_is_safe_.clear();
+  }
+
   update(goal_candidates);
 
   return goal_candidates;
@@ -288,28 +312,113 @@ void GoalSearcher::update(GoalCandidates & goal_candidates) const
       SortByLongitudinalDistance(parameters_.prioritize_goals_before_objects));
   }
 
-  // update is_safe
+  // update is_safe of the goal candidates near the changed objects and reuse the others
+  const std::lock_guard<std::mutex> lock(update_mutex_);
+  const auto goal_ids_to_update = findGoalIdsToUpdate(goal_candidates, pull_over_lane_stop_objects);
   for (auto & goal_candidate : goal_candidates) {
-    const Pose goal_pose = goal_candidate.goal_pose;
-
-    // check collision with footprint
-    if (checkCollision(goal_pose, pull_over_lane_stop_objects)) {
-      goal_candidate.is_safe = false;
+    if (goal_ids_to_update && goal_ids_to_update->count(goal_candidate.id) == 0) {
+      goal_candidate.is_safe = prev_is_safe_.at(goal_candidate.id);
       continue;
     }
+    goal_candidate.is_safe = isSafeGoal(goal_candidate.goal_pose, pull_over_lane_stop_objects);
+  }
 
-    // check longitudinal margin with pull over lane objects
-    constexpr bool filter_inside = true;
-    const auto target_objects = goal_planner_utils::filterObjectsByLateralDistance(
-      goal_pose, planner_data_->parameters.vehicle_width, pull_over_lane_stop_objects,
-      parameters_.object_recognition_collision_check_hard_margins.back(), filter_inside);
-    if (checkCollisionWithLongitudinalDistance(goal_pose, target_objects)) {
-      goal_candidate.is_safe = false;
-      continue;
+  prev_is_safe_.clear();
+  for (const auto & goal_candidate : goal_candidates) {
+    prev_is_safe_.emplace(goal_candidate.id, goal_candidate.is_safe);
+  }
+  prev_objects_.clear();
+  for (const auto & object : pull_over_lane_stop_objects.objects) {
+    prev_objects_.emplace(tier4_autoware_utils::toHexString(object.object_id), object);
+  }
+}
+
+bool GoalSearcher::isSafeGoal(const Pose & goal_pose, const PredictedObjects & objects) const
+{
+  // check collision with footprint
+  if (checkCollision(goal_pose, objects)) {
+    return false;
+  }
+
+  // check longitudinal margin with pull over lane objects
+  constexpr bool filter_inside = true;
+  const auto target_objects = goal_planner_utils::filterObjectsByLateralDistance(
+    goal_pose, planner_data_->parameters.vehicle_width, objects,
+    parameters_.object_recognition_collision_check_hard_margins.back(), filter_inside);
+  if (checkCollisionWithLongitudinalDistance(goal_pose, target_objects)) {
+    return false;
+  }
+
+  return true;
+}
+
+std::optional<std::unordered_set<size_t>> GoalSearcher::findGoalIdsToUpdate(
+  const GoalCandidates & goal_candidates, const PredictedObjects & objects) const
+{
+  // the occupancy grid can change anywhere
+  if (parameters_.use_occupancy_grid_for_goal_search) {
+    return std::nullopt;
+  }
+
+  // the goal candidates which are not evaluated yet
+  const bool has_new_goal = std::any_of(
+    goal_candidates.begin(), goal_candidates.end(),
+    [&](const auto & goal_candidate) { return prev_is_safe_.count(goal_candidate.id) == 0; });
+  if (has_new_goal || goal_footprint_rtree_.empty()) {
+    return std::nullopt;
+  }
+
+  // an object affects the goal candidates whose footprint is within the collision margin or the
+  // longitudinal margin from it. the margin is expanded by the object size since the lateral and
+  // longitudinal distances are calculated with different points of the object.
+  const double margin = parameters_.object_recognition_collision_check_hard_margins.back() +
+                        parameters_.longitudinal_margin;
+  std::unordered_set<size_t> goal_ids_to_update{};
+  const auto add_goals_near_object = [&](const PredictedObject & object) {
+    Box2d object_box{};
+    boost::geometry::envelope(tier4_autoware_utils::toPolygon2d(object), object_box);
+    const double object_size =
+      boost::geometry::distance(object_box.min_corner(), object_box.max_corner());
+    const double expand_length = margin + object_size;
+    const Box2d query_box{
+      {object_box.min_corner().x() - expand_length, object_box.min_corner().y() - expand_length},
+      {object_box.max_corner().x() + expand_length, object_box.max_corner().y() + expand_length}};
+    std::vector<std::pair<Box2d, size_t>> goals_near_object{};
+    goal_footprint_rtree_.query(
+      boost::geometry::index::intersects(query_box), std::back_inserter(goals_near_object));
+    for (const auto & [box, goal_id] : goals_near_object) {
+      goal_ids_to_update.insert(goal_id);
     }
+  };
+
+  const auto is_same_object = [](const PredictedObject & a, const PredictedObject & b) {
+    return a.kinematics.initial_pose_with_covariance.pose ==
+             b.kinematics.initial_pose_with_covariance.pose &&
+           a.shape == b.shape;
+  };
 
-    goal_candidate.is_safe = true;
+  std::unordered_set<std::string> current_object_ids{};
+  for (const auto & object : objects.objects) {
+    const auto object_id = tier4_autoware_utils::toHexString(object.object_id);
+    current_object_ids.insert(object_id);
+    const auto prev_object = prev_objects_.find(object_id);
+    if (prev_object != prev_objects_.end() && is_same_object(prev_object->second, object)) {
+      continue;
+    }
+    // the object is added or moved
+    add_goals_near_object(object);
+    if (prev_object != prev_objects_.end()) {
+      add_goals_near_object(prev_object->second);
+    }
   }
+  for (const auto & [object_id, prev_object] : prev_objects_) {
+    if (current_object_ids.count(object_id) == 0) {
+      // the object is removed
+      add_goals_near_object(prev_object);
+    }
+  }
+
+  return goal_ids_to_update;
 }
 
 // Note: this function is not just return goal_candidate.is_safe but check collision with
@@ -136,6 +136,8 @@ void GoalPlannerModuleManager::init(rclcpp::Node * node)
     p.path_priority = node->declare_parameter<std::string>(ns + "path_priority");
     p.efficient_path_order =
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
+    p.candidate_generation_thread_num =
+      node->declare_parameter<int>(ns + "candidate_generation_thread_num");
   }
 
   // shift parking
@@ -18,6 +18,7 @@
 #include "behavior_path_lane_change_module/utils/data_structs.hpp"
 #include "behavior_path_planner_common/interface/scene_module_manager_interface.hpp"
 #include "route_handler/route_handler.hpp"
+#include "tier4_autoware_utils/system/thread_pool.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -52,6 +53,9 @@ protected:
   Direction direction_;
 
   LaneChangeModuleType type_;
+
+  // shared by the module instances to evaluate the candidate paths in parallel
+  std::shared_ptr<tier4_autoware_utils::ThreadPool> thread_pool_;
 };
 
 class LaneChangeRightModuleManager : public LaneChangeModuleManager
@@ -16,6 +16,7 @@
 
 #include "behavior_path_lane_change_module/utils/base_class.hpp"
 #include "behavior_path_lane_change_module/utils/data_structs.hpp"
+#include "tier4_autoware_utils/system/thread_pool.hpp"
 
 #include <memory>
 #include <utility>
@@ -40,7 +41,8 @@ class NormalLaneChange : public LaneChangeBase
 public:
   NormalLaneChange(
     const std::shared_ptr<LaneChangeParameters> & parameters, LaneChangeModuleType type,
-    Direction direction);
+    Direction direction,
+    const std::shared_ptr<tier4_autoware_utils::ThreadPool> & thread_pool = nullptr);
 
   NormalLaneChange(const NormalLaneChange &) = delete;
   NormalLaneChange(NormalLaneChange &&) = delete;
@@ -160,6 +162,23 @@ protected:
     const utils::path_safety_checker::RSSparams & rss_params, const bool is_stuck,
     CollisionCheckDebugMap & debug_data) const;
 
+  PathSafetyStatus isLaneChangePathSafe(
+    const LaneChangePath & lane_change_path, const LaneChangeCollisionCheckCache & cache,
+    const utils::path_safety_checker::RSSparams & rss_params,
+    CollisionCheckDebugMap & debug_data) const;
+
+  LaneChangeCollisionCheckCache createCollisionCheckCache(
+    const lanelet::ConstLanelets & target_lanes, const LaneChangeTargetObjects & target_objects,
+    const bool is_stuck) const;
+
+  //! @brief Check the safety of the candidate paths in parallel and keep the candidates up to the
+  //! first safe one, which is the same result as the sequential evaluation.
+  //! @param num_candidates_to_check Number of the candidates from the front to be checked.
+  bool selectSafePathInParallel(
+    LaneChangePaths & candidate_paths, const size_t num_candidates_to_check,
+    const LaneChangeCollisionCheckCache & cache,
+    const utils::path_safety_checker::RSSparams & rss_params) const;
+
   LaneChangeTargetObjectIndices filterObject(
     const PredictedObjects & objects, const lanelet::ConstLanelets & current_lanes,
     const lanelet::ConstLanelets & target_lanes,
@@ -188,6 +207,9 @@ protected:
   double getStopTime() const { return stop_time_; }
 
   double stop_time_{0.0};
+
+  // worker threads to evaluate the candidate paths in parallel. nullptr for sequential evaluation.
+  std::shared_ptr<tier4_autoware_utils::ThreadPool> thread_pool_;
 };
 }  // namespace behavior_path_planner
 #endif  // BEHAVIOR_PATH_LANE_CHANGE_MODULE__SCENE_HPP_
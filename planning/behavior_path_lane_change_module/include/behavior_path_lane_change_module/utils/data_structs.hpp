@@ -18,6 +18,7 @@
 #include "behavior_path_planner_common/utils/path_shifter/path_shifter.hpp"
 
 #include <interpolation/linear_interpolation.hpp>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
 
 #include <lanelet2_core/primitives/Lanelet.h>
 
@@ -120,6 +121,9 @@ struct LaneChangeParameters
   double lane_expansion_left_offset{0.0};
   double lane_expansion_right_offset{0.0};
 
+  // evaluate the sampled candidate paths in parallel (0: sequential evaluation)
+  int candidate_evaluation_thread_num{0};
+
   // regulatory elements
   bool regulate_on_crosswalk{false};
   bool regulate_on_intersection{false};
@@ -200,6 +204,17 @@ struct LaneChangeTargetObjects
   std::vector<utils::path_safety_checker::ExtendedPredictedObject> other_lane{};
 };
 
+// objects and lanes used for the collision check of all the candidate paths in the same cycle
+struct LaneChangeCollisionCheckCache
+{
+  std::vector<utils::path_safety_checker::ExtendedPredictedObject> objects{};
+  // predicted paths used for the collision check of each object
+  std::vector<std::vector<utils::path_safety_checker::PredictedPathWithPolygon>> predicted_paths{};
+  // polygon at the current pose of each object
+  std::vector<tier4_autoware_utils::Polygon2d> polygons{};
+  lanelet::ConstLanelets expanded_target_lanes{};
+};
+
 enum class LaneChangeModuleType {
   NORMAL = 0,
   EXTERNAL_REQUEST,
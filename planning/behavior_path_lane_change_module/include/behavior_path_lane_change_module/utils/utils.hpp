@@ -191,6 +191,11 @@ ExtendedPredictedObject transform(
   const PredictedObject & object, const BehaviorPathPlannerParameters & common_parameters,
   const LaneChangeParameters & lane_change_parameters);
 
+// same as above, but the result is reused while the dynamic object in the planner data is the same
+ExtendedPredictedObject transform(
+  const PredictedObject & object, const PlannerData & planner_data,
+  const LaneChangeParameters & lane_change_parameters);
+
 bool isCollidedPolygonsInLanelet(
   const std::vector<Polygon2d> & collided_polygons, const lanelet::ConstLanelets & lanes);
 
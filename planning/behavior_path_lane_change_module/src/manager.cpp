@@ -82,6 +82,8 @@ void LaneChangeModuleManager::initParams(rclcpp::Node * node)
     getOrDeclareParameter<double>(*node, parameter("safety_check.lane_expansion.left_offset"));
   p.lane_expansion_right_offset =
     getOrDeclareParameter<double>(*node, parameter("safety_check.lane_expansion.right_offset"));
+  p.candidate_evaluation_thread_num =
+    getOrDeclareParameter<int>(*node, parameter("safety_check.candidate_evaluation_thread_num"));
   // lane change regulations
   p.regulate_on_crosswalk = getOrDeclareParameter<bool>(*node, parameter("regulation.crosswalk"));
   p.regulate_on_intersection =
@@ -265,6 +267,11 @@ void LaneChangeModuleManager::initParams(rclcpp::Node * node)
   }
 
   parameters_ = std::make_shared<LaneChangeParameters>(p);
+
+  if (p.candidate_evaluation_thread_num > 0) {
+    thread_pool_ = std::make_shared<tier4_autoware_utils::ThreadPool>(
+      static_cast<size_t>(p.candidate_evaluation_thread_num));
+  }
 }
 
 std::unique_ptr<SceneModuleInterface> LaneChangeModuleManager::createNewSceneModuleInstance()
@@ -272,7 +279,8 @@ std::unique_ptr<SceneModuleInterface> LaneChangeModuleManager::createNewSceneMod
   return std::make_unique<LaneChangeInterface>(
     name_, *node_, parameters_, rtc_interface_ptr_map_,
     objects_of_interest_marker_interface_ptr_map_,
-    std::make_unique<NormalLaneChange>(parameters_, LaneChangeModuleType::NORMAL, direction_));
+    std::make_unique<NormalLaneChange>(
+      parameters_, LaneChangeModuleType::NORMAL, direction_, thread_pool_));
 }
 
 void LaneChangeModuleManager::updateModuleParams(const std::vector<rclcpp::Parameter> & parameters)
@@ -42,8 +42,8 @@ using utils::traffic_light::getDistanceToNextTrafficLight;
 
 NormalLaneChange::NormalLaneChange(
   const std::shared_ptr<LaneChangeParameters> & parameters, LaneChangeModuleType type,
-  Direction direction)
-: LaneChangeBase(parameters, type, direction)
+  Direction direction, const std::shared_ptr<tier4_autoware_utils::ThreadPool> & thread_pool)
+: LaneChangeBase(parameters, type, direction), thread_pool_{thread_pool}
 {
   stop_watch_.tic(getModuleTypeStr());
   stop_watch_.tic("stop_time");
@@ -836,7 +836,6 @@ LaneChangeTargetObjects NormalLaneChange::getTargetObjects(
 {
   const auto current_pose = getEgoPose();
   const auto & route_handler = *getRouteHandler();
-  const auto & common_parameters = planner_data_->parameters;
   auto objects = *planner_data_->dynamic_object;
   utils::path_safety_checker::filterObjectsByClass(
     objects, lane_change_parameters_->object_types_to_check);
@@ -858,21 +857,21 @@ LaneChangeTargetObjects NormalLaneChange::getTargetObjects(
   // objects in current lane
   for (const auto & obj_idx : target_obj_index.current_lane) {
     const auto extended_object = utils::lane_change::transform(
-      objects.objects.at(obj_idx), common_parameters, *lane_change_parameters_);
+      objects.objects.at(obj_idx), *planner_data_, *lane_change_parameters_);
     target_objects.current_lane.push_back(extended_object);
   }
 
   // objects in target lane
   for (const auto & obj_idx : target_obj_index.target_lane) {
     const auto extended_object = utils::lane_change::transform(
-      objects.objects.at(obj_idx), common_parameters, *lane_change_parameters_);
+      objects.objects.at(obj_idx), *planner_data_, *lane_change_parameters_);
     target_objects.target_lane.push_back(extended_object);
   }
 
   // objects in other lane
   for (const auto & obj_idx : target_obj_index.other_lane) {
     const auto extended_object = utils::lane_change::transform(
-      objects.objects.at(obj_idx), common_parameters, *lane_change_parameters_);
+      objects.objects.at(obj_idx), *planner_data_, *lane_change_parameters_);
     target_objects.other_lane.push_back(extended_object);
   }
 
@@ -937,7 +936,7 @@ LaneChangeTargetObjectIndices NormalLaneChange::filterObject(
       object.kinematics.initial_twist_with_covariance.twist.linear.x,
       object.kinematics.initial_twist_with_covariance.twist.linear.y);
     const auto extended_object =
-      utils::lane_change::transform(object, common_parameters, *lane_change_parameters_);
+      utils::lane_change::transform(object, *planner_data_, *lane_change_parameters_);
 
     const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object);
 
@@ -1229,6 +1228,15 @@ bool NormalLaneChange::getLaneChangePaths(
   const auto target_objects = getTargetObjects(current_lanes, target_lanes);
   lane_change_debug_.filtered_objects = target_objects;
 
+  // the objects and lanes for the collision check are common to all the candidates
+  const auto collision_check_cache =
+    createCollisionCheckCache(target_lanes, target_objects, is_stuck);
+  const auto filtered_objects = filterObjectsInTargetLane(target_objects, target_lanes);
+
+  // in the parallel evaluation, the safety check is deferred until all the candidates are sampled
+  const bool evaluate_in_parallel = thread_pool_ != nullptr && check_safety;
+  bool is_blocked_by_parked_object = false;
+
   const auto prepare_durations = calcPrepareDuration(current_lanes, target_lanes);
 
   candidate_paths->reserve(
@@ -1451,8 +1459,6 @@ bool NormalLaneChange::getLaneChangePaths(
         }
         candidate_paths->push_back(*candidate_path);
 
-        std::vector<ExtendedPredictedObject> filtered_objects =
-          filterObjectsInTargetLane(target_objects, target_lanes);
         if (
           !is_stuck &&
           utils::lane_change::passParkedObject(
@@ -1461,7 +1467,12 @@ bool NormalLaneChange::getLaneChangePaths(
           debug_print(
             "Reject: parking vehicle exists in the target lane, and the ego is not in stuck. Skip "
             "lane change.");
-          return false;
+          if (!evaluate_in_parallel) {
+            return false;
+          }
+          // the preceding candidates can still be safe
+          is_blocked_by_parked_object = true;
+          break;
         }
 
         if (!check_safety) {
@@ -1469,8 +1480,12 @@ bool NormalLaneChange::getLaneChangePaths(
           return false;
         }
 
+        if (evaluate_in_parallel) {
+          continue;
+        }
+
         const auto [is_safe, is_object_coming_from_rear] = isLaneChangePathSafe(
-          *candidate_path, target_objects, rss_params, is_stuck,
+          *candidate_path, collision_check_cache, rss_params,
           lane_change_debug_.collision_check_objects);
 
         if (is_safe) {
@@ -1480,6 +1495,22 @@ bool NormalLaneChange::getLaneChangePaths(
 
         debug_print("Reject: sampled path is not safe.");
       }
+      if (is_blocked_by_parked_object) {
+        break;
+      }
+    }
+    if (is_blocked_by_parked_object) {
+      break;
+    }
+  }
+
+  if (evaluate_in_parallel) {
+    // the last candidate blocked by the parked object is not checked
+    const size_t num_candidates_to_check =
+      candidate_paths->size() - (is_blocked_by_parked_object ? 1 : 0);
+    if (selectSafePathInParallel(
+          *candidate_paths, num_candidates_to_check, collision_check_cache, rss_params)) {
+      return true;
     }
   }
 
@@ -1487,6 +1518,33 @@ bool NormalLaneChange::getLaneChangePaths(
   return false;
 }
 
+bool NormalLaneChange::selectSafePathInParallel(
+  LaneChangePaths & candidate_paths, const size_t num_candidates_to_check,
+  const LaneChangeCollisionCheckCache & cache,
+  const utils::path_safety_checker::RSSparams & rss_params) const
+{
+  std::vector<PathSafetyStatus> safety_status(num_candidates_to_check);
+  std::vector<CollisionCheckDebugMap> debug_data(num_candidates_to_check);
+  thread_pool_->parallelFor(num_candidates_to_check, [&](const size_t i) {
+    safety_status.at(i) =
+      isLaneChangePathSafe(candidate_paths.at(i), cache, rss_params, debug_data.at(i));
+  });
+
+  // keep the priority of the sampling order
+  for (size_t i = 0; i < num_candidates_to_check; ++i) {
+    for (const auto & [uuid, object_debug] : debug_data.at(i)) {
+      lane_change_debug_.collision_check_objects[uuid] = object_debug;
+    }
+    if (safety_status.at(i).is_safe) {
+      RCLCPP_DEBUG(logger_, "ACCEPT!!!: candidate %lu is valid and safe!", i);
+      candidate_paths.resize(i + 1);
+      return true;
+    }
+  }
+
+  return false;
+}
+
 std::optional<LaneChangePath> NormalLaneChange::calcTerminalLaneChangePath(
   const lanelet::ConstLanelets & current_lanes, const lanelet::ConstLanelets & target_lanes) const
 {
@@ -1934,6 +1992,52 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   const LaneChangePath & lane_change_path, const LaneChangeTargetObjects & target_objects,
   const utils::path_safety_checker::RSSparams & rss_params, const bool is_stuck,
   CollisionCheckDebugMap & debug_data) const
+{
+  const auto cache =
+    createCollisionCheckCache(lane_change_path.info.target_lanes, target_objects, is_stuck);
+  return isLaneChangePathSafe(lane_change_path, cache, rss_params, debug_data);
+}
+
+LaneChangeCollisionCheckCache NormalLaneChange::createCollisionCheckCache(
+  const lanelet::ConstLanelets & target_lanes, const LaneChangeTargetObjects & target_objects,
+  const bool is_stuck) const
+{
+  LaneChangeCollisionCheckCache cache;
+
+  auto & collision_check_objects = cache.objects;
+  collision_check_objects = target_objects.target_lane;
+
+  if (lane_change_parameters_->check_objects_on_current_lanes || is_stuck) {
+    collision_check_objects.insert(
+      collision_check_objects.end(), target_objects.current_lane.begin(),
+      target_objects.current_lane.end());
+  }
+
+  if (lane_change_parameters_->check_objects_on_other_lanes) {
+    collision_check_objects.insert(
+      collision_check_objects.end(), target_objects.other_lane.begin(),
+      target_objects.other_lane.end());
+  }
+
+  cache.predicted_paths.reserve(collision_check_objects.size());
+  cache.polygons.reserve(collision_check_objects.size());
+  for (const auto & obj : collision_check_objects) {
+    cache.predicted_paths.push_back(utils::path_safety_checker::getPredictedPathFromObj(
+      obj, lane_change_parameters_->use_all_predicted_path));
+    cache.polygons.push_back(tier4_autoware_utils::toPolygon2d(obj.initial_pose.pose, obj.shape));
+  }
+
+  cache.expanded_target_lanes = utils::lane_change::generateExpandedLanelets(
+    target_lanes, direction_, lane_change_parameters_->lane_expansion_left_offset,
+    lane_change_parameters_->lane_expansion_right_offset);
+
+  return cache;
+}
+
+PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
+  const LaneChangePath & lane_change_path, const LaneChangeCollisionCheckCache & cache,
+  const utils::path_safety_checker::RSSparams & rss_params,
+  CollisionCheckDebugMap & debug_data) const
 {
   PathSafetyStatus path_safety_status;
 
@@ -1955,32 +2059,13 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   const auto debug_predicted_path =
     utils::path_safety_checker::convertToPredictedPath(ego_predicted_path, time_resolution);
 
-  auto collision_check_objects = target_objects.target_lane;
-  const auto current_lanes = getCurrentLanes();
+  const auto & expanded_target_lanes = cache.expanded_target_lanes;
 
-  if (lane_change_parameters_->check_objects_on_current_lanes || is_stuck) {
-    collision_check_objects.insert(
-      collision_check_objects.end(), target_objects.current_lane.begin(),
-      target_objects.current_lane.end());
-  }
-
-  if (lane_change_parameters_->check_objects_on_other_lanes) {
-    collision_check_objects.insert(
-      collision_check_objects.end(), target_objects.other_lane.begin(),
-      target_objects.other_lane.end());
-  }
-
-  const auto expanded_target_lanes = utils::lane_change::generateExpandedLanelets(
-    lane_change_path.info.target_lanes, direction_,
-    lane_change_parameters_->lane_expansion_left_offset,
-    lane_change_parameters_->lane_expansion_right_offset);
-
-  for (const auto & obj : collision_check_objects) {
+  for (size_t i = 0; i < cache.objects.size(); ++i) {
+    const auto & obj = cache.objects.at(i);
     auto current_debug_data = utils::path_safety_checker::createObjectDebug(obj);
-    const auto obj_predicted_paths = utils::path_safety_checker::getPredictedPathFromObj(
-      obj, lane_change_parameters_->use_all_predicted_path);
     auto is_safe = true;
-    for (const auto & obj_path : obj_predicted_paths) {
+    for (const auto & obj_path : cache.predicted_paths.at(i)) {
       const auto collided_polygons = utils::path_safety_checker::getCollidedPolygons(
         path, ego_predicted_path, obj, obj_path, common_parameters, rss_params, 1.0,
         current_debug_data.second);
@@ -2006,11 +2091,9 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
       path_safety_status.is_safe = false;
       utils::path_safety_checker::updateCollisionCheckDebugMap(
         debug_data, current_debug_data, is_safe);
-      const auto & obj_pose = obj.initial_pose.pose;
-      const auto obj_polygon = tier4_autoware_utils::toPolygon2d(obj_pose, obj.shape);
       path_safety_status.is_object_coming_from_rear |=
         !utils::path_safety_checker::isTargetObjectFront(
-          path, current_pose, common_parameters.vehicle_info, obj_polygon);
+          path, current_pose, common_parameters.vehicle_info, cache.polygons.at(i));
     }
     utils::path_safety_checker::updateCollisionCheckDebugMap(
       debug_data, current_debug_data, is_safe);
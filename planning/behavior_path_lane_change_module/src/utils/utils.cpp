@@ -1167,6 +1167,23 @@ ExtendedPredictedObject transform(
   return extended_object;
 }
 
+ExtendedPredictedObject transform(
+  const PredictedObject & object, const PlannerData & planner_data,
+  const LaneChangeParameters & lane_change_parameters)
+{
+  // the parameters which change the sampled predicted paths
+  const std::vector<double> sampling_params{
+    lane_change_parameters.prediction_time_resolution,
+    static_cast<double>(lane_change_parameters.enable_prepare_segment_collision_check),
+    lane_change_parameters.lane_change_prepare_duration,
+    lane_change_parameters.prepare_segment_ignore_object_velocity_thresh};
+
+  return planner_data.predicted_objects_cache->getOrCreate(
+    planner_data.dynamic_object, object, sampling_params, [&](const PredictedObject & obj) {
+      return transform(obj, planner_data.parameters, lane_change_parameters);
+    });
+}
+
 bool isCollidedPolygonsInLanelet(
   const std::vector<Polygon2d> & collided_polygons, const lanelet::ConstLanelets & lanes)
 {
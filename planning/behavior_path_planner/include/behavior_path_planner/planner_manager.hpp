@@ -18,6 +18,7 @@
 #include "behavior_path_planner_common/interface/scene_module_interface.hpp"
 #include "behavior_path_planner_common/interface/scene_module_manager_interface.hpp"
 #include "behavior_path_planner_common/interface/scene_module_visitor.hpp"
+#include "behavior_path_planner_common/utils/reference_path_builder.hpp"
 #include "tier4_autoware_utils/ros/debug_publisher.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 
@@ -138,6 +139,7 @@ public:
     approved_module_ptrs_.clear();
     candidate_module_ptrs_.clear();
     root_lanelet_ = std::nullopt;
+    reference_path_builder_.clear();
     resetProcessingTime();
   }
 
@@ -268,9 +270,9 @@ private:
    * @param planner data.
    * @return planning result.
    */
-  BehaviorModuleOutput run(
+  BehaviorModuleOutputConstPtr run(
     const SceneModulePtr & module_ptr, const std::shared_ptr<PlannerData> & planner_data,
-    const BehaviorModuleOutput & previous_module_output) const
+    const BehaviorModuleOutputConstPtr & previous_module_output) const
   {
     stop_watch_.tic(module_ptr->name());
 
@@ -278,7 +280,7 @@ private:
     module_ptr->setPreviousModuleOutput(previous_module_output);
 
     module_ptr->lockRTCCommand();
-    const auto result = module_ptr->run();
+    auto result = module_ptr->run();
     module_ptr->unlockRTCCommand();
 
     module_ptr->postProcess();
@@ -293,7 +295,7 @@ private:
 
     processing_time_.at(module_ptr->name()) += stop_watch_.toc(module_ptr->name(), true);
 
-    return result;
+    return std::make_shared<const BehaviorModuleOutput>(std::move(result));
   }
 
   void generateCombinedDrivableArea(
@@ -400,7 +402,7 @@ private:
    * @details in this function, expired modules (ModuleStatus::FAILURE or ModuleStatus::SUCCESS) are
    * removed from approved_module_ptrs_.
    */
-  BehaviorModuleOutput runApprovedModules(const std::shared_ptr<PlannerData> & data);
+  BehaviorModuleOutputConstPtr runApprovedModules(const std::shared_ptr<PlannerData> & data);
 
   /**
    * @brief select a module that should be execute at first.
@@ -423,7 +425,7 @@ private:
    * @return request modules.
    */
   std::vector<SceneModulePtr> getRequestModules(
-    const BehaviorModuleOutput & previous_module_output) const;
+    const BehaviorModuleOutputConstPtr & previous_module_output) const;
 
   /**
    * @brief checks whether a path of trajectory has forward driving direction
@@ -432,9 +434,9 @@ private:
    * @param decided (=approved) path.
    * @return the highest priority module in request modules, and it's planning result.
    */
-  std::pair<SceneModulePtr, BehaviorModuleOutput> runRequestModules(
+  std::pair<SceneModulePtr, BehaviorModuleOutputConstPtr> runRequestModules(
     const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
-    const BehaviorModuleOutput & previous_module_output);
+    const BehaviorModuleOutputConstPtr & previous_module_output);
 
   /**
    * @brief run keep last approved modules
@@ -442,8 +444,9 @@ private:
    * @param previous module output.
    * @return planning result.
    */
-  BehaviorModuleOutput runKeepLastModules(
-    const std::shared_ptr<PlannerData> & data, const BehaviorModuleOutput & previous_output) const;
+  BehaviorModuleOutputConstPtr runKeepLastModules(
+    const std::shared_ptr<PlannerData> & data,
+    const BehaviorModuleOutputConstPtr & previous_output) const;
 
   static std::string getNames(const std::vector<SceneModulePtr> & modules);
 
@@ -473,6 +476,8 @@ private:
 
   mutable std::shared_ptr<SceneModuleVisitor> debug_msg_ptr_;
 
+  mutable utils::ReferencePathBuilder reference_path_builder_;
+
   size_t max_iteration_num_{100};
 
   bool verbose_{false};
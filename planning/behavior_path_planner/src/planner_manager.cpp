@@ -19,6 +19,7 @@
 #include "behavior_path_planner_common/utils/utils.hpp"
 #include "tier4_autoware_utils/ros/debug_publisher.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
+#include "tier4_autoware_utils/system/tracer.hpp"
 
 #include <lanelet2_extension/utility/query.hpp>
 #include <magic_enum.hpp>
@@ -85,6 +86,7 @@ void PlannerManager::removeScenePlugin(rclcpp::Node & node, const std::string &
 
 BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & data)
 {
+  TIER4_TRACE_SCOPE("behavior_path_planner::PlannerManager::run");
   resetProcessingTime();
   stop_watch_.tic("total_time");
   debug_info_.clear();
@@ -144,7 +146,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
       if (request_modules.empty()) {
         const auto output = runKeepLastModules(data, approved_modules_output);
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
-        return output;
+        return *output;
       }
 
       /**
@@ -162,7 +164,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
         data, highest_priority_module ? candidate_modules_output : approved_modules_output);
       if (!highest_priority_module) {
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
-        return output;
+        return *output;
       }
 
       /**
@@ -173,7 +175,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
        */
       if (highest_priority_module->isWaitingApproval()) {
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
-        return output;
+        return *output;
       }
 
       /**
@@ -188,7 +190,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
           logger_, clock_, 1000, "Reach iteration limit (max: %ld). Output current result.",
           max_iteration_num_);
         processing_time_.at("total_time") = stop_watch_.toc("total_time", true);
-        return output;
+        return *output;
       }
     }
 
@@ -247,9 +249,9 @@ void PlannerManager::generateCombinedDrivableArea(
 }
 
 std::vector<SceneModulePtr> PlannerManager::getRequestModules(
-  const BehaviorModuleOutput & previous_module_output) const
+  const BehaviorModuleOutputConstPtr & previous_module_output) const
 {
-  if (previous_module_output.path.points.empty()) {
+  if (previous_module_output->path.points.empty()) {
     RCLCPP_ERROR_STREAM(
       logger_, "Current module output is null. Skip candidate module check."
                  << "\n      - Approved  module list: " << getNames(approved_module_ptrs_)
@@ -403,8 +405,9 @@ std::vector<SceneModulePtr> PlannerManager::getRequestModules(
   return request_modules;
 }
 
-BehaviorModuleOutput PlannerManager::runKeepLastModules(
-  const std::shared_ptr<PlannerData> & data, const BehaviorModuleOutput & previous_output) const
+BehaviorModuleOutputConstPtr PlannerManager::runKeepLastModules(
+  const std::shared_ptr<PlannerData> & data,
+  const BehaviorModuleOutputConstPtr & previous_output) const
 {
   auto output = previous_output;
   std::for_each(approved_module_ptrs_.begin(), approved_module_ptrs_.end(), [&](const auto & m) {
@@ -419,6 +422,7 @@ BehaviorModuleOutput PlannerManager::runKeepLastModules(
 BehaviorModuleOutput PlannerManager::getReferencePath(
   const std::shared_ptr<PlannerData> & data) const
 {
+  TIER4_TRACE_SCOPE("behavior_path_planner::PlannerManager::getReferencePath");
   const auto & route_handler = data->route_handler;
   const auto & pose = data->self_odometry->pose.pose;
   const auto p = data->parameters;
@@ -434,11 +438,11 @@ BehaviorModuleOutput PlannerManager::getReferencePath(
   if (lanelet::utils::query::getClosestLaneletWithConstrains(
         lanelet_sequence, pose, &closest_lane, p.ego_nearest_dist_threshold,
         p.ego_nearest_yaw_threshold)) {
-    return utils::getReferencePath(closest_lane, data);
+    return utils::getReferencePath(closest_lane, data, &reference_path_builder_);
   }
 
   if (lanelet::utils::query::getClosestLanelet(lanelet_sequence, pose, &closest_lane)) {
-    return utils::getReferencePath(closest_lane, data);
+    return utils::getReferencePath(closest_lane, data, &reference_path_builder_);
   }
 
   return {};  // something wrong.
@@ -456,10 +460,11 @@ SceneModulePtr PlannerManager::selectHighestPriorityModule(
   return request_modules.front();
 }
 
-std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModules(
+std::pair<SceneModulePtr, BehaviorModuleOutputConstPtr> PlannerManager::runRequestModules(
   const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
-  const BehaviorModuleOutput & previous_module_output)
+  const BehaviorModuleOutputConstPtr & previous_module_output)
 {
+  TIER4_TRACE_SCOPE("behavior_path_planner::PlannerManager::runRequestModules");
   // modules that are filtered by simultaneous executable condition.
   std::vector<SceneModulePtr> executable_modules;
 
@@ -470,7 +475,7 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
   std::vector<SceneModulePtr> already_approved_modules;
 
   // all request modules planning results.
-  std::unordered_map<std::string, BehaviorModuleOutput> results;
+  std::unordered_map<std::string, BehaviorModuleOutputConstPtr> results;
 
   /**
    * sort by priority. sorted_request_modules.front() is the highest priority module.
@@ -582,7 +587,7 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
    */
   if (executable_modules.empty()) {
     clearCandidateModules();
-    return std::make_pair(nullptr, BehaviorModuleOutput{});
+    return std::make_pair(nullptr, std::make_shared<const BehaviorModuleOutput>());
   }
 
   /**
@@ -619,10 +624,13 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
   return std::make_pair(module_ptr, results.at(module_ptr->name()));
 }
 
-BehaviorModuleOutput PlannerManager::runApprovedModules(const std::shared_ptr<PlannerData> & data)
+BehaviorModuleOutputConstPtr PlannerManager::runApprovedModules(
+  const std::shared_ptr<PlannerData> & data)
 {
-  std::unordered_map<std::string, BehaviorModuleOutput> results;
-  BehaviorModuleOutput output = getReferencePath(data);
+  TIER4_TRACE_SCOPE("behavior_path_planner::PlannerManager::runApprovedModules");
+  std::unordered_map<std::string, BehaviorModuleOutputConstPtr> results;
+  BehaviorModuleOutputConstPtr output =
+    std::make_shared<const BehaviorModuleOutput>(getReferencePath(data));
   results.emplace("root", output);
 
   if (approved_module_ptrs_.empty()) {
@@ -973,6 +981,12 @@ void PlannerManager::print() const
                   << std::setw(28);
   }
 
+  string_stream << "\n";
+  const auto & reference_path_statistics = reference_path_builder_.getStatistics();
+  string_stream << "reference path    : [hit:" << reference_path_statistics.hit_count
+                << " extend:" << reference_path_statistics.extend_count
+                << " miss:" << reference_path_statistics.miss_count << "]";
+
   string_stream << "\n" << std::fixed << std::setprecision(1);
   string_stream << "processing time   : ";
   for (const auto & t : processing_time_) {
@@ -18,6 +18,7 @@
 #include "behavior_path_planner_common/parameters.hpp"
 #include "behavior_path_planner_common/turn_signal_decider.hpp"
 #include "behavior_path_planner_common/utils/drivable_area_expansion/parameters.hpp"
+#include "behavior_path_planner_common/utils/path_safety_checker/predicted_objects_cache.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
 
 #include <lanelet2_extension/regulatory_elements/Forward.hpp>
@@ -134,6 +135,10 @@ struct BehaviorModuleOutput
   DrivableAreaInfo drivable_area_info;
 };
 
+// NOTE: The output of a module is not modified after it is planned, so it is shared between the
+// stacked modules instead of being copied to each of them.
+using BehaviorModuleOutputConstPtr = std::shared_ptr<const BehaviorModuleOutput>;
+
 struct CandidateOutput
 {
   CandidateOutput() = default;
@@ -165,6 +170,10 @@ struct PlannerData
   mutable std::vector<double> drivable_area_expansion_prev_curvatures{};
   mutable TurnSignalDecider turn_signal_decider;
 
+  // predicted paths of dynamic_object sampled for the safety check, shared by the modules
+  std::shared_ptr<utils::path_safety_checker::PredictedObjectsCache> predicted_objects_cache{
+    std::make_shared<utils::path_safety_checker::PredictedObjectsCache>()};
+
   TurnIndicatorsCommand getTurnSignal(
     const PathWithLaneId & path, const TurnSignalInfo & turn_signal_info,
     TurnSignalDebugData & debug_data)
@@ -190,6 +199,17 @@ struct PlannerData
     return traffic_light_id_map.at(id);
   }
 
+  /**
+   * @brief Get the object in dynamic_object whose predicted paths are sampled for the safety check.
+   *        The sampled polygons are computed once per object and reused in the same cycle.
+   */
+  utils::path_safety_checker::ExtendedPredictedObject getExtendedPredictedObject(
+    const PredictedObject & object, const double time_horizon, const double time_resolution) const
+  {
+    return predicted_objects_cache->transform(
+      dynamic_object, object, time_horizon, time_resolution);
+  }
+
   template <class T>
   size_t findEgoIndex(const std::vector<T> & points) const
   {
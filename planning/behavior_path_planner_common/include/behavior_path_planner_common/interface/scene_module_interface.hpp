@@ -241,6 +241,14 @@ public:
    * @brief set previous module's output as input for this module
    */
   void setPreviousModuleOutput(const BehaviorModuleOutput & previous_module_output)
+  {
+    previous_module_output_ = std::make_shared<const BehaviorModuleOutput>(previous_module_output);
+  }
+
+  /**
+   * @brief set previous module's output shared with the other modules without copying it
+   */
+  void setPreviousModuleOutput(const BehaviorModuleOutputConstPtr & previous_module_output)
   {
     previous_module_output_ = previous_module_output;
   }
@@ -437,7 +445,8 @@ private:
 
   ModuleStatus current_state_{ModuleStatus::IDLE};
 
-  BehaviorModuleOutput previous_module_output_;
+  BehaviorModuleOutputConstPtr previous_module_output_{
+    std::make_shared<const BehaviorModuleOutput>()};
 
   StopReason stop_reason_;
 
@@ -563,7 +572,7 @@ protected:
       marker_utils::createDrivableLanesMarkerArray(drivable_lanes, "drivable_lanes");
   }
 
-  BehaviorModuleOutput getPreviousModuleOutput() const { return previous_module_output_; }
+  const BehaviorModuleOutput & getPreviousModuleOutput() const { return *previous_module_output_; }
 
   bool isOutputPathLocked() const { return is_locked_output_path_; }
 
@@ -67,7 +67,7 @@ public:
     idle_module_ptr_ = createNewSceneModuleInstance();
   }
 
-  bool isExecutionRequested(const BehaviorModuleOutput & previous_module_output) const
+  bool isExecutionRequested(const BehaviorModuleOutputConstPtr & previous_module_output) const
   {
     idle_module_ptr_->setData(planner_data_);
     idle_module_ptr_->setPreviousModuleOutput(previous_module_output);
@@ -77,7 +77,8 @@ public:
   }
 
   void registerNewModule(
-    const SceneModuleObserver & observer, const BehaviorModuleOutput & previous_module_output)
+    const SceneModuleObserver & observer,
+    const BehaviorModuleOutputConstPtr & previous_module_output)
   {
     if (observer.expired()) {
       return;
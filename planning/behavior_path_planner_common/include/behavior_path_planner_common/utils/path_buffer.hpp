@@ -0,0 +1,69 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_BUFFER_HPP_
+#define BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_BUFFER_HPP_
+
+#include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace behavior_path_planner
+{
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+
+/**
+ * @brief Immutable path shared between the copies of the buffer, so that copying the buffer costs
+ *        a reference count. The arc length of the points is computed once per path and shared as
+ *        well.
+ */
+class PathBuffer
+{
+public:
+  PathBuffer();
+  explicit PathBuffer(const PathWithLaneId & path);
+  explicit PathBuffer(PathWithLaneId && path);
+
+  const PathWithLaneId & get() const { return storage_->path; }
+
+  bool empty() const { return storage_->path.points.empty(); }
+  size_t size() const { return storage_->path.points.size(); }
+  bool isShared() const { return storage_.use_count() > 1; }
+
+  /**
+   * @brief Get the arc length from the first point to each point. Same as
+   *        utils::calcPathArcLengthArray(path) but computed once per path.
+   * @return const std::vector<double> & The arc length of each point.
+   */
+  const std::vector<double> & getArcLengths() const;
+
+private:
+  struct Storage
+  {
+    explicit Storage(PathWithLaneId && path) : path(std::move(path)) {}
+
+    PathWithLaneId path;
+    std::once_flag arc_lengths_flag;
+    std::vector<double> arc_lengths;
+  };
+
+  std::shared_ptr<Storage> storage_;
+};
+}  // namespace behavior_path_planner
+
+#endif  // BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_BUFFER_HPP_
@@ -239,12 +239,13 @@ ExtendedPredictedObject transform(
  * @param route_handler
  * @param filtered_objects The filtered objects.
  * @param params The filtering parameters.
+ * @param planner_data If given, the objects are transformed with its predicted objects cache.
  * @return TargetObjectsOnLane The target objects on the lane.
  */
 TargetObjectsOnLane createTargetObjectsOnLane(
   const lanelet::ConstLanelets & current_lanes, const std::shared_ptr<RouteHandler> & route_handler,
-  const PredictedObjects & filtered_objects,
-  const std::shared_ptr<ObjectsFilteringParams> & params);
+  const PredictedObjects & filtered_objects, const std::shared_ptr<ObjectsFilteringParams> & params,
+  const std::shared_ptr<const PlannerData> & planner_data = nullptr);
 
 /**
  * @brief Determines whether the predicted object type matches any of the target object types
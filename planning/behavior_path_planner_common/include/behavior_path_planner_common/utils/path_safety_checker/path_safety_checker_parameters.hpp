@@ -21,6 +21,7 @@
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/twist.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/uuid/uuid_hash.hpp>
 
 #include <string>
@@ -33,6 +34,7 @@ namespace behavior_path_planner::utils::path_safety_checker
 
 using geometry_msgs::msg::Pose;
 using geometry_msgs::msg::Twist;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::Polygon2d;
 
 struct PoseWithVelocity
@@ -56,11 +58,13 @@ struct PoseWithVelocityStamped : public PoseWithVelocity
 struct PoseWithVelocityAndPolygonStamped : public PoseWithVelocityStamped
 {
   Polygon2d poly;
+  Box2d box;  // axis aligned bounding box of poly to reject the pairs far from each other
 
   PoseWithVelocityAndPolygonStamped(
     const double time, const Pose & pose, const double velocity, const Polygon2d & poly)
   : PoseWithVelocityStamped(time, pose, velocity), poly(poly)
   {
+    boost::geometry::envelope(poly, box);
   }
 };
 
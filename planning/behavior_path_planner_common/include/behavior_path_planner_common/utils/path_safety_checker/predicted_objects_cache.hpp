@@ -0,0 +1,85 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__PREDICTED_OBJECTS_CACHE_HPP_
+#define BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__PREDICTED_OBJECTS_CACHE_HPP_
+
+#include "behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
+
+#include <autoware_auto_perception_msgs/msg/predicted_object.hpp>
+#include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace behavior_path_planner::utils::path_safety_checker
+{
+
+using autoware_auto_perception_msgs::msg::PredictedObject;
+using autoware_auto_perception_msgs::msg::PredictedObjects;
+
+/**
+ * @brief Cache of the predicted objects whose predicted paths are sampled into time-indexed
+ *        polygons. The cache is valid for one predicted objects message, so that the modules
+ *        which check the same object in the same planning cycle share the sampled polygons.
+ */
+class PredictedObjectsCache
+{
+public:
+  /**
+   * @brief Get the object sampled with the time horizon and resolution. Same as transform() in
+   *        objects_filtering.hpp but the result is computed once per object.
+   * @param source The predicted objects message which the object belongs to.
+   * @param object The predicted object to transform.
+   * @param time_horizon The time horizon for safety checks.
+   * @param time_resolution The time resolution for safety checks.
+   * @return ExtendedPredictedObject The transformed object.
+   */
+  ExtendedPredictedObject transform(
+    const PredictedObjects::ConstSharedPtr & source, const PredictedObject & object,
+    const double time_horizon, const double time_resolution);
+
+  /**
+   * @brief Get the object from the cache, or create it with the given function if it is not cached.
+   * @param source The predicted objects message which the object belongs to. The cache is cleared
+   *        when the message is changed.
+   * @param object The predicted object to transform.
+   * @param sampling_params The parameters which determine the result of the create function.
+   * @param create The function to create the object.
+   * @return ExtendedPredictedObject The transformed object.
+   */
+  ExtendedPredictedObject getOrCreate(
+    const PredictedObjects::ConstSharedPtr & source, const PredictedObject & object,
+    const std::vector<double> & sampling_params,
+    const std::function<ExtendedPredictedObject(const PredictedObject &)> & create);
+
+  size_t size() const;
+  size_t hitCount() const;
+
+private:
+  using Key = std::pair<std::array<uint8_t, 16>, std::vector<double>>;
+
+  mutable std::mutex mutex_;
+  PredictedObjects::ConstSharedPtr source_{};
+  std::map<Key, ExtendedPredictedObject> objects_{};
+  size_t hit_count_{0};
+};
+}  // namespace behavior_path_planner::utils::path_safety_checker
+
+#endif  // BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__PREDICTED_OBJECTS_CACHE_HPP_
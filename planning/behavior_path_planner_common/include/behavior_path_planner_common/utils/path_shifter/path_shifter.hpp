@@ -15,6 +15,8 @@
 #ifndef BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SHIFTER__PATH_SHIFTER_HPP_
 #define BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SHIFTER__PATH_SHIFTER_HPP_
 
+#include "behavior_path_planner_common/utils/path_buffer.hpp"
+
 #include <rclcpp/clock.hpp>
 #include <rclcpp/logging.hpp>
 #include <tier4_autoware_utils/ros/uuid_helper.hpp>
@@ -121,7 +123,7 @@ public:
   /**
    * @brief  Get reference path.
    */
-  PathWithLaneId getReferencePath() const { return reference_path_; }
+  PathWithLaneId getReferencePath() const { return reference_path_.get(); }
 
   /**
    * @brief  Generate a shifted path according to the given reference path and shift points.
@@ -169,8 +171,9 @@ public:
   std::vector<double> calcLateralJerk() const;
 
 private:
-  // The reference path along which the shift will be performed.
-  PathWithLaneId reference_path_;
+  // The reference path along which the shift will be performed. It is shared between the copies
+  // of the shifter together with its arc length.
+  PathBuffer reference_path_;
 
   // Shift points used for shifted-path generation.
   ShiftLineArray shift_lines_;
@@ -16,6 +16,7 @@
 #define BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_UTILS_HPP_
 
 #include "behavior_path_planner_common/utils/path_shifter/path_shifter.hpp"
+#include "behavior_path_planner_common/utils/reference_path_builder.hpp"
 
 #include <behavior_path_planner_common/data_manager.hpp>
 #include <behavior_path_planner_common/parameters.hpp>
@@ -105,9 +106,18 @@ PathWithLaneId combinePath(const PathWithLaneId & path1, const PathWithLaneId &
 
 std::optional<Pose> getFirstStopPoseFromPath(const PathWithLaneId & path);
 
+/**
+ * @brief get the centerline path around the ego with the drivable lanes
+ * @param [in] current_lane lanelet closest to the ego
+ * @param [in] planner_data planner data
+ * @param [in] reference_path_builder builder to reuse the centerline of the previous cycles. the
+ * centerline is generated from the lanelets every time if it is null.
+ * @return reference path as a module output
+ */
 BehaviorModuleOutput getReferencePath(
   const lanelet::ConstLanelet & current_lane,
-  const std::shared_ptr<const PlannerData> & planner_data);
+  const std::shared_ptr<const PlannerData> & planner_data,
+  ReferencePathBuilder * reference_path_builder = nullptr);
 
 BehaviorModuleOutput createGoalAroundPath(const std::shared_ptr<const PlannerData> & planner_data);
 
@@ -0,0 +1,115 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_PATH_PLANNER_COMMON__UTILS__REFERENCE_PATH_BUILDER_HPP_
+#define BEHAVIOR_PATH_PLANNER_COMMON__UTILS__REFERENCE_PATH_BUILDER_HPP_
+
+#include "behavior_path_planner_common/parameters.hpp"
+
+#include <route_handler/route_handler.hpp>
+
+#include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <unique_identifier_msgs/msg/uuid.hpp>
+
+#include <lanelet2_core/Forward.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace behavior_path_planner::utils
+{
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+using geometry_msgs::msg::Pose;
+using route_handler::RouteHandler;
+
+/**
+ * @brief Builder of the resampled centerline path which keeps the path of the lanelet sequence
+ *        ahead of the ego. The cached path is cropped while the requested range is inside of it,
+ *        and it is extended forward from the cached points when the ego comes close to its end,
+ *        so that the centerline is resampled only for the new part of the route.
+ */
+class ReferencePathBuilder
+{
+public:
+  struct Statistics
+  {
+    size_t hit_count{0};     // the path is cropped from the cache
+    size_t extend_count{0};  // the cache is extended forward from the cached points
+    size_t miss_count{0};    // the cache is rebuilt from the lanelet sequence
+  };
+
+  /**
+   * @brief Get the centerline path of the lanelet sequence around the pose. Same as
+   *        getCenterLinePath() except that the resampled points are aligned to the cached path,
+   *        and the path may be longer by the resampling interval on both ends.
+   * @param route_handler The route handler.
+   * @param lanelet_sequence The lanelet sequence along which the path is generated.
+   * @param pose The pose to measure the backward and forward length from.
+   * @param backward_path_length The length of the path behind the pose.
+   * @param forward_path_length The length of the path in front of the pose.
+   * @param parameter The common parameters.
+   * @return PathWithLaneId The centerline path.
+   */
+  PathWithLaneId build(
+    const RouteHandler & route_handler, const lanelet::ConstLanelets & lanelet_sequence,
+    const Pose & pose, const double backward_path_length, const double forward_path_length,
+    const BehaviorPathPlannerParameters & parameter);
+
+  void clear();
+
+  const Statistics & getStatistics() const { return statistics_; }
+
+private:
+  bool isValid(
+    const RouteHandler & route_handler, const BehaviorPathPlannerParameters & parameter) const;
+
+  // arc length of the start of the lanelet sequence along the cached lanelets, if the lanelet
+  // sequence is the same as the cached lanelets where they overlap
+  std::optional<double> findOffset(const lanelet::ConstLanelets & lanelet_sequence) const;
+
+  lanelet::ConstLanelets getExtendedLanelets(
+    const RouteHandler & route_handler, const lanelet::ConstLanelets & lanelet_sequence,
+    const double extension_length) const;
+
+  void setLanelets(const lanelet::ConstLanelets & lanelets);
+
+  // append the resampled path which starts at s_start and ends at s_end along the cached lanelets
+  void appendPath(
+    const PathWithLaneId & path, const double s_start, const double s_end,
+    const bool skip_first_point);
+
+  PathWithLaneId crop(const double s_start, const double s_end) const;
+
+  // key of the cache
+  const void * lanelet_map_ptr_{nullptr};
+  unique_identifier_msgs::msg::UUID route_uuid_{};
+  Pose goal_pose_{};
+  double input_path_interval_{0.0};
+  bool enable_akima_spline_first_{false};
+
+  // lanelets whose centerline is cached, and the arc length at the start of each of them
+  lanelet::ConstLanelets lanelets_{};
+  std::vector<double> lanelet_start_s_{};
+
+  // resampled centerline, and the arc length of each point along the cached lanelets
+  PathWithLaneId path_{};
+  std::vector<double> path_s_{};
+
+  Statistics statistics_{};
+};
+}  // namespace behavior_path_planner::utils
+
+#endif  // BEHAVIOR_PATH_PLANNER_COMMON__UTILS__REFERENCE_PATH_BUILDER_HPP_
@@ -0,0 +1,44 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/path_buffer.hpp"
+
+#include "behavior_path_planner_common/utils/path_utils.hpp"
+
+#include <utility>
+
+namespace behavior_path_planner
+{
+PathBuffer::PathBuffer() : storage_(std::make_shared<Storage>(PathWithLaneId{}))
+{
+}
+
+PathBuffer::PathBuffer(const PathWithLaneId & path)
+: storage_(std::make_shared<Storage>(PathWithLaneId{path}))
+{
+}
+
+PathBuffer::PathBuffer(PathWithLaneId && path)
+: storage_(std::make_shared<Storage>(std::move(path)))
+{
+}
+
+const std::vector<double> & PathBuffer::getArcLengths() const
+{
+  std::call_once(storage_->arc_lengths_flag, [this]() {
+    storage_->arc_lengths = utils::calcPathArcLengthArray(storage_->path);
+  });
+  return storage_->arc_lengths;
+}
+}  // namespace behavior_path_planner
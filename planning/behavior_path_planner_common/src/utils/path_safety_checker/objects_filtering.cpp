@@ -320,7 +320,8 @@ ExtendedPredictedObject transform(
 
 TargetObjectsOnLane createTargetObjectsOnLane(
   const lanelet::ConstLanelets & current_lanes, const std::shared_ptr<RouteHandler> & route_handler,
-  const PredictedObjects & filtered_objects, const std::shared_ptr<ObjectsFilteringParams> & params)
+  const PredictedObjects & filtered_objects, const std::shared_ptr<ObjectsFilteringParams> & params,
+  const std::shared_ptr<const PlannerData> & planner_data)
 {
   const auto & object_lane_configuration = params->object_lane_configuration;
   const bool include_opposite = params->include_opposite_lane;
@@ -355,10 +356,16 @@ TargetObjectsOnLane createTargetObjectsOnLane(
   const auto append_objects_on_lane = [&](auto & lane_objects, const auto & check_lanes) {
     std::for_each(
       filtered_objects.objects.begin(), filtered_objects.objects.end(), [&](const auto & object) {
-        if (isCentroidWithinLanelets(object, check_lanes)) {
-          lane_objects.push_back(
-            transform(object, safety_check_time_horizon, safety_check_time_resolution));
+        if (!isCentroidWithinLanelets(object, check_lanes)) {
+          return;
         }
+        if (planner_data) {
+          lane_objects.push_back(planner_data->getExtendedPredictedObject(
+            object, safety_check_time_horizon, safety_check_time_resolution));
+          return;
+        }
+        lane_objects.push_back(
+          transform(object, safety_check_time_horizon, safety_check_time_resolution));
       });
   };
 
@@ -0,0 +1,66 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/path_safety_checker/predicted_objects_cache.hpp"
+
+#include "behavior_path_planner_common/utils/path_safety_checker/objects_filtering.hpp"
+
+namespace behavior_path_planner::utils::path_safety_checker
+{
+ExtendedPredictedObject PredictedObjectsCache::transform(
+  const PredictedObjects::ConstSharedPtr & source, const PredictedObject & object,
+  const double time_horizon, const double time_resolution)
+{
+  return getOrCreate(
+    source, object, {time_horizon, time_resolution}, [&](const PredictedObject & obj) {
+      return path_safety_checker::transform(obj, time_horizon, time_resolution);
+    });
+}
+
+ExtendedPredictedObject PredictedObjectsCache::getOrCreate(
+  const PredictedObjects::ConstSharedPtr & source, const PredictedObject & object,
+  const std::vector<double> & sampling_params,
+  const std::function<ExtendedPredictedObject(const PredictedObject &)> & create)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // the objects are updated with the new message
+  if (source != source_) {
+    objects_.clear();
+    source_ = source;
+    hit_count_ = 0;
+  }
+
+  Key key{object.object_id.uuid, sampling_params};
+  const auto itr = objects_.find(key);
+  if (itr != objects_.end()) {
+    ++hit_count_;
+    return itr->second;
+  }
+
+  return objects_.emplace(std::move(key), create(object)).first->second;
+}
+
+size_t PredictedObjectsCache::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return objects_.size();
+}
+
+size_t PredictedObjectsCache::hitCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hit_count_;
+}
+}  // namespace behavior_path_planner::utils::path_safety_checker
@@ -21,6 +21,7 @@
 #include "tier4_autoware_utils/ros/uuid_helper.hpp"
 
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
 #include <boost/geometry/algorithms/overlaps.hpp>
 #include <boost/geometry/algorithms/union.hpp>
@@ -40,6 +41,16 @@ void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point &
   bg::append(polygon.outer(), point);
 }
 
+namespace
+{
+Box2d expandBox(const Box2d & box, const double margin)
+{
+  return Box2d{
+    {box.min_corner().x() - margin, box.min_corner().y() - margin},
+    {box.max_corner().x() + margin, box.max_corner().y() + margin}};
+}
+}  // namespace
+
 bool isTargetObjectOncoming(
   const geometry_msgs::msg::Pose & vehicle_pose, const geometry_msgs::msg::Pose & object_pose)
 {
@@ -586,6 +597,7 @@ std::vector<Polygon2d> getCollidedPolygons(
     // get object information at current time
     const auto & obj_pose = obj_pose_with_poly.pose;
     const auto & obj_polygon = obj_pose_with_poly.poly;
+    const auto & obj_box = obj_pose_with_poly.box;
     const auto & object_velocity = obj_pose_with_poly.velocity;
 
     // get ego information at current time
@@ -600,9 +612,10 @@ std::vector<Polygon2d> getCollidedPolygons(
     const auto & ego_pose = interpolated_data->pose;
     const auto & ego_polygon = interpolated_data->poly;
     const auto & ego_velocity = interpolated_data->velocity;
+    const auto & ego_box = interpolated_data->box;
 
     // check overlap
-    if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
+    if (bg::intersects(ego_box, obj_box) && bg::overlaps(ego_polygon, obj_polygon)) {
       debug.unsafe_reason = "overlap_polygon";
       collided_polygons.push_back(obj_polygon);
 
@@ -629,6 +642,28 @@ std::vector<Polygon2d> getCollidedPolygons(
 
     const auto & lon_offset = std::max(rss_dist, min_lon_length) * hysteresis_factor;
     const auto & lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
+
+    // reject the pair before creating the extended polygon. the rectangular extended polygon is
+    // within the distance of lon_offset + lat_margin from the rectangle which bounds the original
+    // polygon in its local frame, and the rectangle is within the distance of
+    // sqrt(2) * (radius of the original polygon) from the pose.
+    // NOTE: the polygon extended along the path is not bounded since the path can be far from ego.
+    const auto is_far_from_each_other = [&]() {
+      if (is_object_front) {
+        return rss_parameters.extended_polygon_policy == "rectangle" &&
+               !bg::intersects(expandBox(ego_box, lon_offset + lat_margin), obj_box);
+      }
+      const auto & p = obj_pose.position;
+      const double obj_radius = std::hypot(
+        std::max(obj_box.max_corner().x() - p.x, p.x - obj_box.min_corner().x()),
+        std::max(obj_box.max_corner().y() - p.y, p.y - obj_box.min_corner().y()));
+      const double margin = std::sqrt(2.0) * obj_radius + lon_offset + lat_margin;
+      return !bg::intersects(ego_box, expandBox(Box2d{{p.x, p.y}, {p.x, p.y}}, margin));
+    }();
+    if (is_far_from_each_other) {
+      continue;
+    }
+
     // TODO(watanabe) fix hard coding value
     const bool is_stopped_object = object_velocity < 0.3;
     const auto extended_ego_polygon = [&]() {
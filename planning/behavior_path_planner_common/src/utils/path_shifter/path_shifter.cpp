@@ -58,7 +58,7 @@ using motion_utils::removeOverlapPoints;
 
 void PathShifter::setPath(const PathWithLaneId & path)
 {
-  reference_path_ = path;
+  reference_path_ = PathBuffer(path);
 
   updateShiftLinesIndices(shift_lines_);
   sortShiftLinesAlongPath(shift_lines_);
@@ -100,13 +100,13 @@ bool PathShifter::generate(
   RCLCPP_DEBUG_STREAM_THROTTLE(logger_, clock_, 3000, "PathShifter::generate start!");
 
   // Guard
-  if (reference_path_.points.empty()) {
+  if (reference_path_.empty()) {
     RCLCPP_ERROR_STREAM(logger_, "reference path is empty.");
     return false;
   }
 
-  shifted_path->path = reference_path_;
-  shifted_path->shift_length.resize(reference_path_.points.size(), 0.0);
+  shifted_path->path = reference_path_.get();
+  shifted_path->shift_length.resize(reference_path_.size(), 0.0);
 
   if (shift_lines_.empty()) {
     RCLCPP_DEBUG_STREAM_THROTTLE(
@@ -169,7 +169,7 @@ bool PathShifter::generate(
 
 void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_path_.getArcLengths();
 
   shiftBaseLength(shifted_path, base_offset_);
 
@@ -203,7 +203,7 @@ void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
 
 void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_path_.getArcLengths();
 
   shiftBaseLength(shifted_path, base_offset_);
 
@@ -391,7 +391,7 @@ std::pair<std::vector<double>, std::vector<double>> PathShifter::calcBaseLengths
 
 std::vector<double> PathShifter::calcLateralJerk() const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_path_.getArcLengths();
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
@@ -412,7 +412,7 @@ std::vector<double> PathShifter::calcLateralJerk() const
 
 void PathShifter::updateShiftLinesIndices(ShiftLineArray & shift_lines) const
 {
-  if (reference_path_.points.empty()) {
+  if (reference_path_.empty()) {
     RCLCPP_ERROR(
       logger_, "reference path is empty, setPath is needed before addShiftLine/setShiftLines.");
   }
@@ -420,10 +420,10 @@ void PathShifter::updateShiftLinesIndices(ShiftLineArray & shift_lines) const
   for (auto & l : shift_lines) {
     // TODO(murooka) remove findNearestIndex for except
     // lane_following to support u-turn & crossing path
-    l.start_idx = findNearestIndex(reference_path_.points, l.start.position);
+    l.start_idx = findNearestIndex(reference_path_.get().points, l.start.position);
     // TODO(murooka) remove findNearestIndex for except
     // lane_following to support u-turn & crossing path
-    l.end_idx = findNearestIndex(reference_path_.points, l.end.position);
+    l.end_idx = findNearestIndex(reference_path_.get().points, l.end.position);
   }
 }
 
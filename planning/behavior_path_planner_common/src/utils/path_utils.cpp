@@ -21,6 +21,7 @@
 #include <lanelet2_extension/utility/query.hpp>
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/resample/resample.hpp>
+#include <motion_utils/trajectory/path_with_lane_id.hpp>
 #include <motion_utils/trajectory/interpolation.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
@@ -585,7 +586,8 @@ std::optional<Pose> getFirstStopPoseFromPath(const PathWithLaneId & path)
 
 BehaviorModuleOutput getReferencePath(
   const lanelet::ConstLanelet & current_lane,
-  const std::shared_ptr<const PlannerData> & planner_data)
+  const std::shared_ptr<const PlannerData> & planner_data,
+  ReferencePathBuilder * reference_path_builder)
 {
   PathWithLaneId reference_path{};
 
@@ -603,9 +605,20 @@ BehaviorModuleOutput getReferencePath(
     route_handler->getLaneletSequence(current_lane, backward_length, p.forward_path_length);
   const auto no_shift_pose =
     lanelet::utils::getClosestCenterPose(current_lane, current_pose.position);
-  reference_path = getCenterLinePath(
-    *route_handler, current_lanes_with_backward_margin, no_shift_pose, backward_length,
-    p.forward_path_length, p);
+  if (reference_path_builder == nullptr) {
+    reference_path = getCenterLinePath(
+      *route_handler, current_lanes_with_backward_margin, no_shift_pose, backward_length,
+      p.forward_path_length, p);
+  } else {
+    reference_path = reference_path_builder->build(
+      *route_handler, current_lanes_with_backward_margin, no_shift_pose, backward_length,
+      p.forward_path_length, p);
+    // convert centerline, which we consider as CoG center, to rear wheel center
+    if (p.enable_cog_on_centerline && !reference_path.points.empty()) {
+      const double rear_to_cog = p.vehicle_length / 2 - p.rear_overhang;
+      reference_path = motion_utils::convertToRearWheelCenter(reference_path, rear_to_cog);
+    }
+  }
 
   // clip backward length
   // NOTE: In order to keep backward_path_length at least, resampling interval is added to the
@@ -620,16 +633,9 @@ BehaviorModuleOutput getReferencePath(
   const auto drivable_lanelets = getLaneletsFromPath(reference_path, route_handler);
   const auto drivable_lanes = generateDrivableLanes(drivable_lanelets);
 
-  const auto & dp = planner_data->drivable_area_expansion_parameters;
-
-  const auto shorten_lanes = cutOverlappedLanes(reference_path, drivable_lanes);
-  const auto expanded_lanes = expandLanelets(
-    shorten_lanes, dp.drivable_area_left_bound_offset, dp.drivable_area_right_bound_offset,
-    dp.drivable_area_types_to_skip);
-
   BehaviorModuleOutput output;
   output.path = reference_path;
-  output.reference_path = reference_path;
+  output.reference_path = std::move(reference_path);
   output.drivable_area_info.drivable_lanes = drivable_lanes;
 
   return output;
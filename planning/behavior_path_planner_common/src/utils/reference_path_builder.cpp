@@ -0,0 +1,293 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/reference_path_builder.hpp"
+
+#include "behavior_path_planner_common/utils/path_utils.hpp"
+
+#include <lanelet2_extension/utility/utilities.hpp>
+#include <motion_utils/resample/resample.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace
+{
+constexpr double epsilon = 1e-3;
+
+// number of the resampled points dropped from the end of the cache before extending it, which are
+// affected by the boundary condition of the spline
+constexpr double stitch_margin_points = 5.0;
+
+// index of the last element which is not greater than the value, or 0 if there is no such element
+size_t findLastIndexNotAfter(const std::vector<double> & sorted, const double value)
+{
+  const auto itr = std::upper_bound(sorted.begin(), sorted.end(), value);
+  return itr == sorted.begin() ? 0 : static_cast<size_t>(std::distance(sorted.begin(), itr)) - 1;
+}
+
+bool containsId(const lanelet::ConstLanelets & lanelets, const lanelet::Id id)
+{
+  return std::any_of(
+    lanelets.begin(), lanelets.end(), [&id](const auto & lanelet) { return lanelet.id() == id; });
+}
+}  // namespace
+
+namespace behavior_path_planner::utils
+{
+PathWithLaneId ReferencePathBuilder::build(
+  const RouteHandler & route_handler, const lanelet::ConstLanelets & lanelet_sequence,
+  const Pose & pose, const double backward_path_length, const double forward_path_length,
+  const BehaviorPathPlannerParameters & parameter)
+{
+  if (lanelet_sequence.empty()) {
+    return PathWithLaneId{};
+  }
+
+  // same range as getCenterLinePath()
+  const auto arc_coordinates = lanelet::utils::getArcCoordinates(lanelet_sequence, pose);
+  const double s = arc_coordinates.length;
+  const double s_backward = std::max(0., s - backward_path_length);
+  double s_forward = s + forward_path_length;
+
+  if (route_handler.isDeadEndLanelet(lanelet_sequence.back())) {
+    const auto lane_length = lanelet::utils::getLaneletLength2d(lanelet_sequence);
+    s_forward = std::clamp(s_forward, 0.0, lane_length);
+  }
+
+  if (route_handler.isInGoalRouteSection(lanelet_sequence.back())) {
+    const auto goal_arc_coordinates =
+      lanelet::utils::getArcCoordinates(lanelet_sequence, route_handler.getGoalPose());
+    s_forward = std::clamp(s_forward, 0.0, goal_arc_coordinates.length);
+  }
+
+  if (!isValid(route_handler, parameter)) {
+    clear();
+    lanelet_map_ptr_ = route_handler.getLaneletMapPtr().get();
+    route_uuid_ = route_handler.getRouteUuid();
+    goal_pose_ = route_handler.getGoalPose();
+    input_path_interval_ = parameter.input_path_interval;
+    enable_akima_spline_first_ = parameter.enable_akima_spline_first;
+  }
+
+  // crop the cached path if it covers the requested range
+  const auto offset = findOffset(lanelet_sequence);
+  if (
+    offset && !path_s_.empty() && path_s_.front() <= *offset + s_backward + epsilon &&
+    *offset + s_forward <= path_s_.back() + epsilon) {
+    ++statistics_.hit_count;
+    return crop(*offset + s_backward, *offset + s_forward);
+  }
+
+  // keep the path of the forward length ahead of the requested range so that the following
+  // cycles hit the cache
+  const auto lanelets = getExtendedLanelets(route_handler, lanelet_sequence, forward_path_length);
+  double s_end =
+    std::min(s_forward + forward_path_length, lanelet::utils::getLaneletLength2d(lanelets));
+  if (route_handler.isInGoalRouteSection(lanelets.back())) {
+    const auto goal_arc_coordinates =
+      lanelet::utils::getArcCoordinates(lanelets, route_handler.getGoalPose());
+    s_end = std::clamp(s_end, 0.0, goal_arc_coordinates.length);
+  }
+  s_end = std::max(s_end, s_forward);
+
+  // extend the cached path if the new lanelets continue from the cached ones. the cached points
+  // behind the requested range are trimmed, and the centerline is resampled only after the
+  // stitch point near the end of the cache.
+  const bool is_extendable = std::invoke([&]() {
+    if (!offset || path_s_.empty() || *offset + s_backward + epsilon < path_s_.front()) {
+      return false;
+    }
+    const auto front_itr = std::find_if(
+      lanelets_.begin(), lanelets_.end(),
+      [&](const auto & lanelet) { return lanelet.id() == lanelets.front().id(); });
+    const auto num_common = static_cast<size_t>(std::distance(front_itr, lanelets_.end()));
+    if (num_common > lanelets.size()) {
+      return false;
+    }
+    return std::equal(
+      front_itr, lanelets_.end(), lanelets.begin(),
+      [](const auto & a, const auto & b) { return a.id() == b.id(); });
+  });
+
+  if (is_extendable) {
+    const double stitch_s =
+      path_s_.back() - stitch_margin_points * parameter.input_path_interval - *offset;
+    const auto begin_idx = findLastIndexNotAfter(path_s_, *offset + s_backward);
+    const auto stitch_idx = findLastIndexNotAfter(path_s_, *offset + stitch_s) + 1;
+
+    if (begin_idx + 1 < stitch_idx && s_backward < stitch_s && stitch_s < s_end) {
+      PathWithLaneId cached_path;
+      cached_path.header = path_.header;
+      cached_path.points.assign(
+        path_.points.begin() + begin_idx, path_.points.begin() + stitch_idx);
+      std::vector<double> cached_s(path_s_.begin() + begin_idx, path_s_.begin() + stitch_idx);
+      const double new_start_s = cached_s.back() - *offset;
+
+      const auto raw_path = route_handler.getCenterLinePath(lanelets, new_start_s, s_end, true);
+      const auto resampled_path = motion_utils::resamplePath(
+        raw_path, parameter.input_path_interval, parameter.enable_akima_spline_first);
+
+      setLanelets(lanelets);
+      path_ = std::move(cached_path);
+      path_s_.clear();
+      for (const auto cached_point_s : cached_s) {
+        path_s_.push_back(cached_point_s - *offset);
+      }
+      appendPath(resampled_path, new_start_s, s_end, true);
+
+      ++statistics_.extend_count;
+      return crop(s_backward, s_forward);
+    }
+  }
+
+  // rebuild the cache from the lanelets
+  const auto raw_path = route_handler.getCenterLinePath(lanelets, s_backward, s_end, true);
+  const auto resampled_path = motion_utils::resamplePath(
+    raw_path, parameter.input_path_interval, parameter.enable_akima_spline_first);
+
+  setLanelets(lanelets);
+  path_ = PathWithLaneId{};
+  path_.header = resampled_path.header;
+  path_s_.clear();
+  appendPath(resampled_path, s_backward, s_end, false);
+
+  ++statistics_.miss_count;
+  return crop(s_backward, s_forward);
+}
+
+void ReferencePathBuilder::clear()
+{
+  lanelets_.clear();
+  lanelet_start_s_.clear();
+  path_ = PathWithLaneId{};
+  path_s_.clear();
+}
+
+bool ReferencePathBuilder::isValid(
+  const RouteHandler & route_handler, const BehaviorPathPlannerParameters & parameter) const
+{
+  const auto goal_pose = route_handler.getGoalPose();
+  return lanelet_map_ptr_ == route_handler.getLaneletMapPtr().get() &&
+         route_uuid_ == route_handler.getRouteUuid() &&
+         tier4_autoware_utils::calcDistance2d(goal_pose_, goal_pose) < epsilon &&
+         input_path_interval_ == parameter.input_path_interval &&
+         enable_akima_spline_first_ == parameter.enable_akima_spline_first;
+}
+
+std::optional<double> ReferencePathBuilder::findOffset(
+  const lanelet::ConstLanelets & lanelet_sequence) const
+{
+  const auto front_itr =
+    std::find_if(lanelets_.begin(), lanelets_.end(), [&](const auto & lanelet) {
+      return lanelet.id() == lanelet_sequence.front().id();
+    });
+  if (front_itr == lanelets_.end()) {
+    return std::nullopt;
+  }
+
+  // the lanelet sequence may continue after the cached lanelets when the ego comes close to the
+  // end of the cache, so only the common part has to be the same
+  const auto front_idx = static_cast<size_t>(std::distance(lanelets_.begin(), front_itr));
+  const auto num_common = std::min(lanelets_.size() - front_idx, lanelet_sequence.size());
+  for (size_t i = 0; i < num_common; ++i) {
+    if (lanelets_.at(front_idx + i).id() != lanelet_sequence.at(i).id()) {
+      return std::nullopt;
+    }
+  }
+
+  return lanelet_start_s_.at(front_idx);
+}
+
+lanelet::ConstLanelets ReferencePathBuilder::getExtendedLanelets(
+  const RouteHandler & route_handler, const lanelet::ConstLanelets & lanelet_sequence,
+  const double extension_length) const
+{
+  auto lanelets = lanelet_sequence;
+  if (route_handler.isDeadEndLanelet(lanelet_sequence.back())) {
+    return lanelets;
+  }
+
+  const auto following_lanelets =
+    route_handler.getLaneletSequence(lanelet_sequence.back(), 0.0, extension_length);
+  const auto back_itr = std::find_if(
+    following_lanelets.begin(), following_lanelets.end(),
+    [&](const auto & lanelet) { return lanelet.id() == lanelet_sequence.back().id(); });
+  if (back_itr == following_lanelets.end()) {
+    return lanelets;
+  }
+
+  for (auto itr = std::next(back_itr); itr != following_lanelets.end(); ++itr) {
+    // avoid looping the route
+    if (containsId(lanelets, itr->id())) {
+      break;
+    }
+    lanelets.push_back(*itr);
+  }
+
+  return lanelets;
+}
+
+void ReferencePathBuilder::setLanelets(const lanelet::ConstLanelets & lanelets)
+{
+  lanelets_ = lanelets;
+  lanelet_start_s_.clear();
+  double s = 0.0;
+  for (const auto & lanelet : lanelets_) {
+    lanelet_start_s_.push_back(s);
+    s += lanelet::utils::getLaneletLength2d(lanelet);
+  }
+}
+
+void ReferencePathBuilder::appendPath(
+  const PathWithLaneId & path, const double s_start, const double s_end,
+  const bool skip_first_point)
+{
+  if (path.points.empty()) {
+    return;
+  }
+
+  // the length of the spline is slightly different from the length of the lanelets, so the arc
+  // length of the points is scaled to the range along the lanelets
+  const auto arc_lengths = calcPathArcLengthArray(path);
+  const double scale = arc_lengths.back() > epsilon ? (s_end - s_start) / arc_lengths.back() : 0.0;
+
+  for (size_t i = skip_first_point ? 1 : 0; i < path.points.size(); ++i) {
+    path_.points.push_back(path.points.at(i));
+    path_s_.push_back(s_start + arc_lengths.at(i) * scale);
+  }
+}
+
+PathWithLaneId ReferencePathBuilder::crop(const double s_start, const double s_end) const
+{
+  PathWithLaneId path;
+  path.header = path_.header;
+  if (path_.points.empty()) {
+    return path;
+  }
+
+  // from the last point before the start to the first point after the end
+  const auto begin_idx = findLastIndexNotAfter(path_s_, s_start + epsilon);
+  const auto end_itr = std::lower_bound(path_s_.begin(), path_s_.end(), s_end - epsilon);
+  const auto end_idx = std::min(
+    static_cast<size_t>(std::distance(path_s_.begin(), end_itr)), path_.points.size() - 1);
+
+  path.points.assign(path_.points.begin() + begin_idx, path_.points.begin() + end_idx + 1);
+  return path;
+}
+}  // namespace behavior_path_planner::utils
@@ -0,0 +1,70 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/path_buffer.hpp"
+#include "behavior_path_planner_common/utils/path_utils.hpp"
+
+#include <gtest/gtest.h>
+
+using autoware_auto_planning_msgs::msg::PathPointWithLaneId;
+using behavior_path_planner::PathBuffer;
+using behavior_path_planner::PathWithLaneId;
+
+namespace
+{
+PathWithLaneId createStraightPath(const size_t size)
+{
+  PathWithLaneId path;
+  for (size_t i = 0; i < size; ++i) {
+    PathPointWithLaneId p;
+    p.point.pose.position.x = static_cast<double>(i);
+    path.points.push_back(p);
+  }
+  return path;
+}
+}  // namespace
+
+TEST(PathBufferTest, SharedBetweenCopies)
+{
+  const PathBuffer buffer(createStraightPath(10));
+  EXPECT_FALSE(buffer.isShared());
+
+  {
+    const PathBuffer copied = buffer;
+    EXPECT_TRUE(buffer.isShared());
+    EXPECT_EQ(&buffer.get(), &copied.get());
+    EXPECT_EQ(copied.size(), 10u);
+  }
+  EXPECT_FALSE(buffer.isShared());
+
+  const PathBuffer empty_buffer;
+  EXPECT_TRUE(empty_buffer.empty());
+  EXPECT_EQ(empty_buffer.size(), 0u);
+}
+
+TEST(PathBufferTest, CachedArcLengths)
+{
+  const auto path = createStraightPath(10);
+  const PathBuffer buffer(path);
+  const PathBuffer copied = buffer;
+
+  const auto expected = behavior_path_planner::utils::calcPathArcLengthArray(path);
+  ASSERT_EQ(buffer.getArcLengths().size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_DOUBLE_EQ(buffer.getArcLengths().at(i), expected.at(i));
+  }
+
+  // the cache is shared between the copies
+  EXPECT_EQ(&buffer.getArcLengths(), &copied.getArcLengths());
+}
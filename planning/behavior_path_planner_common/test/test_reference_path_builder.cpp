@@ -0,0 +1,209 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "behavior_path_planner_common/utils/reference_path_builder.hpp"
+#include "behavior_path_planner_common/utils/utils.hpp"
+#include "planning_test_utils/planning_interface_test_manager_utils.hpp"
+
+#include <lanelet2_extension/utility/utilities.hpp>
+#include <motion_utils/resample/resample.hpp>
+#include <motion_utils/trajectory/trajectory.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+using autoware_planning_msgs::msg::LaneletRoute;
+using behavior_path_planner::BehaviorPathPlannerParameters;
+using behavior_path_planner::utils::ReferencePathBuilder;
+using geometry_msgs::msg::Pose;
+using route_handler::RouteHandler;
+
+namespace
+{
+// the lanelets from 113 to 18 in the test map are about 100 m long without a lane change
+constexpr lanelet::Id start_lane_id = 113;
+constexpr lanelet::Id goal_lane_id = 18;
+
+// short enough that the cache is extended while the ego drives along the route
+constexpr double backward_path_length = 5.0;
+constexpr double forward_path_length = 20.0;
+
+// the builder and getCenterLinePath() resample the same centerline from different points
+constexpr double lateral_tolerance = 0.1;
+constexpr double epsilon = 1e-3;
+
+BehaviorPathPlannerParameters createParameters()
+{
+  BehaviorPathPlannerParameters p{};
+  p.backward_path_length = backward_path_length;
+  p.forward_path_length = forward_path_length;
+  p.input_path_interval = 2.0;
+  p.enable_akima_spline_first = false;
+  p.enable_cog_on_centerline = false;
+  return p;
+}
+
+std::shared_ptr<RouteHandler> createRouteHandler(const LaneletRoute & route)
+{
+  auto route_handler = std::make_shared<RouteHandler>(test_utils::makeMapBinMsg());
+  route_handler->setRoute(route);
+  return route_handler;
+}
+
+// poses along the centerline of the route from the start to the goal
+std::vector<Pose> createEgoPoses(const RouteHandler & route_handler, const double interval)
+{
+  lanelet::ConstLanelet start_lane;
+  if (!route_handler.getClosestLaneletWithinRoute(
+        route_handler.getOriginalStartPose(), &start_lane)) {
+    return {};
+  }
+  const auto lanes = route_handler.getLaneletSequence(start_lane, 0.0, 1000.0);
+  const double s_start =
+    lanelet::utils::getArcCoordinates(lanes, route_handler.getOriginalStartPose()).length;
+  const double s_goal =
+    lanelet::utils::getArcCoordinates(lanes, route_handler.getGoalPose()).length;
+  const auto centerline = motion_utils::resamplePath(
+    route_handler.getCenterLinePath(lanes, s_start, s_goal, true), interval);
+
+  std::vector<Pose> poses;
+  for (const auto & point : centerline.points) {
+    poses.push_back(point.point.pose);
+  }
+  return poses;
+}
+
+// the path is on the centerline of getCenterLinePath(), and longer by less than the resampling
+// interval on both ends
+void expectSamePath(
+  const RouteHandler & route_handler, const PathWithLaneId & path, const PathWithLaneId & expected,
+  const double interval)
+{
+  ASSERT_FALSE(expected.points.empty());
+  ASSERT_FALSE(path.points.empty());
+
+  const double front_offset =
+    motion_utils::calcSignedArcLength(expected.points, 0, path.points.front().point.pose.position);
+  EXPECT_LE(front_offset, epsilon);
+  EXPECT_GE(front_offset, -interval - epsilon);
+
+  const double back_offset = motion_utils::calcSignedArcLength(
+    expected.points, path.points.back().point.pose.position, expected.points.size() - 1);
+  EXPECT_LE(back_offset, epsilon);
+  EXPECT_GE(back_offset, -interval - epsilon);
+
+  const double expected_length = motion_utils::calcArcLength(expected.points);
+  for (const auto & point : path.points) {
+    const auto & position = point.point.pose.position;
+    const double s = motion_utils::calcSignedArcLength(expected.points, 0, position);
+    if (0.0 <= s && s <= expected_length) {
+      const double lateral_offset = motion_utils::calcLateralOffset(expected.points, position);
+      EXPECT_NEAR(lateral_offset, 0.0, lateral_tolerance);
+    }
+
+    ASSERT_FALSE(point.lane_ids.empty());
+    for (const auto lane_id : point.lane_ids) {
+      EXPECT_TRUE(route_handler.isRouteLanelet(route_handler.getLaneletsFromId(lane_id)));
+    }
+  }
+}
+
+// plan the reference path around the ego in the same way as getReferencePath()
+void buildAndCompare(
+  ReferencePathBuilder & builder, const RouteHandler & route_handler, const Pose & ego_pose,
+  const BehaviorPathPlannerParameters & p)
+{
+  lanelet::ConstLanelet current_lane;
+  ASSERT_TRUE(route_handler.getClosestLaneletWithinRoute(ego_pose, &current_lane));
+  const auto lanes =
+    route_handler.getLaneletSequence(current_lane, p.backward_path_length, p.forward_path_length);
+  const auto no_shift_pose = lanelet::utils::getClosestCenterPose(current_lane, ego_pose.position);
+
+  const auto path = builder.build(
+    route_handler, lanes, no_shift_pose, p.backward_path_length, p.forward_path_length, p);
+  const auto expected = behavior_path_planner::utils::getCenterLinePath(
+    route_handler, lanes, no_shift_pose, p.backward_path_length, p.forward_path_length, p);
+
+  expectSamePath(route_handler, path, expected, p.input_path_interval);
+}
+}  // namespace
+
+TEST(ReferencePathBuilder, sameAsCenterLinePathWhileEgoAdvances)
+{
+  const auto route = test_utils::makeBehaviorRouteFromLaneId(start_lane_id, goal_lane_id);
+  ASSERT_FALSE(route.segments.empty());
+  const auto route_handler = createRouteHandler(route);
+  const auto p = createParameters();
+
+  const auto ego_poses = createEgoPoses(*route_handler, 1.0);
+  ASSERT_GT(ego_poses.size(), 50u);
+
+  ReferencePathBuilder builder;
+  for (const auto & ego_pose : ego_poses) {
+    buildAndCompare(builder, *route_handler, ego_pose, p);
+  }
+
+  // the path is built only at the start, cropped from the cache while the ego moves inside of
+  // it, and extended forward when the ego comes close to the end of the cache
+  const auto & statistics = builder.getStatistics();
+  EXPECT_EQ(statistics.miss_count, 1u);
+  EXPECT_GT(statistics.hit_count, 0u);
+  EXPECT_GT(statistics.extend_count, 0u);
+  EXPECT_EQ(
+    statistics.hit_count + statistics.extend_count + statistics.miss_count, ego_poses.size());
+}
+
+TEST(ReferencePathBuilder, rebuildOnRouteChange)
+{
+  auto route = test_utils::makeBehaviorRouteFromLaneId(start_lane_id, goal_lane_id);
+  ASSERT_FALSE(route.segments.empty());
+  const auto route_handler = createRouteHandler(route);
+  auto p = createParameters();
+
+  // the ego near the goal, where the path is cut at the goal
+  const auto ego_pose = test_utils::createPoseFromLaneID(9494);
+
+  ReferencePathBuilder builder;
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  EXPECT_EQ(builder.getStatistics().miss_count, 1u);
+  EXPECT_EQ(builder.getStatistics().hit_count, 1u);
+
+  // same lanelets with another route id
+  route.uuid.uuid.at(0) += 1;
+  route_handler->setRoute(route);
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  EXPECT_EQ(builder.getStatistics().miss_count, 2u);
+
+  // the goal moves backward inside of the cached path, which has to be cut at the new goal
+  auto near_goal_route = test_utils::makeBehaviorRouteFromLaneId(start_lane_id, 9463);
+  ASSERT_FALSE(near_goal_route.segments.empty());
+  near_goal_route.uuid = route.uuid;
+  route_handler->setRoute(near_goal_route);
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  EXPECT_EQ(builder.getStatistics().miss_count, 3u);
+
+  // the resampling interval changes
+  p.input_path_interval = 1.0;
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  EXPECT_EQ(builder.getStatistics().miss_count, 4u);
+
+  // the cache is used again for the new route
+  buildAndCompare(builder, *route_handler, ego_pose, p);
+  EXPECT_EQ(builder.getStatistics().miss_count, 4u);
+  EXPECT_EQ(builder.getStatistics().hit_count, 2u);
+}
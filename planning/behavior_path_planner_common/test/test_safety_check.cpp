@@ -14,6 +14,7 @@
 
 #include "behavior_path_planner_common/marker_utils/utils.hpp"
 #include "behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
+#include "behavior_path_planner_common/utils/path_safety_checker/predicted_objects_cache.hpp"
 #include "behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
 
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
@@ -201,3 +202,49 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, calcRssDistance)
     EXPECT_NEAR(calcRssDistance(front_vel, rear_vel, params), 63.75, epsilon);
   }
 }
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, PredictedObjectsCache)
+{
+  using autoware_auto_perception_msgs::msg::PredictedObject;
+  using autoware_auto_perception_msgs::msg::PredictedObjects;
+  using behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObject;
+  using behavior_path_planner::utils::path_safety_checker::PredictedObjectsCache;
+
+  PredictedObject object;
+  object.object_id.uuid.at(0) = 1;
+  auto objects = std::make_shared<PredictedObjects>();
+  objects->objects.push_back(object);
+
+  size_t create_count = 0;
+  const auto create = [&create_count](const PredictedObject & obj) {
+    ++create_count;
+    ExtendedPredictedObject extended_object;
+    extended_object.uuid = obj.object_id;
+    return extended_object;
+  };
+
+  PredictedObjectsCache cache;
+  {
+    // the object is created once for the same message and parameters
+    const auto obj_1 = cache.getOrCreate(objects, object, {1.0, 0.5}, create);
+    const auto obj_2 = cache.getOrCreate(objects, object, {1.0, 0.5}, create);
+    EXPECT_EQ(create_count, 1u);
+    EXPECT_EQ(cache.hitCount(), 1u);
+    EXPECT_EQ(obj_1.uuid, obj_2.uuid);
+  }
+
+  {
+    // different parameters are cached separately
+    cache.getOrCreate(objects, object, {1.0, 0.25}, create);
+    EXPECT_EQ(create_count, 2u);
+    EXPECT_EQ(cache.size(), 2u);
+  }
+
+  {
+    // the cache is cleared with the new message
+    const auto new_objects = std::make_shared<PredictedObjects>(*objects);
+    cache.getOrCreate(new_objects, object, {1.0, 0.5}, create);
+    EXPECT_EQ(create_count, 3u);
+    EXPECT_EQ(cache.size(), 1u);
+  }
+}
@@ -1248,7 +1248,7 @@ bool StartPlannerModule::isSafePath() const
 
   // filtering objects based on the current position's lane
   const auto target_objects_on_lane = utils::path_safety_checker::createTargetObjectsOnLane(
-    current_lanes, route_handler, filtered_objects, objects_filtering_params_);
+    current_lanes, route_handler, filtered_objects, objects_filtering_params_, planner_data_);
 
   const double hysteresis_factor =
     status_.is_safe_dynamic_objects ? 1.0 : safety_check_params_->hysteresis_factor_expand_rate;
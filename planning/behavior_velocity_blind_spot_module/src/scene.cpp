@@ -22,9 +22,8 @@
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
 
-#include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/distance.hpp>
-#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/union.hpp>
 
 #include <lanelet2_core/Forward.h>
@@ -301,9 +300,14 @@ std::optional<lanelet::ConstLanelet> BlindSpotModule::getFirstConflictingLanelet
     const auto & pose = interpolated_path_info.path.points.at(i).point.pose;
     const auto path_footprint = tier4_autoware_utils::transformVector(
       local_footprint, tier4_autoware_utils::pose2transform(pose));
+    tier4_autoware_utils::Box2d path_footprint_box;
+    bg::envelope(path_footprint, path_footprint_box);
     for (const auto & conflicting : conflicting_ex_sibling_lanes) {
-      const auto area2d = conflicting.polygon2d().basicPolygon();
-      const bool is_in_polygon = bg::intersects(area2d, path_footprint);
+      const auto geometry = planner_data_->lanelet_geometry_cache_->getLaneletGeometry(conflicting);
+      if (!bg::intersects(path_footprint_box, geometry->bounding_box)) {
+        continue;
+      }
+      const bool is_in_polygon = bg::intersects(geometry->polygon, path_footprint);
       if (is_in_polygon) {
         return std::make_optional<lanelet::ConstLanelet>(conflicting);
       }
@@ -573,9 +577,8 @@ lanelet::ConstLanelet BlindSpotModule::generateHalfLanelet(
 lanelet::ConstLanelet BlindSpotModule::generateExtendedAdjacentLanelet(
   const lanelet::ConstLanelet lanelet, const TurnDirection direction) const
 {
-  const auto centerline = lanelet.centerline2d();
-  const auto width =
-    boost::geometry::area(lanelet.polygon2d().basicPolygon()) / boost::geometry::length(centerline);
+  const auto geometry = planner_data_->lanelet_geometry_cache_->getLaneletGeometry(lanelet);
+  const auto width = geometry->area / geometry->centerline_arc_lengths.back();
   const double extend_width = std::min<double>(planner_param_.adjacent_extend_width, width);
   const auto left_bound_ =
     direction == TurnDirection::LEFT
@@ -603,9 +606,8 @@ lanelet::ConstLanelet BlindSpotModule::generateExtendedAdjacentLanelet(
 lanelet::ConstLanelet BlindSpotModule::generateExtendedOppositeAdjacentLanelet(
   const lanelet::ConstLanelet lanelet, const TurnDirection direction) const
 {
-  const auto centerline = lanelet.centerline2d();
-  const auto width =
-    boost::geometry::area(lanelet.polygon2d().basicPolygon()) / boost::geometry::length(centerline);
+  const auto geometry = planner_data_->lanelet_geometry_cache_->getLaneletGeometry(lanelet);
+  const auto width = geometry->area / geometry->centerline_arc_lengths.back();
   const double extend_width =
     std::min<double>(planner_param_.opposite_adjacent_extend_width, width);
   const auto left_bound_ =
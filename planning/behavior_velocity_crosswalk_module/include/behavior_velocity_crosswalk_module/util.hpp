@@ -102,6 +102,12 @@ std::vector<geometry_msgs::msg::Point> getPolygonIntersects(
   const PathWithLaneId & ego_path, const lanelet::BasicPolygon2d & polygon,
   const geometry_msgs::msg::Point & ego_pos, const size_t max_num);
 
+// same as above, but the polygon of the lanelet and the intersections are taken from the cache
+std::vector<geometry_msgs::msg::Point> getPolygonIntersects(
+  const PathWithLaneId & ego_path, const lanelet::ConstLanelet & lanelet,
+  const geometry_msgs::msg::Point & ego_pos, const size_t max_num,
+  LaneletGeometryCache & geometry_cache);
+
 std::vector<geometry_msgs::msg::Point> getLinestringIntersects(
   const PathWithLaneId & ego_path, const lanelet::BasicLineString2d & linestring,
   const geometry_msgs::msg::Point & ego_pos, const size_t max_num);
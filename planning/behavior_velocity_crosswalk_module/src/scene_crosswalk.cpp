@@ -112,13 +112,11 @@ Polygon2d createMultiStepPolygon(
 
 void sortCrosswalksByDistance(
   const PathWithLaneId & ego_path, const geometry_msgs::msg::Point & ego_pos,
-  lanelet::ConstLanelets & crosswalks)
+  lanelet::ConstLanelets & crosswalks, LaneletGeometryCache & geometry_cache)
 {
   const auto compare = [&](const lanelet::ConstLanelet & l1, const lanelet::ConstLanelet & l2) {
-    const auto l1_intersects =
-      getPolygonIntersects(ego_path, l1.polygon2d().basicPolygon(), ego_pos, 2);
-    const auto l2_intersects =
-      getPolygonIntersects(ego_path, l2.polygon2d().basicPolygon(), ego_pos, 2);
+    const auto l1_intersects = getPolygonIntersects(ego_path, l1, ego_pos, 2, geometry_cache);
+    const auto l2_intersects = getPolygonIntersects(ego_path, l2, ego_pos, 2, geometry_cache);
 
     if (l1_intersects.empty() || l2_intersects.empty()) {
       return true;
@@ -226,8 +224,8 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * sto
   recordTime(1);
 
   // Calculate intersection between path and crosswalks
-  const auto path_intersects =
-    getPolygonIntersects(*path, crosswalk_.polygon2d().basicPolygon(), ego_pos, 2);
+  const auto path_intersects = getPolygonIntersects(
+    *path, crosswalk_, ego_pos, 2, *planner_data_->lanelet_geometry_cache_);
 
   // Apply safety slow down speed if defined in Lanelet2 map
   if (crosswalk_.hasAttribute("safety_slow_down_speed")) {
@@ -569,7 +567,7 @@ std::pair<double, double> CrosswalkModule::clampAttentionRangeByNeighborCrosswal
     }
   }
 
-  sortCrosswalksByDistance(ego_path, ego_pos, crosswalks);
+  sortCrosswalksByDistance(ego_path, ego_pos, crosswalks, *planner_data_->lanelet_geometry_cache_);
 
   std::optional<lanelet::ConstLanelet> prev_crosswalk{std::nullopt};
   std::optional<lanelet::ConstLanelet> next_crosswalk{std::nullopt};
@@ -597,7 +595,7 @@ std::pair<double, double> CrosswalkModule::clampAttentionRangeByNeighborCrosswal
     std::reverse(reverse_ego_path.points.begin(), reverse_ego_path.points.end());
 
     const auto prev_crosswalk_intersects = getPolygonIntersects(
-      reverse_ego_path, prev_crosswalk->polygon2d().basicPolygon(), ego_pos, 2);
+      reverse_ego_path, *prev_crosswalk, ego_pos, 2, *planner_data_->lanelet_geometry_cache_);
     if (prev_crosswalk_intersects.empty()) {
       return near_attention_range;
     }
@@ -611,8 +609,8 @@ std::pair<double, double> CrosswalkModule::clampAttentionRangeByNeighborCrosswal
     if (!next_crosswalk) {
       return far_attention_range;
     }
-    const auto next_crosswalk_intersects =
-      getPolygonIntersects(ego_path, next_crosswalk->polygon2d().basicPolygon(), ego_pos, 2);
+    const auto next_crosswalk_intersects = getPolygonIntersects(
+      ego_path, *next_crosswalk, ego_pos, 2, *planner_data_->lanelet_geometry_cache_);
 
     if (next_crosswalk_intersects.empty()) {
       return far_attention_range;
@@ -110,6 +110,34 @@ bool checkRegulatoryElementExistence(const lanelet::LaneletMapPtr & lanelet_map_
   return !lanelet::utils::query::crosswalks(all_lanelets).empty();
 }
 
+namespace
+{
+// sort the intersects by the arc length along the path, and convert them to geometry points
+std::vector<geometry_msgs::msg::Point> sortIntersectsAlongPath(
+  const PathWithLaneId & ego_path, std::vector<Point2d> & intersects,
+  const geometry_msgs::msg::Point & ego_pos)
+{
+  const auto compare = [&](const Point2d & p1, const Point2d & p2) {
+    const auto dist_l1 =
+      calcSignedArcLength(ego_path.points, size_t(0), createPoint(p1.x(), p1.y(), ego_pos.z));
+
+    const auto dist_l2 =
+      calcSignedArcLength(ego_path.points, size_t(0), createPoint(p2.x(), p2.y(), ego_pos.z));
+
+    return dist_l1 < dist_l2;
+  };
+
+  std::sort(intersects.begin(), intersects.end(), compare);
+
+  // convert tier4_autoware_utils::Point2d to geometry::msg::Point
+  std::vector<geometry_msgs::msg::Point> geometry_points;
+  for (const auto & p : intersects) {
+    geometry_points.push_back(createPoint(p.x(), p.y(), ego_pos.z));
+  }
+  return geometry_points;
+}
+}  // namespace
+
 std::vector<geometry_msgs::msg::Point> getPolygonIntersects(
   const PathWithLaneId & ego_path, const lanelet::BasicPolygon2d & polygon,
   const geometry_msgs::msg::Point & ego_pos,
@@ -139,24 +167,23 @@ std::vector<geometry_msgs::msg::Point> getPolygonIntersects(
     }
   }
 
-  const auto compare = [&](const Point2d & p1, const Point2d & p2) {
-    const auto dist_l1 =
-      calcSignedArcLength(ego_path.points, size_t(0), createPoint(p1.x(), p1.y(), ego_pos.z));
-
-    const auto dist_l2 =
-      calcSignedArcLength(ego_path.points, size_t(0), createPoint(p2.x(), p2.y(), ego_pos.z));
-
-    return dist_l1 < dist_l2;
-  };
-
-  std::sort(intersects.begin(), intersects.end(), compare);
+  return sortIntersectsAlongPath(ego_path, intersects, ego_pos);
+}
 
-  // convert tier4_autoware_utils::Point2d to geometry::msg::Point
-  std::vector<geometry_msgs::msg::Point> geometry_points;
-  for (const auto & p : intersects) {
-    geometry_points.push_back(createPoint(p.x(), p.y(), ego_pos.z));
+std::vector<geometry_msgs::msg::Point> getPolygonIntersects(
+  const PathWithLaneId & ego_path, const lanelet::ConstLanelet & lanelet,
+  const geometry_msgs::msg::Point & ego_pos, const size_t max_num,
+  LaneletGeometryCache & geometry_cache)
+{
+  std::vector<Point2d> intersects{};
+  for (const auto & intersection : geometry_cache.getPathIntersections(ego_path, lanelet)) {
+    if (intersects.size() == max_num) {
+      break;
+    }
+    intersects.push_back(intersection.point);
   }
-  return geometry_points;
+
+  return sortIntersectsAlongPath(ego_path, intersects, ego_pos);
 }
 
 std::vector<geometry_msgs::msg::Point> getLinestringIntersects(
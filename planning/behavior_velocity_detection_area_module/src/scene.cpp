@@ -282,12 +282,15 @@ std::vector<geometry_msgs::msg::Point> DetectionAreaModule::getObstaclePoints()
 
   for (const auto & detection_area : detection_areas) {
     const auto poly = lanelet::utils::to2D(detection_area);
+    const auto area_geometry =
+      planner_data_->lanelet_geometry_cache_->getPolygonGeometry(detection_area);
+    const auto & area_poly = area_geometry->polygon;
     const auto circle = calcSmallestEnclosingCircle(poly);
     for (const auto p : points) {
       const double squared_dist = (circle.first.x() - p.x) * (circle.first.x() - p.x) +
                                   (circle.first.y() - p.y) * (circle.first.y() - p.y);
       if (squared_dist <= circle.second) {
-        if (bg::within(Point2d{p.x, p.y}, poly.basicPolygon())) {
+        if (bg::within(Point2d{p.x, p.y}, area_poly)) {
           obstacle_points.push_back(tier4_autoware_utils::createPoint(p.x, p.y, p.z));
           // get all obstacle point becomes high computation cost so skip if any point is found
           break;
@@ -21,6 +21,7 @@
 
 #include <lanelet2_core/primitives/BasicRegulatoryElements.h>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <set>
@@ -291,6 +292,11 @@ IntersectionModuleManager::IntersectionModuleManager(rclcpp::Node & node)
       getOrDeclareParameter<double>(node, ns + ".occlusion.creep_velocity_without_traffic_light");
     ip.occlusion.static_occlusion_with_traffic_light_timeout = getOrDeclareParameter<double>(
       node, ns + ".occlusion.static_occlusion_with_traffic_light_timeout");
+    ip.occlusion.num_threads = getOrDeclareParameter<int>(node, ns + ".occlusion.num_threads");
+    if (ip.occlusion.num_threads != 1) {
+      occlusion_thread_pool_ = std::make_shared<tier4_autoware_utils::ThreadPool>(
+        static_cast<size_t>(std::max(ip.occlusion.num_threads, 0)));
+    }
   }
 
   ip.debug.ttc = getOrDeclareParameter<std::vector<int64_t>>(node, ns + ".debug.ttc");
@@ -339,7 +345,8 @@ void IntersectionModuleManager::launchNewModules(
     }
     const auto new_module = std::make_shared<IntersectionModule>(
       module_id, lane_id, planner_data_, intersection_param_, associative_ids, turn_direction,
-      has_traffic_light, node_, logger_.get_child("intersection_module"), clock_);
+      has_traffic_light, occlusion_thread_pool_, node_, logger_.get_child("intersection_module"),
+      clock_);
     generateUUID(module_id);
     /* set RTC status as non_occluded status initially */
     const UUID uuid = getUUID(new_module->getModuleId());
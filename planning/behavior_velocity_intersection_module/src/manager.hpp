@@ -43,6 +43,7 @@ public:
 
 private:
   IntersectionModule::PlannerParam intersection_param_;
+  std::shared_ptr<tier4_autoware_utils::ThreadPool> occlusion_thread_pool_;
   // additional for INTERSECTION_OCCLUSION
   RTCInterface occlusion_rtc_interface_;
 
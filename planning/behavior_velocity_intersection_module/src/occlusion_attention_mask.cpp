@@ -0,0 +1,162 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "occlusion_attention_mask.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <cmath>
+#include <vector>
+
+namespace behavior_velocity_planner::intersection
+{
+namespace bg = boost::geometry;
+using tier4_autoware_utils::Polygon2d;
+
+namespace
+{
+// tolerance of the shift of the grid from the lattice in the unit of cells
+constexpr double lattice_epsilon = 1e-3;
+
+// margin of the raster around the attention area in the unit of cells. cv::fillPoly with
+// cv::LINE_AA does not draw the anti-aliased edges within 2 pixels from the border of the image
+constexpr int raster_margin = 4;
+
+template <typename T>
+Polygon2d toPolygon2d(const T & area2d)
+{
+  Polygon2d polygon;
+  for (const auto & p : area2d) {
+    polygon.outer().emplace_back(p.x(), p.y());
+  }
+  polygon.outer().push_back(polygon.outer().front());
+  bg::correct(polygon);
+  return polygon;
+}
+}  // namespace
+
+OcclusionAttentionMask::OcclusionAttentionMask(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets)
+{
+  for (const auto & attention_area : attention_areas) {
+    if (attention_area.empty()) {
+      continue;
+    }
+    attention_polygons_.push_back(toPolygon2d(lanelet::utils::to2D(attention_area)));
+  }
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    adjacent_polygons_.push_back(toPolygon2d(adjacent_lanelet.polygon2d().basicPolygon()));
+  }
+
+  if (!attention_polygons_.empty()) {
+    bg::envelope(attention_polygons_.front(), attention_bounding_box_);
+    for (const auto & attention_polygon : attention_polygons_) {
+      tier4_autoware_utils::Box2d box;
+      bg::envelope(attention_polygon, box);
+      bg::expand(attention_bounding_box_, box);
+    }
+  }
+}
+
+cv::Rect OcclusionAttentionMask::get(const nav_msgs::msg::MapMetaData & info, cv::Mat & mask)
+{
+  const int width = info.width;
+  const int height = info.height;
+  mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
+  if (attention_polygons_.empty()) {
+    return cv::Rect{};
+  }
+
+  if (isAligned(info)) {
+    ++statistics_.hit_count;
+  } else {
+    rasterize(info);
+    ++statistics_.miss_count;
+  }
+
+  // the pixel at (x, y) on the grid image is the one at (x + offset_x, y + offset_y) on the raster
+  const int offset_x =
+    static_cast<int>(std::round((info.origin.position.x - origin_x_) / resolution_));
+  const int offset_y =
+    raster_.rows - height -
+    static_cast<int>(std::round((info.origin.position.y - origin_y_) / resolution_));
+  const cv::Rect roi =
+    (raster_roi_ - cv::Point(offset_x, offset_y)) & cv::Rect(0, 0, width, height);
+  if (roi.empty()) {
+    return cv::Rect{};
+  }
+  raster_(roi + cv::Point(offset_x, offset_y)).copyTo(mask(roi));
+  return roi;
+}
+
+bool OcclusionAttentionMask::isAligned(const nav_msgs::msg::MapMetaData & info) const
+{
+  if (raster_.empty() || resolution_ != info.resolution) {
+    return false;
+  }
+  const double shift_x = (info.origin.position.x - origin_x_) / resolution_;
+  const double shift_y = (info.origin.position.y - origin_y_) / resolution_;
+  return std::abs(shift_x - std::round(shift_x)) < lattice_epsilon &&
+         std::abs(shift_y - std::round(shift_y)) < lattice_epsilon;
+}
+
+void OcclusionAttentionMask::rasterize(const nav_msgs::msg::MapMetaData & info)
+{
+  // align the lattice to the cells of the grid, with the margin around the attention area
+  resolution_ = info.resolution;
+  const auto & origin = info.origin.position;
+  const auto & min_corner = attention_bounding_box_.min_corner();
+  const auto & max_corner = attention_bounding_box_.max_corner();
+  const int min_idx_x =
+    static_cast<int>(std::floor((min_corner.x() - origin.x) / resolution_)) - raster_margin;
+  const int min_idx_y =
+    static_cast<int>(std::floor((min_corner.y() - origin.y) / resolution_)) - raster_margin;
+  const int max_idx_x =
+    static_cast<int>(std::ceil((max_corner.x() - origin.x) / resolution_)) + raster_margin;
+  const int max_idx_y =
+    static_cast<int>(std::ceil((max_corner.y() - origin.y) / resolution_)) + raster_margin;
+  origin_x_ = origin.x + min_idx_x * resolution_;
+  origin_y_ = origin.y + min_idx_y * resolution_;
+
+  const int cols = max_idx_x - min_idx_x + 1;
+  const int rows = max_idx_y - min_idx_y + 1;
+  raster_ = cv::Mat(rows, cols, CV_8UC1, cv::Scalar(0));
+
+  auto toCvPolygon = [&](const Polygon2d & polygon) {
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & p : polygon.outer()) {
+      const int idx_x = static_cast<int>(std::floor((p.x() - origin_x_) / resolution_));
+      const int idx_y = static_cast<int>(std::floor((p.y() - origin_y_) / resolution_));
+      cv_polygon.emplace_back(idx_x, rows - 1 - idx_y);
+    }
+    return cv_polygon;
+  };
+  for (const auto & attention_polygon : attention_polygons_) {
+    cv::fillPoly(raster_, toCvPolygon(attention_polygon), cv::Scalar(255), cv::LINE_AA);
+  }
+  // reset the area of the adjacent lanelets to 0
+  for (const auto & adjacent_polygon : adjacent_polygons_) {
+    cv::fillPoly(raster_, toCvPolygon(adjacent_polygon), cv::Scalar(0), cv::LINE_AA);
+  }
+  raster_roi_ = cv::boundingRect(raster_);
+}
+
+}  // namespace behavior_velocity_planner::intersection
@@ -0,0 +1,84 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OCCLUSION_ATTENTION_MASK_HPP_
+#define OCCLUSION_ATTENTION_MASK_HPP_
+
+#include <opencv2/core.hpp>
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <nav_msgs/msg/map_meta_data.hpp>
+
+#include <lanelet2_core/primitives/CompoundPolygon.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace behavior_velocity_planner::intersection
+{
+
+/**
+ * @brief raster of the occlusion attention area excluding the adjacent lanelets. The areas are
+ * fixed for the module, so they are rasterized once on the lattice of the occupancy grid cells,
+ * and the raster is just cropped while the following grids are shifted by whole cells
+ */
+class OcclusionAttentionMask
+{
+public:
+  struct Statistics
+  {
+    size_t hit_count{0};   // the raster is cropped for the grid
+    size_t miss_count{0};  // the areas are rasterized again for the grid
+  };
+
+  OcclusionAttentionMask(
+    const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+    const lanelet::ConstLanelets & adjacent_lanelets);
+
+  /**
+   * @brief get the attention mask on the image of the occupancy grid, whose pixel at (x, y) is
+   * the cell of (x, height - 1 - y). attention: 255, non-attention: 0
+   * @param info the meta data of the occupancy grid
+   * @param mask [out] the attention mask of height x width
+   * @return the bounding rectangle of the attention area on the image, which is empty if the
+   * attention area is out of the grid
+   */
+  cv::Rect get(const nav_msgs::msg::MapMetaData & info, cv::Mat & mask);
+
+  const Statistics & getStatistics() const { return statistics_; }
+
+private:
+  //! check if the cells of the grid are on the lattice of the raster
+  bool isAligned(const nav_msgs::msg::MapMetaData & info) const;
+
+  void rasterize(const nav_msgs::msg::MapMetaData & info);
+
+  std::vector<tier4_autoware_utils::Polygon2d> attention_polygons_;
+  std::vector<tier4_autoware_utils::Polygon2d> adjacent_polygons_;
+  tier4_autoware_utils::Box2d attention_bounding_box_;
+
+  //! the raster whose bottom-left pixel is the cell at (origin_x_, origin_y_)
+  cv::Mat raster_;
+  cv::Rect raster_roi_;
+  double resolution_{0.0};
+  double origin_x_{0.0};
+  double origin_y_{0.0};
+
+  Statistics statistics_;
+};
+
+}  // namespace behavior_velocity_planner::intersection
+
+#endif  // OCCLUSION_ATTENTION_MASK_HPP_
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace behavior_velocity_planner
@@ -49,7 +50,8 @@ IntersectionModule::IntersectionModule(
   const int64_t module_id, const int64_t lane_id,
   [[maybe_unused]] std::shared_ptr<const PlannerData> planner_data,
   const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-  const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+  const std::string & turn_direction, const bool has_traffic_light,
+  std::shared_ptr<tier4_autoware_utils::ThreadPool> occlusion_thread_pool, rclcpp::Node & node,
   const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock)
 : SceneModuleInterface(module_id, logger, clock),
   planner_param_(planner_param),
@@ -57,7 +59,8 @@ IntersectionModule::IntersectionModule(
   associative_ids_(associative_ids),
   turn_direction_(turn_direction),
   has_traffic_light_(has_traffic_light),
-  occlusion_uuid_(tier4_autoware_utils::generateUUID())
+  occlusion_uuid_(tier4_autoware_utils::generateUUID()),
+  occlusion_thread_pool_(std::move(occlusion_thread_pool))
 {
   velocity_factor_.init(PlanningBehavior::INTERSECTION);
 
@@ -90,6 +93,9 @@ IntersectionModule::IntersectionModule(
     "~/debug/intersection/ego_ttc", 1);
   object_ttc_pub_ = node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
     "~/debug/intersection/object_ttc", 1);
+  occlusion_processing_time_pub_ =
+    node.create_publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>(
+      "~/debug/intersection/occlusion_processing_time_ms", 1);
 }
 
 bool IntersectionModule::modifyPathVelocity(PathWithLaneId * path, StopReason * stop_reason)
@@ -20,12 +20,14 @@
 #include "intersection_lanelets.hpp"
 #include "intersection_stoplines.hpp"
 #include "object_manager.hpp"
+#include "occlusion_attention_mask.hpp"
 #include "result.hpp"
 
 #include <behavior_velocity_planner_common/scene_module_interface.hpp>
 #include <behavior_velocity_planner_common/utilization/state_machine.hpp>
 #include <motion_utils/marker/virtual_wall_marker_creator.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/system/thread_pool.hpp>
 
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
 #include <tier4_debug_msgs/msg/float64_multi_array_stamped.hpp>
@@ -176,6 +178,7 @@ public:
       bool temporal_stop_before_attention_area;
       double creep_velocity_without_traffic_light;
       double static_occlusion_with_traffic_light_timeout;
+      int num_threads;
     } occlusion;
 
     struct Debug
@@ -301,7 +304,8 @@ public:
   IntersectionModule(
     const int64_t module_id, const int64_t lane_id, std::shared_ptr<const PlannerData> planner_data,
     const PlannerParam & planner_param, const std::set<lanelet::Id> & associative_ids,
-    const std::string & turn_direction, const bool has_traffic_light, rclcpp::Node & node,
+    const std::string & turn_direction, const bool has_traffic_light,
+    std::shared_ptr<tier4_autoware_utils::ThreadPool> occlusion_thread_pool, rclcpp::Node & node,
     const rclcpp::Logger logger, const rclcpp::Clock::SharedPtr clock);
 
   /**
@@ -379,6 +383,9 @@ private:
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
 
+  //! cache the raster of occlusion attention area on the occupancy grid
+  std::optional<intersection::OcclusionAttentionMask> occlusion_attention_mask_{std::nullopt};
+
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
   /** @}*/
@@ -697,10 +704,10 @@ private:
   /**
    * @brief calculate detected occlusion status(NOT | STATICALLY | DYNAMICALLY)
    * @attention this function has access to value() of intersection_lanelets_,
-   * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_
+   * intersection_lanelets.first_attention_area(), occlusion_attention_divisions_,
+   * occlusion_attention_mask_
    */
-  OcclusionType detectOcclusion(
-    const intersection::InterpolatedPathInfo & interpolated_path_info) const;
+  OcclusionType detectOcclusion(const intersection::InterpolatedPathInfo & interpolated_path_info);
   /** @} */
 
 private:
@@ -819,6 +826,11 @@ private:
   mutable InternalDebugData internal_debug_data_{};
   rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr ego_ttc_pub_;
   rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr object_ttc_pub_;
+  rclcpp::Publisher<tier4_debug_msgs::msg::Float64MultiArrayStamped>::SharedPtr
+    occlusion_processing_time_pub_;
+
+  //! shared by the modules to search occlusion along the attention lane divisions, or nullptr
+  std::shared_ptr<tier4_autoware_utils::ThreadPool> occlusion_thread_pool_;
 };
 
 }  // namespace behavior_velocity_planner
@@ -17,13 +17,18 @@
 
 #include <opencv2/imgproc.hpp>
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>  // for toPolygon2d
+#include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <tuple>
+#include <vector>
 
 namespace behavior_velocity_planner
 {
@@ -86,13 +91,12 @@ IntersectionModule::getOcclusionStatus(
 }
 
 IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
-  const intersection::InterpolatedPathInfo & interpolated_path_info) const
+  const intersection::InterpolatedPathInfo & interpolated_path_info)
 {
   const auto & intersection_lanelets = intersection_lanelets_.value();
-  const auto & adjacent_lanelets = intersection_lanelets.adjacent();
-  const auto & attention_areas = intersection_lanelets.occlusion_attention_area();
   const auto first_attention_area = intersection_lanelets.first_attention_area().value();
   const auto & lane_divisions = occlusion_attention_divisions_.value();
+  auto & occlusion_attention_mask = occlusion_attention_mask_.value();
 
   const auto & occ_grid = *planner_data_->occupancy_grid;
   const auto & current_pose = planner_data_->current_odometry->pose;
@@ -164,60 +168,71 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     }
   };
 
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+  stop_watch.tic("total");
+  stop_watch.tic("phase");
+
   // (1) prepare detection area mask
   // attention: 255
   // non-attention: 0
   // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
-  }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  // NOTE: the attention area and the adjacent lanelets are rasterized once and reused while the
+  // occupancy grid is shifted by whole cells
+  cv::Mat attention_mask;
+  const cv::Rect attention_roi = occlusion_attention_mask.get(occ_grid.info, attention_mask);
+  if (attention_roi.empty()) {
+    return NotOccluded{std::numeric_limits<double>::infinity()};
   }
+  const double attention_mask_time = stop_watch.toc("phase", true);
 
   // (2) prepare unknown mask
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
+  // NOTE: only the cells around the attention area are processed, with the margin of the kernel
+  // size so that the result of the morphology inside the attention area is the same as the one
+  // for the whole grid
+  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  const int roi_margin = std::max(morph_size, 1);
+  const cv::Rect work_roi =
+    cv::Rect(
+      attention_roi.x - roi_margin, attention_roi.y - roi_margin,
+      attention_roi.width + 2 * roi_margin, attention_roi.height + 2 * roi_margin) &
+    cv::Rect(0, 0, width, height);
+  cv::Mat unknown_mask_raw(height, width, CV_8UC1, cv::Scalar(0));
+  cv::Mat unknown_mask(height, width, CV_8UC1, cv::Scalar(0));
+  for (int row = work_roi.y; row < work_roi.y + work_roi.height; row++) {
+    const int y = height - 1 - row;
+    auto * unknown_mask_row = unknown_mask_raw.ptr<unsigned char>(row);
+    for (int x = work_roi.x; x < work_roi.x + work_roi.width; x++) {
+      const unsigned char intensity = occ_grid.data[y * width + x];
       if (
         planner_param_.occlusion.free_space_max <= intensity &&
         intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+        unknown_mask_row[x] = 255;
       }
     }
   }
   // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
-  cv::morphologyEx(
-    unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
-    cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+  {
+    cv::Mat unknown_mask_raw_roi = unknown_mask_raw(work_roi);
+    cv::Mat unknown_mask_roi = unknown_mask(work_roi);
+    cv::morphologyEx(
+      unknown_mask_raw_roi, unknown_mask_roi, cv::MORPH_OPEN,
+      cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+  }
+  const double unknown_mask_time = stop_watch.toc("phase", true);
 
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
-  cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
+  cv::Mat occlusion_mask(height, width, CV_8UC1, cv::Scalar(0));
+  {
+    cv::Mat occlusion_mask_roi = occlusion_mask(work_roi);
+    cv::bitwise_and(attention_mask(work_roi), unknown_mask(work_roi), occlusion_mask_roi);
+  }
   // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  attention_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
   const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
@@ -255,7 +270,8 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const double possible_object_bbox_y = possible_object_bbox.at(1) / resolution;
   const double possible_object_area = possible_object_bbox_x * possible_object_bbox_y;
   std::vector<std::vector<cv::Point>> contours;
-  cv::findContours(occlusion_mask, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+  cv::findContours(
+    occlusion_mask(work_roi), contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, work_roi.tl());
   std::vector<std::vector<cv::Point>> valid_contours;
   for (const auto & contour : contours) {
     if (contour.size() <= 2) {
@@ -291,11 +307,12 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
     cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
   }
+  const double occlusion_polygon_time = stop_watch.toc("phase", true);
 
   // (5) find distance
   // (5.1) discretize path_ip with resolution for computational cost
@@ -338,12 +355,14 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   {
     int64 division_index{0};
     int64 point_index{0};
-    double dist{0.0};
+    double dist{std::numeric_limits<double>::infinity()};
     geometry_msgs::msg::Point point;
     geometry_msgs::msg::Point projection;
-  } nearest_occlusion_point;
-  double min_dist = std::numeric_limits<double>::infinity();
-  for (unsigned division_index = 0; division_index < lane_divisions.size(); ++division_index) {
+  };
+  // (5.2) find the nearest occluded cell along each division. the divisions are independent, so
+  // they are searched in parallel if the thread pool is given
+  std::vector<NearestOcclusionPoint> division_occlusion_points(lane_divisions.size());
+  auto findNearestOcclusionPoint = [&](const size_t division_index) {
     const auto & division = lane_divisions.at(division_index);
     LineString2d division_linestring;
     auto division_point_it = division.begin();
@@ -362,12 +381,12 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     std::vector<Point2d> intersection_points;
     boost::geometry::intersection(division_linestring, path_linestring, intersection_points);
     if (intersection_points.empty()) {
-      continue;
+      return;
     }
     const auto & projection_point = intersection_points.at(0);
     const auto projection_it = findNearestPointToProjection(division, projection_point, resolution);
     if (projection_it == division.end()) {
-      continue;
+      return;
     }
     double acc_dist = 0.0;
     auto acc_dist_it = projection_it;
@@ -382,17 +401,39 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
       if (pixel == BLOCKED) {
         break;
       }
+      // NOTE: acc_dist is non-decreasing, so the first occluded cell is the nearest one
       if (pixel == OCCLUDED) {
-        if (acc_dist < min_dist) {
-          min_dist = acc_dist;
-          nearest_occlusion_point = {
-            division_index, std::distance(division.begin(), point_it), acc_dist,
-            tier4_autoware_utils::createPoint(point_it->x(), point_it->y(), origin.z),
-            tier4_autoware_utils::createPoint(projection_it->x(), projection_it->y(), origin.z)};
-        }
+        division_occlusion_points.at(division_index) = {
+          static_cast<int64>(division_index), std::distance(division.begin(), point_it), acc_dist,
+          tier4_autoware_utils::createPoint(point_it->x(), point_it->y(), origin.z),
+          tier4_autoware_utils::createPoint(projection_it->x(), projection_it->y(), origin.z)};
+        break;
       }
     }
+  };
+  if (occlusion_thread_pool_) {
+    occlusion_thread_pool_->parallelFor(lane_divisions.size(), findNearestOcclusionPoint);
+  } else {
+    for (size_t division_index = 0; division_index < lane_divisions.size(); ++division_index) {
+      findNearestOcclusionPoint(division_index);
+    }
   }
+  // the former division is chosen for the same distance as the serial search
+  NearestOcclusionPoint nearest_occlusion_point;
+  for (const auto & division_occlusion_point : division_occlusion_points) {
+    if (division_occlusion_point.dist < nearest_occlusion_point.dist) {
+      nearest_occlusion_point = division_occlusion_point;
+    }
+  }
+  const double min_dist = nearest_occlusion_point.dist;
+  const double distance_time = stop_watch.toc("phase");
+
+  tier4_debug_msgs::msg::Float64MultiArrayStamped processing_time_array;
+  processing_time_array.stamp = occ_grid.header.stamp;
+  processing_time_array.data = {
+    static_cast<double>(lane_id_), attention_mask_time, unknown_mask_time, occlusion_polygon_time,
+    distance_time, stop_watch.toc("total")};
+  occlusion_processing_time_pub_->publish(processing_time_array);
 
   if (min_dist == std::numeric_limits<double>::infinity() || min_dist > occlusion_dist_thr) {
     return NotOccluded{min_dist};
@@ -263,6 +263,10 @@ IntersectionModule::prepareIntersectionData(const bool is_prioritized, PathWithL
       intersection_lanelets.occlusion_attention(), routing_graph_ptr,
       planner_data_->occupancy_grid->info.resolution);
   }
+  if (!occlusion_attention_mask_) {
+    occlusion_attention_mask_.emplace(
+      intersection_lanelets.occlusion_attention_area(), intersection_lanelets.adjacent());
+  }
 
   // ==========================================================================================
   // update traffic light information
@@ -427,8 +431,10 @@ IntersectionModule::generateIntersectionStopLines(
     const auto & base_pose0 = path_ip.points.at(default_stopline_ip).point.pose;
     const auto path_footprint0 = tier4_autoware_utils::transformVector(
       local_footprint, tier4_autoware_utils::pose2transform(base_pose0));
-    if (bg::intersects(
-          path_footprint0, lanelet::utils::to2D(first_attention_area).basicPolygon())) {
+    const auto first_attention_geometry =
+      planner_data_->lanelet_geometry_cache_->getLaneletGeometry(first_attention_lane);
+    const auto & first_attention_area_2d = first_attention_geometry->polygon;
+    if (bg::intersects(path_footprint0, first_attention_area_2d)) {
       occlusion_peeking_line_valid = false;
     }
   }
@@ -888,7 +894,7 @@ std::vector<lanelet::ConstLineString3d> IntersectionModule::generateDetectionLan
     const auto & original = originals.at(i);
     double area = 0;
     for (const auto & partition : original) {
-      area += bg::area(partition.polygon2d().basicPolygon());
+      area += planner_data_->lanelet_geometry_cache_->getLaneletGeometry(partition)->area;
     }
     merged_lanelet_with_area.emplace_back(merged_detection_lanelet, area);
   }
@@ -22,6 +22,8 @@
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <motion_utils/trajectory/trajectory.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
+
 #include <lanelet2_core/geometry/Polygon.h>
 #include <lanelet2_core/primitives/BasicRegulatoryElements.h>
 #include <lanelet2_routing/RoutingGraph.h>
@@ -53,7 +55,8 @@ MergeFromPrivateRoadModule::MergeFromPrivateRoadModule(
 static std::optional<lanelet::ConstLanelet> getFirstConflictingLanelet(
   const lanelet::ConstLanelets & conflicting_lanelets,
   const intersection::InterpolatedPathInfo & interpolated_path_info,
-  const tier4_autoware_utils::LinearRing2d & footprint, const double vehicle_length)
+  const tier4_autoware_utils::LinearRing2d & footprint, const double vehicle_length,
+  LaneletGeometryCache & geometry_cache)
 {
   const auto & path_ip = interpolated_path_info.path;
   const auto [lane_start, end] = interpolated_path_info.lane_id_interval.value();
@@ -65,9 +68,14 @@ static std::optional<lanelet::ConstLanelet> getFirstConflictingLanelet(
     const auto & pose = path_ip.points.at(i).point.pose;
     const auto path_footprint =
       tier4_autoware_utils::transformVector(footprint, tier4_autoware_utils::pose2transform(pose));
+    tier4_autoware_utils::Box2d path_footprint_box;
+    bg::envelope(path_footprint, path_footprint_box);
     for (const auto & conflicting_lanelet : conflicting_lanelets) {
-      const auto polygon_2d = conflicting_lanelet.polygon2d().basicPolygon();
-      const bool intersects = bg::intersects(polygon_2d, path_footprint);
+      const auto geometry = geometry_cache.getLaneletGeometry(conflicting_lanelet);
+      if (!bg::intersects(path_footprint_box, geometry->bounding_box)) {
+        continue;
+      }
+      const bool intersects = bg::intersects(geometry->polygon, path_footprint);
       if (intersects) {
         return std::make_optional(conflicting_lanelet);
       }
@@ -114,7 +122,8 @@ bool MergeFromPrivateRoadModule::modifyPathVelocity(PathWithLaneId * path, StopR
   if (!first_conflicting_lanelet_) {
     const auto conflicting_lanelets = getAttentionLanelets();
     first_conflicting_lanelet_ = getFirstConflictingLanelet(
-      conflicting_lanelets, interpolated_path_info, local_footprint, baselink2front);
+      conflicting_lanelets, interpolated_path_info, local_footprint, baselink2front,
+      *planner_data_->lanelet_geometry_cache_);
   }
   if (!first_conflicting_lanelet_) {
     return false;
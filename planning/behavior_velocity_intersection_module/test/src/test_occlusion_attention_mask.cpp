@@ -0,0 +1,174 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "occlusion_attention_mask.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/primitives/LineString.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using behavior_velocity_planner::intersection::OcclusionAttentionMask;
+
+namespace
+{
+using Vertices = std::vector<std::pair<double, double>>;
+
+// the vertices are clockwise, and are not on the lattice of the grids in the test
+const std::vector<Vertices> attention_vertices{
+  // inside the grid
+  {{2.12, 3.17}, {2.67, 15.27}, {14.42, 16.97}, {12.27, 1.52}},
+  // crossing the left and the bottom border of the grid
+  {{-14.08, -8.13}, {-13.33, 4.92}, {-3.28, 6.17}, {-1.83, -8.98}},
+  // crossing the right and the top border of the grid
+  {{20.22, 18.12}, {22.17, 30.27}, {31.52, 28.17}, {29.97, 16.32}}};
+
+// the vertices of the adjacent lanelet in the order of its polygon
+const Vertices adjacent_vertices{{0.42, 10.62}, {20.22, 10.62}, {20.22, 7.52}, {0.42, 7.52}};
+
+lanelet::LineString3d createLineString(const Vertices & vertices)
+{
+  lanelet::LineString3d line_string(lanelet::utils::getId());
+  for (const auto & [x, y] : vertices) {
+    line_string.push_back(lanelet::Point3d(lanelet::utils::getId(), x, y, 0.0));
+  }
+  return line_string;
+}
+
+OcclusionAttentionMask createOcclusionAttentionMask()
+{
+  std::vector<lanelet::CompoundPolygon3d> attention_areas;
+  for (const auto & vertices : attention_vertices) {
+    attention_areas.emplace_back(lanelet::ConstLineStrings3d{createLineString(vertices)});
+  }
+  const auto left_bound = createLineString({adjacent_vertices.at(0), adjacent_vertices.at(1)});
+  const auto right_bound = createLineString({adjacent_vertices.at(3), adjacent_vertices.at(2)});
+  const lanelet::ConstLanelets adjacent_lanelets{
+    lanelet::Lanelet(lanelet::utils::getId(), left_bound, right_bound)};
+  return OcclusionAttentionMask(attention_areas, adjacent_lanelets);
+}
+
+nav_msgs::msg::MapMetaData createMapMetaData(
+  const double origin_x, const double origin_y, const double resolution, const int width,
+  const int height)
+{
+  nav_msgs::msg::MapMetaData info;
+  info.origin.position.x = origin_x;
+  info.origin.position.y = origin_y;
+  info.resolution = resolution;
+  info.width = width;
+  info.height = height;
+  return info;
+}
+
+// rasterize the polygons on the whole grid at every cycle, as the module did before the mask
+cv::Mat fillFullGrid(const nav_msgs::msg::MapMetaData & info)
+{
+  const int height = info.height;
+  const double resolution = info.resolution;
+  const auto & origin = info.origin.position;
+  cv::Mat mask(info.height, info.width, CV_8UC1, cv::Scalar(0));
+  const auto toCvPolygon = [&](const Vertices & vertices) {
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & [x, y] : vertices) {
+      const int idx_x = static_cast<int>(std::floor((x - origin.x) / resolution));
+      const int idx_y = static_cast<int>(std::floor((y - origin.y) / resolution));
+      cv_polygon.emplace_back(idx_x, height - 1 - idx_y);
+    }
+    cv_polygon.push_back(cv_polygon.front());
+    return cv_polygon;
+  };
+  for (const auto & vertices : attention_vertices) {
+    cv::fillPoly(mask, toCvPolygon(vertices), cv::Scalar(255), cv::LINE_AA);
+  }
+  cv::fillPoly(mask, toCvPolygon(adjacent_vertices), cv::Scalar(0), cv::LINE_AA);
+  return mask;
+}
+
+// cv::fillPoly with cv::LINE_AA does not draw the anti-aliased edges within 2 pixels from the
+// border of the image, so the pixels around the border of the full grid are not compared
+void expectSameAsFullGrid(
+  OcclusionAttentionMask & attention_mask, const nav_msgs::msg::MapMetaData & info)
+{
+  constexpr int border = 3;
+  const int width = info.width;
+  const int height = info.height;
+  cv::Mat mask;
+  const cv::Rect roi = attention_mask.get(info, mask);
+  const cv::Mat expected_mask = fillFullGrid(info);
+  ASSERT_EQ(mask.rows, height);
+  ASSERT_EQ(mask.cols, width);
+  ASSERT_FALSE(roi.empty());
+  EXPECT_EQ(roi, roi & cv::Rect(0, 0, width, height));
+
+  // the attention area is only in the returned rectangle
+  EXPECT_EQ(cv::countNonZero(mask(roi)), cv::countNonZero(mask));
+
+  int num_mismatches = 0;
+  for (int y = border; y < height - border; ++y) {
+    for (int x = border; x < width - border; ++x) {
+      if (mask.at<unsigned char>(y, x) != expected_mask.at<unsigned char>(y, x)) {
+        ++num_mismatches;
+      }
+    }
+  }
+  EXPECT_EQ(num_mismatches, 0);
+
+  // both the attention area and the adjacent lanelet are on the grid
+  const cv::Rect inner_rect(border, border, width - 2 * border, height - 2 * border);
+  EXPECT_GT(cv::countNonZero(expected_mask(inner_rect)), 0);
+  EXPECT_LT(cv::countNonZero(expected_mask(inner_rect)), inner_rect.area());
+}
+}  // namespace
+
+TEST(OcclusionAttentionMask, SameAsFullGrid)
+{
+  auto attention_mask = createOcclusionAttentionMask();
+
+  // the grid of [-10.0, 26.0] x [-5.0, 22.0], which the polygons cross
+  expectSameAsFullGrid(attention_mask, createMapMetaData(-10.0, -5.0, 0.3, 120, 90));
+  EXPECT_EQ(attention_mask.getStatistics().miss_count, 1u);
+  EXPECT_EQ(attention_mask.getStatistics().hit_count, 0u);
+
+  // shifted by the whole cells, where the raster is cropped
+  expectSameAsFullGrid(attention_mask, createMapMetaData(-7.9, -6.2, 0.3, 120, 90));
+  EXPECT_EQ(attention_mask.getStatistics().miss_count, 1u);
+  EXPECT_EQ(attention_mask.getStatistics().hit_count, 1u);
+
+  // shifted by a half cell, where the polygons are rasterized again
+  expectSameAsFullGrid(attention_mask, createMapMetaData(-7.75, -6.05, 0.3, 120, 90));
+  EXPECT_EQ(attention_mask.getStatistics().miss_count, 2u);
+  EXPECT_EQ(attention_mask.getStatistics().hit_count, 1u);
+
+  // the resolution which does not divide the size of the grid nor of the polygons
+  expectSameAsFullGrid(attention_mask, createMapMetaData(-7.75, -6.05, 0.25, 143, 107));
+  EXPECT_EQ(attention_mask.getStatistics().miss_count, 3u);
+  EXPECT_EQ(attention_mask.getStatistics().hit_count, 1u);
+}
+
+TEST(OcclusionAttentionMask, OutOfGrid)
+{
+  auto attention_mask = createOcclusionAttentionMask();
+  cv::Mat mask;
+  const auto roi = attention_mask.get(createMapMetaData(100.0, 100.0, 0.3, 120, 90), mask);
+  EXPECT_TRUE(roi.empty());
+  ASSERT_EQ(mask.rows, 90);
+  ASSERT_EQ(mask.cols, 120);
+  EXPECT_EQ(cv::countNonZero(mask), 0);
+}
@@ -79,31 +79,24 @@ boost::optional<LineString2d> NoStoppingAreaModule::getStopLineGeometry2d(
      **/
 
     for (const auto & no_stopping_area : no_stopping_area_reg_elem_.noStoppingAreas()) {
-      const auto & area_poly = lanelet::utils::to2D(no_stopping_area).basicPolygon();
-      lanelet::BasicLineString2d path_line;
-      for (size_t i = 0; i < path.points.size() - 1; ++i) {
-        const auto p0 = path.points.at(i).point.pose.position;
-        const auto p1 = path.points.at(i + 1).point.pose.position;
-        const LineString2d line{{p0.x, p0.y}, {p1.x, p1.y}};
-        std::vector<Point2d> collision_points;
-        bg::intersection(area_poly, line, collision_points);
-        if (collision_points.empty()) {
-          continue;
-        }
-        const double yaw = tier4_autoware_utils::calcAzimuthAngle(p0, p1);
-        if (!collision_points.empty()) {
-          geometry_msgs::msg::Point left_point;
-          const double w = planner_data_->vehicle_info_.vehicle_width_m;
-          const double l = stop_line_margin;
-          stop_line.emplace_back(
-            -l * std::cos(yaw) + collision_points.front().x() + w * std::cos(yaw + M_PI_2),
-            collision_points.front().y() + w * std::sin(yaw + M_PI_2));
-          stop_line.emplace_back(
-            -l * std::cos(yaw) + collision_points.front().x() + w * std::cos(yaw - M_PI_2),
-            collision_points.front().y() + w * std::sin(yaw - M_PI_2));
-          return stop_line;
-        }
+      const auto collision_points =
+        planner_data_->lanelet_geometry_cache_->getPathIntersections(path, no_stopping_area);
+      if (collision_points.empty()) {
+        continue;
       }
+      const auto & collision_point = collision_points.front().point;
+      const auto p0 = path.points.at(collision_points.front().segment_idx).point.pose.position;
+      const auto p1 = path.points.at(collision_points.front().segment_idx + 1).point.pose.position;
+      const double yaw = tier4_autoware_utils::calcAzimuthAngle(p0, p1);
+      const double w = planner_data_->vehicle_info_.vehicle_width_m;
+      const double l = stop_line_margin;
+      stop_line.emplace_back(
+        -l * std::cos(yaw) + collision_point.x() + w * std::cos(yaw + M_PI_2),
+        collision_point.y() + w * std::sin(yaw + M_PI_2));
+      stop_line.emplace_back(
+        -l * std::cos(yaw) + collision_point.x() + w * std::cos(yaw - M_PI_2),
+        collision_point.y() + w * std::sin(yaw - M_PI_2));
+      return stop_line;
     }
   }
   return {};
@@ -312,10 +305,13 @@ Polygon2d NoStoppingAreaModule::generateEgoNoStoppingAreaLanePolygon(
     return ego_area;
   }
   const auto no_stopping_area = no_stopping_area_reg_elem_.noStoppingAreas().front();
+  const auto area_geometry =
+    planner_data_->lanelet_geometry_cache_->getPolygonGeometry(no_stopping_area);
+  const auto & area_poly = area_geometry->polygon;
   for (size_t i = closest_idx + num_ignore_nearest; i < pp.size() - 1; ++i) {
     dist_from_start_sum += tier4_autoware_utils::calcDistance2d(pp.at(i), pp.at(i - 1));
     const auto & p = pp.at(i).point.pose.position;
-    if (bg::within(Point2d{p.x, p.y}, lanelet::utils::to2D(no_stopping_area).basicPolygon())) {
+    if (bg::within(Point2d{p.x, p.y}, area_poly)) {
       is_in_area = true;
       break;
     }
@@ -334,7 +330,7 @@ Polygon2d NoStoppingAreaModule::generateEgoNoStoppingAreaLanePolygon(
   for (size_t i = ego_area_start_idx; i < pp.size() - 1; ++i) {
     dist_from_start_sum += tier4_autoware_utils::calcDistance2d(pp.at(i), pp.at(i - 1));
     const auto & p = pp.at(i).point.pose.position;
-    if (!bg::within(Point2d{p.x, p.y}, lanelet::utils::to2D(no_stopping_area).basicPolygon())) {
+    if (!bg::within(Point2d{p.x, p.y}, area_poly)) {
       dist_from_area_sum += tier4_autoware_utils::calcDistance2d(pp.at(i), pp.at(i - 1));
 
       // do not take extra distance and exit as soon as p is outside no stopping area
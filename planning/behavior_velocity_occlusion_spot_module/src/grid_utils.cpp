@@ -337,26 +337,78 @@ void imageToOccupancyGrid(const cv::Mat & cv_image, nav_msgs::msg::OccupancyGrid
   }
 }
 void toQuantizedImage(
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat * border_image,
-  cv::Mat * occlusion_image, const GridParam & param)
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat & border_image,
+  cv::Mat & occlusion_image, DenoiseBuffer & buffer, const GridParam & param)
 {
-  const int width = border_image->cols;
-  const int height = border_image->rows;
-  for (int x = width - 1; x >= 0; x--) {
-    for (int y = height - 1; y >= 0; y--) {
-      const int idx = (height - 1 - y) + (width - 1 - x) * height;
-      unsigned char intensity = occupancy_grid.data.at(idx);
-      if (intensity <= param.free_space_max) {
-        continue;
-      } else if (param.free_space_max < intensity && intensity < param.occupied_min) {
-        intensity = grid_utils::occlusion_cost_value::UNKNOWN_IMAGE;
-        occlusion_image->at<unsigned char>(y, x) = intensity;
-      } else if (param.occupied_min <= intensity) {
-        intensity = grid_utils::occlusion_cost_value::OCCUPIED_IMAGE;
-        border_image->at<unsigned char>(y, x) = intensity;
-      } else {
-        throw std::logic_error("behavior_velocity[occlusion_spot_grid]: invalid if clause");
-      }
+  // NOTE: the pixel at (y, x) of the image is the cell at (height - 1 - y) + (width - 1 - x) *
+  // height of the occupancy grid where height is the number of rows. it is the reverse order of
+  // the transposed image, so the cells are quantized in a contiguous loop and transposed at last
+  const int rows = occupancy_grid.info.width;
+  const int cols = occupancy_grid.info.height;
+  const size_t size = static_cast<size_t>(rows) * cols;
+  if (occupancy_grid.data.size() != size) {
+    throw std::invalid_argument(
+      "behavior_velocity[occlusion_spot_grid]: size of data does not correspond to width * height");
+  }
+  buffer.transposed_border_image.create(cols, rows, CV_8UC1);
+  buffer.transposed_occlusion_image.create(cols, rows, CV_8UC1);
+  unsigned char * border_data = buffer.transposed_border_image.ptr<unsigned char>();
+  unsigned char * occlusion_data = buffer.transposed_occlusion_image.ptr<unsigned char>();
+  const int8_t * grid_data = occupancy_grid.data.data();
+  for (size_t i = 0; i < size; ++i) {
+    const unsigned char intensity = grid_data[size - 1 - i];
+    const bool is_not_free = param.free_space_max < intensity;
+    border_data[i] = is_not_free && param.occupied_min <= intensity
+                       ? grid_utils::occlusion_cost_value::OCCUPIED_IMAGE
+                       : grid_utils::occlusion_cost_value::FREE_SPACE;
+    occlusion_data[i] = is_not_free && intensity < param.occupied_min
+                          ? grid_utils::occlusion_cost_value::UNKNOWN_IMAGE
+                          : grid_utils::occlusion_cost_value::FREE_SPACE;
+  }
+  cv::transpose(buffer.transposed_border_image, border_image);
+  cv::transpose(buffer.transposed_occlusion_image, occlusion_image);
+}
+
+void imageToGridMap(
+  const cv::Mat & cv_image, const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  DenoiseBuffer & buffer, grid_map::GridMap & grid_map)
+{
+  const auto & info = occupancy_grid.info;
+  const grid_map::Size size(info.width, info.height);
+  const double resolution = info.resolution;
+  const grid_map::Length length = resolution * size.cast<double>();
+  // the position of grid map is the center of the map
+  const grid_map::Position position =
+    grid_map::Position(info.origin.position.x, info.origin.position.y) + 0.5 * length.matrix();
+  if (
+    (grid_map.getSize() != size).any() || grid_map.getResolution() != resolution ||
+    (grid_map.getLength() != length).any() || grid_map.getPosition() != position ||
+    grid_map.getFrameId() != occupancy_grid.header.frame_id ||
+    !grid_map.getStartIndex().isZero()) {
+    grid_map.setFrameId(occupancy_grid.header.frame_id);
+    grid_map.setGeometry(length, resolution, position);
+  }
+  grid_map.setTimestamp(rclcpp::Time(occupancy_grid.header.stamp).nanoseconds());
+  if (!grid_map.exists("layer")) {
+    grid_map.add("layer");
+  }
+
+  // the column-major matrix of the grid map is the same as the image, so the transposed image is
+  // copied in a contiguous loop
+  cv::transpose(cv_image, buffer.transposed_merged_image);
+  const unsigned char * image_data = buffer.transposed_merged_image.ptr<unsigned char>();
+  float * grid_data = grid_map["layer"].data();
+  const size_t num_cells = static_cast<size_t>(size.prod());
+  for (size_t i = 0; i < num_cells; ++i) {
+    const unsigned char intensity = image_data[i];
+    if (intensity == grid_utils::occlusion_cost_value::FREE_SPACE) {
+      grid_data[i] = grid_utils::occlusion_cost_value::FREE_SPACE;
+    } else if (intensity == grid_utils::occlusion_cost_value::UNKNOWN_IMAGE) {
+      grid_data[i] = grid_utils::occlusion_cost_value::UNKNOWN;
+    } else if (intensity == grid_utils::occlusion_cost_value::OCCUPIED_IMAGE) {
+      grid_data[i] = grid_utils::occlusion_cost_value::OCCUPIED;
+    } else {
+      throw std::logic_error("behavior_velocity[occlusion_spot_grid]: invalid if clause");
     }
   }
 }
@@ -364,17 +416,14 @@ void toQuantizedImage(
 void denoiseOccupancyGridCV(
   const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
-  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
-  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts)
+  grid_map::GridMap & grid_map, DenoiseBuffer & buffer, const GridParam & param,
+  const bool is_show_debug_window, const int num_iter, const bool use_object_footprints,
+  const bool use_object_ray_casts)
 {
-  OccupancyGrid occupancy_grid = *occupancy_grid_ptr;
-  cv::Mat border_image(
-    occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
-    cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
-  cv::Mat occlusion_image(
-    occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
-    cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
-  toQuantizedImage(occupancy_grid, &border_image, &occlusion_image, param);
+  const OccupancyGrid & occupancy_grid = *occupancy_grid_ptr;
+  cv::Mat & border_image = buffer.border_image;
+  cv::Mat & occlusion_image = buffer.occlusion_image;
+  toQuantizedImage(occupancy_grid, border_image, occlusion_image, buffer, param);
 
   //! show original occupancy grid to compare difference
   if (is_show_debug_window) {
@@ -411,8 +460,7 @@ void denoiseOccupancyGridCV(
     cv::moveWindow("merge", 300, 300);
     cv::waitKey(1);
   }
-  imageToOccupancyGrid(border_image, &occupancy_grid);
-  grid_map::GridMapRosConverter::fromOccupancyGrid(occupancy_grid, "layer", grid_map);
+  imageToGridMap(border_image, occupancy_grid, buffer, grid_map);
 }
 }  // namespace grid_utils
 }  // namespace behavior_velocity_planner
@@ -91,6 +91,17 @@ struct GridParam
   int occupied_min;    // minimum value of an occupied cell in the occupancy grid
 };
 
+//!< @brief images kept between the cycles to denoise the occupancy grid of the same size without
+//!< allocating them at every cycle
+struct DenoiseBuffer
+{
+  cv::Mat border_image;
+  cv::Mat occlusion_image;
+  cv::Mat transposed_border_image;
+  cv::Mat transposed_occlusion_image;
+  cv::Mat transposed_merged_image;
+};
+
 //!< @brief Find all occlusion spots inside the given lanelet
 void findOcclusionSpots(
   std::vector<grid_map::Position> & occlusion_spot_positions, const grid_map::GridMap & grid,
@@ -110,13 +121,21 @@ void generateOccupiedImage(
 cv::Point toCVPoint(
   const Point & geom_point, const double width_m, const double height_m, const double resolution);
 void imageToOccupancyGrid(const cv::Mat & cv_image, nav_msgs::msg::OccupancyGrid * occupancy_grid);
+//!< @brief quantize the occupancy grid into the image of occupied cells and unknown cells
 void toQuantizedImage(
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat * cv_image, const GridParam & param);
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat & border_image,
+  cv::Mat & occlusion_image, DenoiseBuffer & buffer, const GridParam & param);
+//!< @brief same as imageToOccupancyGrid() followed by GridMapRosConverter::fromOccupancyGrid()
+//!< except that the existing layer of the grid map is overwritten without allocation
+void imageToGridMap(
+  const cv::Mat & cv_image, const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  DenoiseBuffer & buffer, grid_map::GridMap & grid_map);
 void denoiseOccupancyGridCV(
   const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
-  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
-  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts);
+  grid_map::GridMap & grid_map, DenoiseBuffer & buffer, const GridParam & param,
+  const bool is_show_debug_window, const int num_iter, const bool use_object_footprints,
+  const bool use_object_ray_casts);
 }  // namespace grid_utils
 }  // namespace behavior_velocity_planner
 
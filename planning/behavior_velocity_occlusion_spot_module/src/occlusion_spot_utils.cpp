@@ -24,6 +24,8 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <deque>
 #include <functional>
 #include <limits>
@@ -432,18 +434,25 @@ std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpo
   const double right_overhang = param.right_overhang;
   const double left_overhang = param.left_overhang;
   const double wheel_tread = param.wheel_tread;
-  double distance_lower_bound = std::numeric_limits<double>::max();
-  PossibleCollisionInfo candidate;
-  bool has_collision = false;
   const auto & partition_lanelets = debug_data.close_partition;
-  for (const grid_map::Position & occlusion_spot_position : occlusion_spot_positions) {
+  // check the occlusion spots from the nearest one to the base point, so that the search stops at
+  // the first spot which can collide. for the same distance, the latter spot is preferred as the
+  // candidate used to be overwritten by it.
+  std::vector<std::pair<double, size_t>> dist_and_indices;
+  dist_and_indices.reserve(occlusion_spot_positions.size());
+  for (size_t i = 0; i < occlusion_spot_positions.size(); ++i) {
+    const auto & op = occlusion_spot_positions.at(i);
+    dist_and_indices.emplace_back(std::hypot(base_point.x() - op[0], base_point.y() - op[1]), i);
+  }
+  std::sort(dist_and_indices.begin(), dist_and_indices.end(), [](const auto & a, const auto & b) {
+    return a.first < b.first || (a.first == b.first && a.second > b.second);
+  });
+  for (const auto & dist_and_index : dist_and_indices) {
+    const grid_map::Position & occlusion_spot_position =
+      occlusion_spot_positions.at(dist_and_index.second);
     // arc intersection
     const lanelet::BasicPoint2d obstacle_point = {
       occlusion_spot_position[0], occlusion_spot_position[1]};
-    const double dist =
-      std::hypot(base_point.x() - obstacle_point[0], base_point.y() - obstacle_point[1]);
-    // skip if absolute distance is larger
-    if (distance_lower_bound < dist) continue;
     lanelet::ArcCoordinates arc_coord_occlusion_point =
       lanelet::geometry::toArcCoordinates(path_lanelet.centerline2d(), obstacle_point);
     const double length_to_col = arc_coord_occlusion_point.length - baselink_to_front;
@@ -468,11 +477,8 @@ std::optional<PossibleCollisionInfo> generateOneNotableCollisionFromOcclusionSpo
     bool collision_free_at_intersection = grid_utils::isCollisionFree(
       grid, occlusion_spot_position, grid_map::Position(ip.x, ip.y), param.pedestrian_radius);
     if (!collision_free_at_intersection) continue;
-    distance_lower_bound = dist;
-    candidate = pc;
-    has_collision = true;
+    return pc;
   }
-  if (has_collision) return candidate;
   return std::nullopt;
 }
 
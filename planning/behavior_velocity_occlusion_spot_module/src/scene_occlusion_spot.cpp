@@ -153,7 +153,6 @@ bool OcclusionSpotModule::modifyPathVelocity(
   if (param_.detection_method == utils::DETECTION_METHOD::OCCUPANCY_GRID) {
     const auto & occ_grid_ptr = planner_data_->occupancy_grid;
     if (!occ_grid_ptr) return true;  // no data
-    grid_map::GridMap grid_map;
     Polygons2d stuck_vehicle_foot_prints;
     Polygons2d moving_vehicle_foot_prints;
     utils::categorizeVehicles(
@@ -164,13 +163,13 @@ bool OcclusionSpotModule::modifyPathVelocity(
     const int num_iter = static_cast<int>(
       (param_.detection_area.min_occlusion_spot_size / occ_grid_ptr->info.resolution) - 1);
     grid_utils::denoiseOccupancyGridCV(
-      occ_grid_ptr, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, grid_map, param_.grid,
-      param_.is_show_cv_window, num_iter, param_.use_object_info,
+      occ_grid_ptr, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, grid_map_,
+      denoise_buffer_, param_.grid, param_.is_show_cv_window, num_iter, param_.use_object_info,
       param_.use_moving_object_ray_cast);
     DEBUG_PRINT(show_time, "grid [ms]: ", stop_watch_.toc("processing_time", true));
     // Note: Don't consider offset from path start to ego here
     if (!utils::generatePossibleCollisionsFromGridMap(
-          possible_collisions, grid_map, path_interpolated, offset_from_start_to_ego, param_,
+          possible_collisions, grid_map_, path_interpolated, offset_from_start_to_ego, param_,
           debug_data_)) {
       // no occlusion spot
       return true;
@@ -63,6 +63,9 @@ private:
   PlannerParam param_;
   tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch_;
   std::vector<lanelet::BasicPolygon2d> partition_lanelets_;
+  // the grid map and the images are kept to reuse their memory at the next cycle
+  grid_map::GridMap grid_map_;
+  grid_utils::DenoiseBuffer denoise_buffer_;
 
 protected:
   int64_t module_id_{};
@@ -178,3 +178,57 @@ TEST(test, erode_with_custom_kernel)
   // cv::imshow("erode", cv_image);
   // cv::waitKey(5000);
 }
+
+TEST(test, denoise_into_grid_map_same_as_occupancy_grid_conversion)
+{
+  using behavior_velocity_planner::grid_utils::DenoiseBuffer;
+  using behavior_velocity_planner::grid_utils::GridParam;
+  // non square grid with free, unknown and occupied cells
+  nav_msgs::msg::OccupancyGrid occupancy_grid;
+  occupancy_grid.header.frame_id = "map";
+  occupancy_grid.info.width = 30;
+  occupancy_grid.info.height = 20;
+  occupancy_grid.info.resolution = 0.5;
+  occupancy_grid.info.origin.position.x = 10.0;
+  occupancy_grid.info.origin.position.y = -5.0;
+  occupancy_grid.info.origin.orientation.w = 1.0;
+  for (size_t i = 0; i < occupancy_grid.info.width * occupancy_grid.info.height; ++i) {
+    occupancy_grid.data.push_back(static_cast<int8_t>((i * 37) % 101));
+  }
+  const GridParam param{43, 58};
+
+  cv::Mat border_image;
+  cv::Mat occlusion_image;
+  DenoiseBuffer buffer;
+  behavior_velocity_planner::grid_utils::toQuantizedImage(
+    occupancy_grid, border_image, occlusion_image, buffer, param);
+  ASSERT_EQ(border_image.rows, static_cast<int>(occupancy_grid.info.width));
+  ASSERT_EQ(border_image.cols, static_cast<int>(occupancy_grid.info.height));
+  border_image += occlusion_image;
+
+  // expected: the image is converted to the occupancy grid and then to the grid map
+  nav_msgs::msg::OccupancyGrid expected_occupancy_grid = occupancy_grid;
+  behavior_velocity_planner::grid_utils::imageToOccupancyGrid(
+    border_image, &expected_occupancy_grid);
+  for (size_t i = 0; i < occupancy_grid.data.size(); ++i) {
+    const int8_t original = occupancy_grid.data.at(i);
+    const int8_t expected = original <= param.free_space_max ? 0
+                            : original < param.occupied_min  ? UNKNOWN
+                                                             : OCCUPIED;
+    ASSERT_EQ(expected_occupancy_grid.data.at(i), expected);
+  }
+  grid_map::GridMap expected_grid_map;
+  grid_map::GridMapRosConverter::fromOccupancyGrid(
+    expected_occupancy_grid, "layer", expected_grid_map);
+
+  // the grid map is reused between the conversions
+  grid_map::GridMap grid_map;
+  for (int i = 0; i < 2; ++i) {
+    behavior_velocity_planner::grid_utils::imageToGridMap(
+      border_image, occupancy_grid, buffer, grid_map);
+    EXPECT_TRUE((grid_map.getSize() == expected_grid_map.getSize()).all());
+    EXPECT_TRUE(grid_map.getPosition().isApprox(expected_grid_map.getPosition()));
+    EXPECT_EQ(grid_map.getFrameId(), expected_grid_map.getFrameId());
+    EXPECT_TRUE((grid_map["layer"].array() == expected_grid_map["layer"].array()).all());
+  }
+}
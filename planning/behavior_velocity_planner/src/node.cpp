@@ -23,6 +23,7 @@
 #include <tier4_autoware_utils/transform/transforms.hpp>
 
 #include <diagnostic_msgs/msg/diagnostic_status.hpp>
+#include <tier4_debug_msgs/msg/float64_stamped.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <lanelet2_routing/Route.h>
@@ -34,6 +35,7 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -134,6 +136,8 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   stop_reason_diag_pub_ =
     this->create_publisher<diagnostic_msgs::msg::DiagnosticStatus>("~/output/stop_reason", 1);
   debug_viz_pub_ = this->create_publisher<visualization_msgs::msg::MarkerArray>("~/debug/path", 1);
+  processing_time_publisher_ =
+    std::make_unique<tier4_autoware_utils::DebugPublisher>(this, "~/debug/planner_manager");
 
   // Parameters
   forward_path_length_ = declare_parameter<double>("forward_path_length");
@@ -149,6 +153,13 @@ BehaviorVelocityPlannerNode::BehaviorVelocityPlannerNode(const rclcpp::NodeOptio
   // is simulation or not
   planner_data_.is_simulation = declare_parameter<bool>("is_simulation");
 
+  // plan the scene modules in parallel
+  if (declare_parameter<bool>("enable_parallel_scene_modules")) {
+    // a negative number of threads is regarded as 0, which is the number of hardware threads
+    const int num_threads = declare_parameter<int>("parallel_scene_modules_num_threads");
+    planner_manager_.enableParallelSceneModules(static_cast<size_t>(std::max(num_threads, 0)));
+  }
+
   // Initialize PlannerManager
   for (const auto & name : declare_parameter<std::vector<std::string>>("launch_modules")) {
     // workaround: Since ROS 2 can't get empty list, launcher set [''] on the parameter.
@@ -381,6 +392,7 @@ void BehaviorVelocityPlannerNode::onTrigger(
   // Load map and check route handler
   if (has_received_map_) {
     planner_data_.route_handler_ = std::make_shared<route_handler::RouteHandler>(*map_ptr_);
+    planner_data_.lanelet_geometry_cache_ = std::make_shared<LaneletGeometryCache>();
     has_received_map_ = false;
   }
   if (!planner_data_.route_handler_) {
@@ -393,6 +405,9 @@ void BehaviorVelocityPlannerNode::onTrigger(
     return;
   }
 
+  // the intersections with the path of the previous cycle are not used any more
+  planner_data_.lanelet_geometry_cache_->clearPathCache();
+
   const autoware_auto_planning_msgs::msg::Path output_path_msg =
     generatePath(input_path_msg, planner_data_);
 
@@ -400,6 +415,7 @@ void BehaviorVelocityPlannerNode::onTrigger(
 
   path_pub_->publish(output_path_msg);
   stop_reason_diag_pub_->publish(planner_manager_.getStopReasonDiag());
+  publishProcessingTime();
 
   if (debug_viz_pub_->get_subscription_count() > 0) {
     publishDebugMarker(output_path_msg);
@@ -451,6 +467,16 @@ autoware_auto_planning_msgs::msg::Path BehaviorVelocityPlannerNode::generatePath
   return output_path_msg;
 }
 
+void BehaviorVelocityPlannerNode::publishProcessingTime()
+{
+  for (const auto & processing_time : planner_manager_.getProcessingTimes()) {
+    processing_time_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      processing_time.module_name + "/processing_time_ms", processing_time.processing_time_ms);
+  }
+  processing_time_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+    "merge_processing_time_ms", planner_manager_.getMergeProcessingTime());
+}
+
 void BehaviorVelocityPlannerNode::publishDebugMarker(
   const autoware_auto_planning_msgs::msg::Path & path)
 {
@@ -16,6 +16,7 @@
 #define NODE_HPP_
 
 #include "planner_manager.hpp"
+#include "tier4_autoware_utils/ros/debug_publisher.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
 
 #include <behavior_velocity_planner/srv/load_plugin.hpp>
@@ -98,6 +99,9 @@ private:
   rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr debug_viz_pub_;
 
   void publishDebugMarker(const autoware_auto_planning_msgs::msg::Path & path);
+  void publishProcessingTime();
+
+  std::unique_ptr<tier4_autoware_utils::DebugPublisher> processing_time_publisher_;
 
   //  parameter
   double forward_path_length_;
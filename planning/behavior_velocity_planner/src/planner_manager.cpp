@@ -14,10 +14,19 @@
 
 #include "planner_manager.hpp"
 
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
+#include <tier4_autoware_utils/system/tracer.hpp>
+
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace behavior_velocity_planner
 {
@@ -47,8 +56,108 @@ diagnostic_msgs::msg::DiagnosticStatus makeStopReasonDiag(
   stop_reason_diag.values.push_back(stop_reason_diag_kv);
   return stop_reason_diag;
 }
+
+using autoware_auto_planning_msgs::msg::PathPointWithLaneId;
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+
+// the points closer than this along the path are regarded as the same point in the merge
+constexpr double merge_epsilon = 1e-3;
+
+std::vector<double> calcArcLengths(const std::vector<PathPointWithLaneId> & points)
+{
+  std::vector<double> arc_lengths;
+  arc_lengths.reserve(points.size());
+  double s = 0.0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (i > 0) {
+      s += tier4_autoware_utils::calcDistance2d(points.at(i - 1), points.at(i));
+    }
+    arc_lengths.push_back(s);
+  }
+  return arc_lengths;
+}
+
+// index of the last point which is not ahead of the arc length
+size_t findHoldIndex(const std::vector<double> & arc_lengths, const double s)
+{
+  const auto itr = std::upper_bound(arc_lengths.begin(), arc_lengths.end(), s + merge_epsilon);
+  return itr == arc_lengths.begin() ? 0 : static_cast<size_t>(itr - arc_lengths.begin()) - 1;
+}
 }  // namespace
 
+MergedModulePaths mergeModulePaths(
+  const PathWithLaneId & input_path, const std::vector<PathWithLaneId> & module_paths,
+  const std::vector<std::optional<int>> & first_stop_indices)
+{
+  struct Candidate
+  {
+    double s;
+    size_t module_idx;
+    size_t point_idx;
+  };
+
+  std::vector<std::vector<double>> module_arc_lengths;
+  module_arc_lengths.reserve(module_paths.size());
+  for (const auto & module_path : module_paths) {
+    module_arc_lengths.push_back(calcArcLengths(module_path.points));
+  }
+
+  std::vector<Candidate> candidates;
+  for (size_t i = 0; i < module_paths.size(); ++i) {
+    for (size_t j = 0; j < module_paths.at(i).points.size(); ++j) {
+      candidates.push_back(Candidate{module_arc_lengths.at(i).at(j), i, j});
+    }
+  }
+  // stable so that the ties are resolved in the order of the plugins
+  std::stable_sort(candidates.begin(), candidates.end(), [](const auto & a, const auto & b) {
+    return a.s < b.s;
+  });
+
+  MergedModulePaths merged;
+  auto & merged_path = merged.path;
+  merged_path.header = input_path.header;
+  merged_path.left_bound = input_path.left_bound;
+  merged_path.right_bound = input_path.right_bound;
+  std::vector<double> merged_s;
+  for (const auto & candidate : candidates) {
+    if (!merged_s.empty() && candidate.s < merged_s.back() + merge_epsilon) {
+      continue;
+    }
+
+    auto point = module_paths.at(candidate.module_idx).points.at(candidate.point_idx);
+    for (size_t i = 0; i < module_paths.size(); ++i) {
+      const auto & module_point =
+        module_paths.at(i).points.at(findHoldIndex(module_arc_lengths.at(i), candidate.s));
+      point.point.longitudinal_velocity_mps = std::min(
+        point.point.longitudinal_velocity_mps, module_point.point.longitudinal_velocity_mps);
+    }
+    merged_path.points.push_back(point);
+    merged_s.push_back(candidate.s);
+  }
+
+  // map the first stop point of each module onto the merged path
+  merged.first_stop_path_point_index = static_cast<int>(merged_path.points.size()) - 1;
+  for (size_t i = 0; i < module_paths.size() && i < first_stop_indices.size(); ++i) {
+    const auto & stop_idx = first_stop_indices.at(i);
+    if (
+      !stop_idx || *stop_idx < 0 ||
+      module_arc_lengths.at(i).size() <= static_cast<size_t>(*stop_idx)) {
+      continue;
+    }
+
+    const double stop_s = module_arc_lengths.at(i).at(*stop_idx);
+    const auto itr = std::lower_bound(merged_s.begin(), merged_s.end(), stop_s - merge_epsilon);
+    const auto merged_stop_idx = static_cast<int>(
+      std::min(static_cast<size_t>(itr - merged_s.begin()), merged_s.size() - 1));
+    if (merged_stop_idx < merged.first_stop_path_point_index) {
+      merged.first_stop_path_point_index = merged_stop_idx;
+      merged.stop_module_index = i;
+    }
+  }
+
+  return merged;
+}
+
 BehaviorVelocityPlannerManager::BehaviorVelocityPlannerManager()
 : plugin_loader_("behavior_velocity_planner", "behavior_velocity_planner::PluginInterface")
 {
@@ -96,19 +205,33 @@ void BehaviorVelocityPlannerManager::removeScenePlugin(
   }
 }
 
+void BehaviorVelocityPlannerManager::enableParallelSceneModules(const size_t num_threads)
+{
+  thread_pool_ = std::make_unique<tier4_autoware_utils::ThreadPool>(num_threads);
+}
+
 autoware_auto_planning_msgs::msg::PathWithLaneId BehaviorVelocityPlannerManager::planPathVelocity(
   const std::shared_ptr<const PlannerData> & planner_data,
   const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path_msg)
 {
+  TIER4_TRACE_SCOPE("behavior_velocity_planner::planPathVelocity");
+  if (thread_pool_ && scene_manager_plugins_.size() > 1) {
+    return planPathVelocityInParallel(planner_data, input_path_msg);
+  }
+
   autoware_auto_planning_msgs::msg::PathWithLaneId output_path_msg = input_path_msg;
 
   int first_stop_path_point_index = static_cast<int>(output_path_msg.points.size() - 1);
   std::string stop_reason_msg("path_end");
 
+  processing_times_.clear();
+  merge_processing_time_ms_ = 0.0;
   for (const auto & plugin : scene_manager_plugins_) {
+    tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
     plugin->updateSceneModuleInstances(planner_data, input_path_msg);
     plugin->plan(&output_path_msg);
     const auto firstStopPathPointIndex = plugin->getFirstStopPathPointIndex();
+    processing_times_.push_back({plugin->getModuleName(), stop_watch.toc()});
 
     if (firstStopPathPointIndex) {
       if (firstStopPathPointIndex.value() < first_stop_path_point_index) {
@@ -124,6 +247,68 @@ autoware_auto_planning_msgs::msg::PathWithLaneId BehaviorVelocityPlannerManager:
   return output_path_msg;
 }
 
+autoware_auto_planning_msgs::msg::PathWithLaneId
+BehaviorVelocityPlannerManager::planPathVelocityInParallel(
+  const std::shared_ptr<const PlannerData> & planner_data,
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path_msg)
+{
+  const size_t num_plugins = scene_manager_plugins_.size();
+
+  // the modules share the planner data and the input path, which are not modified while planning.
+  // the lanelet map is not read-only though, since Lanelet2 computes and caches the centerline of
+  // each lanelet on the first access without synchronization. build the caches on this thread.
+  buildLaneletMapCaches(*planner_data);
+
+  // phase 1: each module plans its own copy of the input path.
+  std::vector<PathWithLaneId> module_paths(num_plugins, input_path_msg);
+  std::vector<std::optional<int>> first_stop_indices(num_plugins);
+  std::vector<double> module_processing_times(num_plugins, 0.0);
+  thread_pool_->parallelFor(num_plugins, [&](const size_t i) {
+    tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+    const auto & plugin = scene_manager_plugins_.at(i);
+    plugin->updateSceneModuleInstances(planner_data, input_path_msg);
+    plugin->plan(&module_paths.at(i));
+    first_stop_indices.at(i) = plugin->getFirstStopPathPointIndex();
+    module_processing_times.at(i) = stop_watch.toc();
+  });
+
+  processing_times_.clear();
+  for (size_t i = 0; i < num_plugins; ++i) {
+    processing_times_.push_back(
+      {scene_manager_plugins_.at(i)->getModuleName(), module_processing_times.at(i)});
+  }
+
+  // phase 2: merge the velocity of the planned paths in the order of the plugins
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+  auto merged = mergeModulePaths(input_path_msg, module_paths, first_stop_indices);
+  const std::string stop_reason_msg =
+    merged.stop_module_index
+      ? scene_manager_plugins_.at(*merged.stop_module_index)->getModuleName()
+      : std::string("path_end");
+  merge_processing_time_ms_ = stop_watch.toc();
+
+  stop_reason_diag_ = makeStopReasonDiag(
+    stop_reason_msg, merged.path.points[merged.first_stop_path_point_index].point.pose);
+
+  return std::move(merged.path);
+}
+
+void BehaviorVelocityPlannerManager::buildLaneletMapCaches(const PlannerData & planner_data)
+{
+  if (!planner_data.route_handler_) {
+    return;
+  }
+  const auto lanelet_map_ptr = planner_data.route_handler_->getLaneletMapPtr();
+  if (!lanelet_map_ptr || lanelet_map_ptr == cached_lanelet_map_ptr_.lock()) {
+    return;
+  }
+
+  for (const auto & lanelet : lanelet_map_ptr->laneletLayer) {
+    lanelet.centerline();
+  }
+  cached_lanelet_map_ptr_ = lanelet_map_ptr;
+}
+
 diagnostic_msgs::msg::DiagnosticStatus BehaviorVelocityPlannerManager::getStopReasonDiag() const
 {
   return stop_reason_diag_;
@@ -19,6 +19,7 @@
 #include <behavior_velocity_planner_common/plugin_wrapper.hpp>
 #include <pluginlib/class_loader.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/system/thread_pool.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
@@ -32,12 +33,48 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace behavior_velocity_planner
 {
+struct SceneModuleProcessingTime
+{
+  std::string module_name;
+  double processing_time_ms{0.0};
+};
+
+/**
+ * @brief Path merged from the paths which the scene modules planned from the same input path
+ */
+struct MergedModulePaths
+{
+  autoware_auto_planning_msgs::msg::PathWithLaneId path;
+  // index of the first stop point in the merged path, or the last point if no module stops
+  int first_stop_path_point_index{0};
+  // index of the module which inserted the first stop point
+  std::optional<size_t> stop_module_index{};
+};
+
+/**
+ * @brief Merge the paths planned by the scene modules from the same input path. The points
+ *        inserted by any of the modules are kept in the order of the arc length, where the point of
+ *        the earlier module is used if the points overlap, and the velocity of each point is the
+ *        minimum of the velocity which each module holds at the point. The first stop point of
+ *        each module is mapped onto the merged path, and the earlier module wins on a tie.
+ * @param input_path path which the modules planned from
+ * @param module_paths path planned by each module, in the order of the plugins
+ * @param first_stop_indices index of the first stop point of each module in its own path
+ * @return merged path
+ */
+MergedModulePaths mergeModulePaths(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path,
+  const std::vector<autoware_auto_planning_msgs::msg::PathWithLaneId> & module_paths,
+  const std::vector<std::optional<int>> & first_stop_indices);
+
 class BehaviorVelocityPlannerManager
 {
 public:
@@ -45,16 +82,46 @@ public:
   void launchScenePlugin(rclcpp::Node & node, const std::string & name);
   void removeScenePlugin(rclcpp::Node & node, const std::string & name);
 
+  /**
+   * @brief Enable the two-phase mode, in which each scene module plans its own copy of the input
+   *        path in parallel, and the velocity of the planned paths is merged in the order of the
+   *        plugins. Note that a module can not see the stop points inserted by the other modules
+   *        in this mode.
+   * @param num_threads number of the worker threads. the number of hardware threads is used if 0.
+   */
+  void enableParallelSceneModules(const size_t num_threads = 0);
+
   autoware_auto_planning_msgs::msg::PathWithLaneId planPathVelocity(
     const std::shared_ptr<const PlannerData> & planner_data,
     const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path_msg);
 
   diagnostic_msgs::msg::DiagnosticStatus getStopReasonDiag() const;
 
+  // time to update and plan each scene module in the last cycle
+  const std::vector<SceneModuleProcessingTime> & getProcessingTimes() const
+  {
+    return processing_times_;
+  }
+
+  // time to merge the paths planned by the scene modules in the last cycle (parallel mode only)
+  double getMergeProcessingTime() const { return merge_processing_time_ms_; }
+
 private:
+  autoware_auto_planning_msgs::msg::PathWithLaneId planPathVelocityInParallel(
+    const std::shared_ptr<const PlannerData> & planner_data,
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & input_path_msg);
+
+  // build the lazy caches of the lanelet map once per map before it is accessed in parallel
+  void buildLaneletMapCaches(const PlannerData & planner_data);
+
   diagnostic_msgs::msg::DiagnosticStatus stop_reason_diag_;
   pluginlib::ClassLoader<PluginInterface> plugin_loader_;
   std::vector<std::shared_ptr<PluginInterface>> scene_manager_plugins_;
+
+  std::unique_ptr<tier4_autoware_utils::ThreadPool> thread_pool_;
+  std::vector<SceneModuleProcessingTime> processing_times_;
+  double merge_processing_time_ms_{0.0};
+  std::weak_ptr<const lanelet::LaneletMap> cached_lanelet_map_ptr_;
 };
 }  // namespace behavior_velocity_planner
 
@@ -0,0 +1,215 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "planner_manager.hpp"
+
+#include <motion_utils/trajectory/trajectory.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+using autoware_auto_planning_msgs::msg::PathPointWithLaneId;
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+using behavior_velocity_planner::mergeModulePaths;
+
+namespace
+{
+// a scene module, which plans the path and returns the index of its first stop point
+using Module = std::function<std::optional<int>(PathWithLaneId &)>;
+
+PathWithLaneId createStraightPath(const size_t num_points, const float velocity)
+{
+  PathWithLaneId path;
+  for (size_t i = 0; i < num_points; ++i) {
+    PathPointWithLaneId point;
+    point.point.pose.position.x = static_cast<double>(i);
+    point.point.pose.orientation.w = 1.0;
+    point.point.longitudinal_velocity_mps = velocity;
+    point.lane_ids.push_back(static_cast<int64_t>(i / 10));
+    path.points.push_back(point);
+  }
+  return path;
+}
+
+Module stopAt(const double s)
+{
+  return [s](PathWithLaneId & path) -> std::optional<int> {
+    const auto stop_idx = motion_utils::insertStopPoint(s, path.points);
+    if (!stop_idx) {
+      return std::nullopt;
+    }
+    return static_cast<int>(*stop_idx);
+  };
+}
+
+Module slowDownFrom(const double s, const double velocity)
+{
+  return [s, velocity](PathWithLaneId & path) -> std::optional<int> {
+    const auto src_point = path.points.front().point.pose.position;
+    motion_utils::insertDecelPoint(src_point, s, velocity, path.points);
+    return std::nullopt;
+  };
+}
+
+struct PlanResult
+{
+  PathWithLaneId path;
+  int first_stop_path_point_index;
+  std::optional<size_t> stop_module_index;
+};
+
+// plan the modules one after another on the same path as the serial mode of the planner manager
+PlanResult planSequentially(const PathWithLaneId & input_path, const std::vector<Module> & modules)
+{
+  PlanResult result{input_path, static_cast<int>(input_path.points.size()) - 1, std::nullopt};
+  for (size_t i = 0; i < modules.size(); ++i) {
+    const auto stop_idx = modules.at(i)(result.path);
+    if (stop_idx && *stop_idx < result.first_stop_path_point_index) {
+      result.first_stop_path_point_index = *stop_idx;
+      result.stop_module_index = i;
+    }
+  }
+  return result;
+}
+
+// plan each module on its own copy of the input path, and merge them as the parallel mode
+PlanResult planInParallel(const PathWithLaneId & input_path, const std::vector<Module> & modules)
+{
+  std::vector<PathWithLaneId> module_paths(modules.size(), input_path);
+  std::vector<std::optional<int>> first_stop_indices(modules.size());
+  for (size_t i = 0; i < modules.size(); ++i) {
+    first_stop_indices.at(i) = modules.at(i)(module_paths.at(i));
+  }
+  const auto merged = mergeModulePaths(input_path, module_paths, first_stop_indices);
+  return PlanResult{merged.path, merged.first_stop_path_point_index, merged.stop_module_index};
+}
+
+void expectSamePath(const PathWithLaneId & path, const PathWithLaneId & expected)
+{
+  ASSERT_EQ(path.points.size(), expected.points.size());
+  for (size_t i = 0; i < path.points.size(); ++i) {
+    const auto & point = path.points.at(i);
+    const auto & expected_point = expected.points.at(i);
+    EXPECT_NEAR(point.point.pose.position.x, expected_point.point.pose.position.x, 1e-6);
+    EXPECT_NEAR(point.point.pose.position.y, expected_point.point.pose.position.y, 1e-6);
+    EXPECT_FLOAT_EQ(
+      point.point.longitudinal_velocity_mps, expected_point.point.longitudinal_velocity_mps);
+    EXPECT_EQ(point.lane_ids, expected_point.lane_ids);
+  }
+}
+}  // namespace
+
+TEST(PlannerManager, mergeModulePathsSameAsSequentialPlanning)
+{
+  const auto input_path = createStraightPath(31, 10.0);
+  const std::vector<Module> modules{
+    slowDownFrom(4.5, 5.0), stopAt(12.5), stopAt(8.3), stopAt(12.5), slowDownFrom(10.2, 2.0)};
+
+  const auto sequential = planSequentially(input_path, modules);
+  const auto parallel = planInParallel(input_path, modules);
+  expectSamePath(parallel.path, sequential.path);
+
+  // the stop point inserted by two modules is merged into one
+  EXPECT_EQ(parallel.path.points.size(), input_path.points.size() + 4);
+
+  // the velocity is the minimum of the modules
+  EXPECT_FLOAT_EQ(parallel.path.points.at(4).point.longitudinal_velocity_mps, 10.0);
+  EXPECT_FLOAT_EQ(parallel.path.points.at(5).point.longitudinal_velocity_mps, 5.0);
+  EXPECT_FLOAT_EQ(parallel.path.points.back().point.longitudinal_velocity_mps, 0.0);
+
+  // the stop index of the third module is mapped onto the merged path
+  EXPECT_EQ(parallel.first_stop_path_point_index, sequential.first_stop_path_point_index);
+  EXPECT_EQ(parallel.first_stop_path_point_index, 10);
+  ASSERT_TRUE(parallel.stop_module_index);
+  EXPECT_EQ(*parallel.stop_module_index, 2u);
+}
+
+TEST(PlannerManager, mergeModulePathsStopIndex)
+{
+  const auto input_path = createStraightPath(31, 10.0);
+
+  // the earlier module wins if the modules stop at the same point
+  {
+    const auto parallel = planInParallel(input_path, {stopAt(12.5), stopAt(12.5)});
+    EXPECT_EQ(parallel.first_stop_path_point_index, 13);
+    ASSERT_TRUE(parallel.stop_module_index);
+    EXPECT_EQ(*parallel.stop_module_index, 0u);
+  }
+
+  // the earlier stop point wins even if the points are inserted before it by the later modules
+  {
+    const std::vector<Module> modules{stopAt(20.5), slowDownFrom(3.5, 5.0), stopAt(15.5)};
+    const auto parallel = planInParallel(input_path, modules);
+    EXPECT_EQ(parallel.first_stop_path_point_index, 17);
+    EXPECT_NEAR(
+      parallel.path.points.at(parallel.first_stop_path_point_index).point.pose.position.x, 15.5,
+      1e-6);
+    ASSERT_TRUE(parallel.stop_module_index);
+    EXPECT_EQ(*parallel.stop_module_index, 2u);
+  }
+
+  // the last point is used if no module stops
+  {
+    const auto parallel = planInParallel(input_path, {slowDownFrom(3.5, 5.0), stopAt(100.0)});
+    EXPECT_EQ(
+      parallel.first_stop_path_point_index, static_cast<int>(parallel.path.points.size()) - 1);
+    EXPECT_FALSE(parallel.stop_module_index);
+  }
+}
+
+TEST(PlannerManager, mergeModulePathsRandomModules)
+{
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int> num_modules_dist(1, 6);
+  std::uniform_int_distribution<int> position_dist(0, 299);
+  std::uniform_int_distribution<int> velocity_dist(0, 9);
+  std::bernoulli_distribution stop_dist(0.5);
+
+  const auto input_path = createStraightPath(31, 10.0);
+  for (int trial = 0; trial < 100; ++trial) {
+    // the points are inserted at the middle of 0.1 m steps so that some of them overlap
+    std::vector<Module> modules;
+    double min_stop_s = std::numeric_limits<double>::max();
+    const int num_modules = num_modules_dist(engine);
+    for (int i = 0; i < num_modules; ++i) {
+      const double s = 0.05 + 0.1 * position_dist(engine);
+      if (stop_dist(engine)) {
+        modules.push_back(stopAt(s));
+        min_stop_s = std::min(min_stop_s, s);
+      } else {
+        modules.push_back(slowDownFrom(s, static_cast<double>(velocity_dist(engine))));
+      }
+    }
+
+    const auto sequential = planSequentially(input_path, modules);
+    const auto parallel = planInParallel(input_path, modules);
+    expectSamePath(parallel.path, sequential.path);
+
+    // the first stop point among the modules
+    const auto & stop_point = parallel.path.points.at(parallel.first_stop_path_point_index);
+    if (min_stop_s < std::numeric_limits<double>::max()) {
+      ASSERT_TRUE(parallel.stop_module_index);
+      EXPECT_NEAR(stop_point.point.pose.position.x, min_stop_s, 1e-6);
+      EXPECT_FLOAT_EQ(stop_point.point.longitudinal_velocity_mps, 0.0);
+    } else {
+      EXPECT_FALSE(parallel.stop_module_index);
+    }
+  }
+}
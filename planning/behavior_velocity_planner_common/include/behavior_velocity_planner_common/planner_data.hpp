@@ -17,6 +17,7 @@
 
 #include "route_handler/route_handler.hpp"
 
+#include <behavior_velocity_planner_common/utilization/lanelet_geometry_cache.hpp>
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <motion_velocity_smoother/smoother/smoother_base.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
@@ -91,6 +92,8 @@ struct PlannerData
   std::shared_ptr<motion_velocity_smoother::SmootherBase> velocity_smoother_;
   // route handler
   std::shared_ptr<route_handler::RouteHandler> route_handler_;
+  // geometry of the map elements, which is recreated with the route handler
+  std::shared_ptr<LaneletGeometryCache> lanelet_geometry_cache_;
   // parameters
   vehicle_info_util::VehicleInfo vehicle_info_;
 
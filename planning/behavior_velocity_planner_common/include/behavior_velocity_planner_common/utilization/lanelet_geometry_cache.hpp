@@ -0,0 +1,148 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__LANELET_GEOMETRY_CACHE_HPP_
+#define BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__LANELET_GEOMETRY_CACHE_HPP_
+
+#include <tier4_autoware_utils/geometry/boost_geometry.hpp>
+
+#include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/primitives/Polygon.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+/**
+ * @brief Cache of the static 2D geometry of the lanelets and the area polygons in the map, so that
+ *        the scene modules do not convert them at every cycle. The geometry is computed at the
+ *        first access and kept until the cache is destroyed, so the cache has to be recreated
+ *        when the map is updated. The lanelets and the polygons are identified by their ids, so
+ *        the ones without a valid id are not cached. The intersections of a path with the geometry
+ *        are memoized until clearPathCache() is called. All the methods are thread safe.
+ */
+class LaneletGeometryCache
+{
+public:
+  struct PolygonGeometry
+  {
+    lanelet::BasicPolygon2d polygon;
+    tier4_autoware_utils::Box2d bounding_box;
+    double area{0.0};
+  };
+
+  struct LaneletGeometry
+  {
+    lanelet::BasicPolygon2d polygon;
+    tier4_autoware_utils::Box2d bounding_box;
+    double area{0.0};
+    lanelet::BasicLineString2d centerline;
+    std::vector<double> centerline_arc_lengths;  // arc length from the start of the centerline
+  };
+
+  struct PathIntersection
+  {
+    size_t segment_idx;  // index of the path segment which intersects the polygon
+    tier4_autoware_utils::Point2d point;
+  };
+
+  /**
+   * @brief Get the geometry of the lanelet. The geometry is cached by the lanelet id, so the
+   *        lanelets without a valid id, which are generated by the modules, are not cached and
+   *        their geometry is computed at every call.
+   * @return The geometry, which the caller has to keep while using it.
+   */
+  std::shared_ptr<const LaneletGeometry> getLaneletGeometry(const lanelet::ConstLanelet & lanelet);
+
+  // same as getLaneletGeometry() for the area polygons
+  std::shared_ptr<const PolygonGeometry> getPolygonGeometry(
+    const lanelet::ConstPolygon3d & polygon);
+
+  /**
+   * @brief Get the intersections of the path segments with the polygon of the lanelet. Same as
+   *        bg::intersection() of each segment and the polygon (of the polygon and each segment for
+   *        the area polygon), where the segments which are apart from the bounding box are skipped.
+   *        The intersections are not memoized for the lanelet without a valid id.
+   * @return std::vector<PathIntersection> The intersections in the order of the segments.
+   */
+  std::vector<PathIntersection> getPathIntersections(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
+    const lanelet::ConstLanelet & lanelet);
+
+  std::vector<PathIntersection> getPathIntersections(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
+    const lanelet::ConstPolygon3d & polygon);
+
+  // discard the memoized intersections. called at every planning cycle.
+  void clearPathCache();
+
+  size_t getPathCacheSize() const;
+
+private:
+  // the path is identified by its hash together with the number of points and the end points, so
+  // that a hash collision of the different paths does not return the wrong intersections
+  struct PathCacheKey
+  {
+    uint64_t path_hash;
+    lanelet::Id id;
+    bool is_lanelet;
+    size_t num_points;
+    tier4_autoware_utils::Point2d front_point;
+    tier4_autoware_utils::Point2d back_point;
+
+    bool operator==(const PathCacheKey & other) const
+    {
+      return path_hash == other.path_hash && id == other.id && is_lanelet == other.is_lanelet &&
+             num_points == other.num_points && front_point.x() == other.front_point.x() &&
+             front_point.y() == other.front_point.y() && back_point.x() == other.back_point.x() &&
+             back_point.y() == other.back_point.y();
+    }
+  };
+
+  struct PathCacheKeyHash
+  {
+    size_t operator()(const PathCacheKey & key) const;
+  };
+
+  static PathCacheKey createPathCacheKey(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & path, const lanelet::Id id,
+    const bool is_lanelet);
+
+  std::vector<PathIntersection> getPathIntersections(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & path, const PathCacheKey & key,
+    const lanelet::BasicPolygon2d & polygon, const tier4_autoware_utils::Box2d & bounding_box);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<lanelet::Id, std::shared_ptr<const LaneletGeometry>> lanelet_geometries_;
+  std::unordered_map<lanelet::Id, std::shared_ptr<const PolygonGeometry>> polygon_geometries_;
+  std::unordered_map<PathCacheKey, std::vector<PathIntersection>, PathCacheKeyHash>
+    path_intersections_;
+};
+
+namespace planning_utils
+{
+// hash of the 2D position of the path points, which identifies the path in the path cache
+uint64_t calcPathHash(const autoware_auto_planning_msgs::msg::PathWithLaneId & path);
+}  // namespace planning_utils
+}  // namespace behavior_velocity_planner
+
+#endif  // BEHAVIOR_VELOCITY_PLANNER_COMMON__UTILIZATION__LANELET_GEOMETRY_CACHE_HPP_
@@ -0,0 +1,239 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_velocity_planner_common/utilization/lanelet_geometry_cache.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <lanelet2_core/geometry/LineString.h>
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace behavior_velocity_planner
+{
+namespace bg = boost::geometry;
+using autoware_auto_planning_msgs::msg::PathWithLaneId;
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::Point2d;
+
+namespace
+{
+Box2d calcBoundingBox(const lanelet::BasicPolygon2d & polygon)
+{
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & p : polygon) {
+    min_x = std::min(min_x, p.x());
+    min_y = std::min(min_y, p.y());
+    max_x = std::max(max_x, p.x());
+    max_y = std::max(max_y, p.y());
+  }
+  return Box2d{Point2d{min_x, min_y}, Point2d{max_x, max_y}};
+}
+
+bool isSegmentApartFrom(const Point2d & p0, const Point2d & p1, const Box2d & box)
+{
+  return std::max(p0.x(), p1.x()) < box.min_corner().x() ||
+         box.max_corner().x() < std::min(p0.x(), p1.x()) ||
+         std::max(p0.y(), p1.y()) < box.min_corner().y() ||
+         box.max_corner().y() < std::min(p0.y(), p1.y());
+}
+
+void combineHash(uint64_t & seed, const uint64_t value)
+{
+  seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+uint64_t toBits(const double value)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+}  // namespace
+
+std::shared_ptr<const LaneletGeometryCache::LaneletGeometry>
+LaneletGeometryCache::getLaneletGeometry(const lanelet::ConstLanelet & lanelet)
+{
+  const bool is_cacheable = lanelet.id() != lanelet::InvalId;
+  if (is_cacheable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto itr = lanelet_geometries_.find(lanelet.id());
+    if (itr != lanelet_geometries_.end()) {
+      return itr->second;
+    }
+  }
+
+  auto geometry = std::make_shared<LaneletGeometry>();
+  geometry->polygon = lanelet.polygon2d().basicPolygon();
+  geometry->bounding_box = calcBoundingBox(geometry->polygon);
+  geometry->area = bg::area(geometry->polygon);
+  geometry->centerline = lanelet.centerline2d().basicLineString();
+  geometry->centerline_arc_lengths.reserve(geometry->centerline.size());
+  double s = 0.0;
+  for (size_t i = 0; i < geometry->centerline.size(); ++i) {
+    if (i > 0) {
+      s += (geometry->centerline.at(i) - geometry->centerline.at(i - 1)).norm();
+    }
+    geometry->centerline_arc_lengths.push_back(s);
+  }
+  if (!is_cacheable) {
+    return geometry;
+  }
+
+  // the geometry may be inserted by another thread in the meantime, which is the same one
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lanelet_geometries_.emplace(lanelet.id(), std::move(geometry)).first->second;
+}
+
+std::shared_ptr<const LaneletGeometryCache::PolygonGeometry>
+LaneletGeometryCache::getPolygonGeometry(const lanelet::ConstPolygon3d & polygon)
+{
+  const bool is_cacheable = polygon.id() != lanelet::InvalId;
+  if (is_cacheable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto itr = polygon_geometries_.find(polygon.id());
+    if (itr != polygon_geometries_.end()) {
+      return itr->second;
+    }
+  }
+
+  auto geometry = std::make_shared<PolygonGeometry>();
+  geometry->polygon = lanelet::utils::to2D(polygon).basicPolygon();
+  geometry->bounding_box = calcBoundingBox(geometry->polygon);
+  geometry->area = bg::area(geometry->polygon);
+  if (!is_cacheable) {
+    return geometry;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return polygon_geometries_.emplace(polygon.id(), std::move(geometry)).first->second;
+}
+
+std::vector<LaneletGeometryCache::PathIntersection> LaneletGeometryCache::getPathIntersections(
+  const PathWithLaneId & path, const lanelet::ConstLanelet & lanelet)
+{
+  const auto geometry = getLaneletGeometry(lanelet);
+  return getPathIntersections(
+    path, createPathCacheKey(path, lanelet.id(), true), geometry->polygon,
+    geometry->bounding_box);
+}
+
+std::vector<LaneletGeometryCache::PathIntersection> LaneletGeometryCache::getPathIntersections(
+  const PathWithLaneId & path, const lanelet::ConstPolygon3d & polygon)
+{
+  const auto geometry = getPolygonGeometry(polygon);
+  return getPathIntersections(
+    path, createPathCacheKey(path, polygon.id(), false), geometry->polygon,
+    geometry->bounding_box);
+}
+
+LaneletGeometryCache::PathCacheKey LaneletGeometryCache::createPathCacheKey(
+  const PathWithLaneId & path, const lanelet::Id id, const bool is_lanelet)
+{
+  PathCacheKey key{planning_utils::calcPathHash(path), id, is_lanelet, path.points.size(), {}, {}};
+  if (!path.points.empty()) {
+    const auto & front = path.points.front().point.pose.position;
+    const auto & back = path.points.back().point.pose.position;
+    key.front_point = Point2d{front.x, front.y};
+    key.back_point = Point2d{back.x, back.y};
+  }
+  return key;
+}
+
+std::vector<LaneletGeometryCache::PathIntersection> LaneletGeometryCache::getPathIntersections(
+  const PathWithLaneId & path, const PathCacheKey & key, const lanelet::BasicPolygon2d & polygon,
+  const Box2d & bounding_box)
+{
+  const bool is_cacheable = key.id != lanelet::InvalId;
+  if (is_cacheable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto itr = path_intersections_.find(key);
+    if (itr != path_intersections_.end()) {
+      return itr->second;
+    }
+  }
+
+  std::vector<PathIntersection> intersections;
+  for (size_t i = 0; i + 1 < path.points.size(); ++i) {
+    const auto & p_back = path.points.at(i).point.pose.position;
+    const auto & p_front = path.points.at(i + 1).point.pose.position;
+    const Point2d p0{p_back.x, p_back.y};
+    const Point2d p1{p_front.x, p_front.y};
+    if (isSegmentApartFrom(p0, p1, bounding_box)) {
+      continue;
+    }
+
+    const tier4_autoware_utils::LineString2d segment{p0, p1};
+    std::vector<Point2d> segment_intersections;
+    // keep the argument order of the modules, which affects the order of the intersections
+    if (key.is_lanelet) {
+      bg::intersection(segment, polygon, segment_intersections);
+    } else {
+      bg::intersection(polygon, segment, segment_intersections);
+    }
+    for (const auto & p : segment_intersections) {
+      intersections.push_back(PathIntersection{i, p});
+    }
+  }
+
+  if (is_cacheable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_intersections_.emplace(key, intersections);
+  }
+  return intersections;
+}
+
+void LaneletGeometryCache::clearPathCache()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  path_intersections_.clear();
+}
+
+size_t LaneletGeometryCache::getPathCacheSize() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return path_intersections_.size();
+}
+
+size_t LaneletGeometryCache::PathCacheKeyHash::operator()(const PathCacheKey & key) const
+{
+  uint64_t seed = key.path_hash;
+  combineHash(seed, static_cast<uint64_t>(key.id));
+  combineHash(seed, key.is_lanelet ? 1 : 0);
+  return static_cast<size_t>(seed);
+}
+
+namespace planning_utils
+{
+uint64_t calcPathHash(const PathWithLaneId & path)
+{
+  uint64_t seed = path.points.size();
+  for (const auto & p : path.points) {
+    combineHash(seed, toBits(p.point.pose.position.x));
+    combineHash(seed, toBits(p.point.pose.position.y));
+  }
+  return seed;
+}
+}  // namespace planning_utils
+}  // namespace behavior_velocity_planner
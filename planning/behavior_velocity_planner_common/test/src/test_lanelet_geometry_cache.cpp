@@ -0,0 +1,125 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils.hpp"
+
+#include <behavior_velocity_planner_common/utilization/lanelet_geometry_cache.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+using behavior_velocity_planner::LaneletGeometryCache;
+
+namespace
+{
+// lanelet of x in [10, 20] and y in [-2, 2]
+lanelet::ConstLanelet createLanelet(const lanelet::Id id, const double x_offset = 0.0)
+{
+  const lanelet::LineString3d left_bound(
+    lanelet::utils::getId(),
+    {lanelet::Point3d(lanelet::utils::getId(), 10.0 + x_offset, 2.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), 20.0 + x_offset, 2.0, 0.0)});
+  const lanelet::LineString3d right_bound(
+    lanelet::utils::getId(),
+    {lanelet::Point3d(lanelet::utils::getId(), 10.0 + x_offset, -2.0, 0.0),
+     lanelet::Point3d(lanelet::utils::getId(), 20.0 + x_offset, -2.0, 0.0)});
+  return lanelet::Lanelet(id, left_bound, right_bound);
+}
+}  // namespace
+
+TEST(LaneletGeometryCache, LaneletGeometry)
+{
+  LaneletGeometryCache cache;
+  const auto lanelet = createLanelet(1);
+
+  const auto geometry = cache.getLaneletGeometry(lanelet);
+  EXPECT_NEAR(geometry->area, 40.0, 1e-6);
+  EXPECT_NEAR(geometry->bounding_box.min_corner().x(), 10.0, 1e-6);
+  EXPECT_NEAR(geometry->bounding_box.min_corner().y(), -2.0, 1e-6);
+  EXPECT_NEAR(geometry->bounding_box.max_corner().x(), 20.0, 1e-6);
+  EXPECT_NEAR(geometry->bounding_box.max_corner().y(), 2.0, 1e-6);
+  ASSERT_FALSE(geometry->centerline_arc_lengths.empty());
+  EXPECT_EQ(geometry->centerline.size(), geometry->centerline_arc_lengths.size());
+  EXPECT_NEAR(geometry->centerline_arc_lengths.back(), 10.0, 1e-6);
+
+  // the geometry is computed only once
+  EXPECT_EQ(geometry, cache.getLaneletGeometry(lanelet));
+}
+
+TEST(LaneletGeometryCache, LaneletWithoutId)
+{
+  LaneletGeometryCache cache;
+  const auto path = test::generatePath(0.0, 0.0, 30.0, 0.0, 31);
+
+  // the lanelets generated by the modules have no id, and are different from each other
+  const auto lanelet = createLanelet(lanelet::InvalId);
+  const auto shifted_lanelet = createLanelet(lanelet::InvalId, 5.0);
+
+  const auto geometry = cache.getLaneletGeometry(lanelet);
+  const auto shifted_geometry = cache.getLaneletGeometry(shifted_lanelet);
+  EXPECT_NEAR(geometry->bounding_box.min_corner().x(), 10.0, 1e-6);
+  EXPECT_NEAR(shifted_geometry->bounding_box.min_corner().x(), 15.0, 1e-6);
+
+  const auto intersections = cache.getPathIntersections(path, lanelet);
+  const auto shifted_intersections = cache.getPathIntersections(path, shifted_lanelet);
+  ASSERT_EQ(intersections.size(), 2u);
+  ASSERT_EQ(shifted_intersections.size(), 2u);
+  EXPECT_NEAR(intersections.at(0).point.x(), 10.0, 1e-6);
+  EXPECT_NEAR(shifted_intersections.at(0).point.x(), 15.0, 1e-6);
+  EXPECT_EQ(cache.getPathCacheSize(), 0u);
+
+  // the lanelet with an id is still cached
+  const auto lanelet_with_id = createLanelet(3, 5.0);
+  EXPECT_EQ(cache.getLaneletGeometry(lanelet_with_id), cache.getLaneletGeometry(lanelet_with_id));
+  EXPECT_EQ(cache.getPathIntersections(path, lanelet_with_id).size(), 2u);
+  EXPECT_EQ(cache.getPathCacheSize(), 1u);
+}
+
+TEST(LaneletGeometryCache, PathIntersections)
+{
+  LaneletGeometryCache cache;
+  const auto lanelet = createLanelet(2);
+  const auto path = test::generatePath(0.0, 0.0, 30.0, 0.0, 31);
+
+  const auto intersections = cache.getPathIntersections(path, lanelet);
+  ASSERT_EQ(intersections.size(), 2u);
+  EXPECT_NEAR(intersections.at(0).point.x(), 10.0, 1e-6);
+  EXPECT_NEAR(intersections.at(1).point.x(), 20.0, 1e-6);
+  EXPECT_LT(intersections.at(0).segment_idx, intersections.at(1).segment_idx);
+  EXPECT_EQ(cache.getPathCacheSize(), 1u);
+
+  // memoized for the same path
+  cache.getPathIntersections(path, lanelet);
+  EXPECT_EQ(cache.getPathCacheSize(), 1u);
+
+  // the path which does not cross the lanelet
+  const auto apart_path = test::generatePath(0.0, 10.0, 30.0, 10.0, 31);
+  EXPECT_TRUE(cache.getPathIntersections(apart_path, lanelet).empty());
+  EXPECT_EQ(cache.getPathCacheSize(), 2u);
+
+  cache.clearPathCache();
+  EXPECT_EQ(cache.getPathCacheSize(), 0u);
+}
+
+TEST(LaneletGeometryCache, PathHash)
+{
+  using behavior_velocity_planner::planning_utils::calcPathHash;
+  const auto path = test::generatePath(0.0, 0.0, 30.0, 0.0, 31);
+  auto moved_path = path;
+  moved_path.points.at(10).point.pose.position.y = 0.1;
+
+  EXPECT_EQ(calcPathHash(path), calcPathHash(test::generatePath(0.0, 0.0, 30.0, 0.0, 31)));
+  EXPECT_NE(calcPathHash(path), calcPathHash(moved_path));
+}
@@ -117,14 +117,18 @@ geometry_msgs::msg::Pose get_closest_centerline_pose(
     return point;
   }
 
-  const auto refined_center_line = lanelet::utils::generateFineCenterline(closest_lanelet, 1.0);
-  closest_lanelet.setCenterline(refined_center_line);
+  // NOTE: the lanelet is shared with the other users of the map through LaneletMapRegistry, so the
+  // refined centerline is set to a copy of the lanelet instead of the lanelet in the map.
+  lanelet::Lanelet refined_lanelet(
+    closest_lanelet.id(), closest_lanelet.leftBound(), closest_lanelet.rightBound(),
+    closest_lanelet.attributes());
+  refined_lanelet.setCenterline(lanelet::utils::generateFineCenterline(closest_lanelet, 1.0));
 
-  const double lane_yaw = lanelet::utils::getLaneletAngle(closest_lanelet, point.position);
+  const double lane_yaw = lanelet::utils::getLaneletAngle(refined_lanelet, point.position);
 
   const auto nearest_idx =
-    motion_utils::findNearestIndex(convertCenterlineToPoints(closest_lanelet), point.position);
-  const auto nearest_point = closest_lanelet.centerline()[nearest_idx];
+    motion_utils::findNearestIndex(convertCenterlineToPoints(refined_lanelet), point.position);
+  const auto nearest_point = refined_lanelet.centerline()[nearest_idx];
 
   // shift nearest point on its local y axis so that vehicle's right and left edges
   // would have approx the same clearance from road border
@@ -181,13 +185,14 @@ bool DefaultPlanner::ready() const
 
 void DefaultPlanner::map_callback(const HADMapBin::ConstSharedPtr msg)
 {
+  // the route handler and this planner share the map deserialized once in the registry
   route_handler_.setMap(*msg);
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
-  lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
-  shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+  const auto map_data = route_handler::LaneletMapRegistry::getInstance().get(*msg);
+  lanelet_map_ptr_ = map_data->lanelet_map_ptr;
+  traffic_rules_ptr_ = map_data->traffic_rules_ptr;
+  routing_graph_ptr_ = map_data->routing_graph_ptr;
+  road_lanelets_ = map_data->road_lanelets;
+  shoulder_lanelets_ = map_data->shoulder_lanelets;
   is_graph_ready_ = true;
 }
 
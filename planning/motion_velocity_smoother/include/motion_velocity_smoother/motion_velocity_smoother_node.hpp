@@ -225,6 +225,8 @@ private:
 
   bool isEngageStatus(const double target_vel) const;
 
+  bool hasDebugTrajectorySubscribers() const;
+
   void publishDebugTrajectories(const std::vector<TrajectoryPoints> & debug_trajectories) const;
 
   void publishClosestVelocity(
@@ -24,6 +24,8 @@
 
 #include "boost/optional.hpp"
 
+#include <Eigen/SparseCore>
+
 #include <vector>
 
 namespace motion_velocity_smoother
@@ -54,11 +56,34 @@ public:
   void setParam(const Param & param);
   Param getParam() const;
 
+  // set the distance ego traveled since the previous apply() to shift the previous solution for
+  // the warm start of the optimization
+  void setTravelDistance(const double travel_distance);
+  // resample the debug trajectories in apply() only when they are used
+  void setDebugTrajectoriesEnabled(const bool enabled);
+
 private:
   Param smoother_param_;
   autoware::common::osqp::OSQPInterface qp_solver_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
+  // QP problem whose sparsity pattern is kept while the number of the optimized points is unchanged
+  Eigen::SparseMatrix<double> P_;
+  Eigen::SparseMatrix<double> A_;
+  std::vector<double> q_;
+  std::vector<double> lower_bound_;
+  std::vector<double> upper_bound_;
+
+  // previous solution and the arc lengths of its points for warm start
+  std::vector<double> prev_solution_;
+  std::vector<double> prev_arclength_;
+  double travel_distance_{0.0};
+
+  bool enable_debug_trajectories_{true};
+
+  void initializeProblemStructure(const size_t N);
+  std::vector<double> calcWarmStartSolution(const std::vector<double> & arclength) const;
+
   TrajectoryPoints forwardJerkFilter(
     const double v0, const double a0, const double a_max, const double a_stop, const double j_max,
     const TrajectoryPoints & input) const;
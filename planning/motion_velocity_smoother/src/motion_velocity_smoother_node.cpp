@@ -623,6 +623,13 @@ bool MotionVelocitySmootherNode::smoothVelocity(
   clipped.insert(
     clipped.end(), traj_resampled.begin() + traj_resampled_closest, traj_resampled.end());
 
+  if (node_param_.algorithm_type == AlgorithmType::JERK_FILTERED) {
+    const auto jerk_filtered_smoother = std::dynamic_pointer_cast<JerkFilteredSmoother>(smoother_);
+    jerk_filtered_smoother->setTravelDistance(prev_output_.empty() ? 0.0 : calcTravelDistance());
+    jerk_filtered_smoother->setDebugTrajectoriesEnabled(
+      publish_debug_trajs_ && hasDebugTrajectorySubscribers());
+  }
+
   std::vector<TrajectoryPoints> debug_trajectories;
   if (!smoother_->apply(
         initial_motion.vel, initial_motion.acc, clipped, traj_smoothed, debug_trajectories)) {
@@ -930,6 +937,17 @@ void MotionVelocitySmootherNode::applyStopApproachingVelocity(TrajectoryPoints &
   }
 }
 
+bool MotionVelocitySmootherNode::hasDebugTrajectorySubscribers() const
+{
+  if (node_param_.algorithm_type == AlgorithmType::JERK_FILTERED) {
+    return pub_forward_filtered_trajectory_->get_subscription_count() > 0 ||
+           pub_backward_filtered_trajectory_->get_subscription_count() > 0 ||
+           pub_merged_filtered_trajectory_->get_subscription_count() > 0 ||
+           pub_closest_merged_velocity_->get_subscription_count() > 0;
+  }
+  return false;
+}
+
 void MotionVelocitySmootherNode::publishDebugTrajectories(
   const std::vector<TrajectoryPoints> & debug_trajectories) const
 {
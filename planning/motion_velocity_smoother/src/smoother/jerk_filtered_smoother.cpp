@@ -17,6 +17,7 @@
 #include "motion_velocity_smoother/trajectory_utils.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <algorithm>
 #include <chrono>
@@ -55,6 +56,16 @@ JerkFilteredSmoother::Param JerkFilteredSmoother::getParam() const
   return smoother_param_;
 }
 
+void JerkFilteredSmoother::setTravelDistance(const double travel_distance)
+{
+  travel_distance_ = travel_distance;
+}
+
+void JerkFilteredSmoother::setDebugTrajectoriesEnabled(const bool enabled)
+{
+  enable_debug_trajectories_ = enabled;
+}
+
 bool JerkFilteredSmoother::apply(
   const double v0, const double a0, const TrajectoryPoints & input, TrajectoryPoints & output,
   std::vector<TrajectoryPoints> & debug_trajectories)
@@ -70,6 +81,7 @@ bool JerkFilteredSmoother::apply(
     // No need to do optimization
     output.front().longitudinal_velocity_mps = v0;
     output.front().acceleration_mps2 = a0;
+    prev_solution_.clear();
     debug_trajectories.resize(3);
     debug_trajectories[0] = output;
     debug_trajectories[1] = output;
@@ -110,10 +122,13 @@ bool JerkFilteredSmoother::apply(
   auto opt_resampled_trajectory = resample(filtered);
 
   // Set debug trajectories
-  debug_trajectories.resize(3);
-  debug_trajectories[0] = resample(forward_filtered);
-  debug_trajectories[1] = resample(backward_filtered);
-  debug_trajectories[2] = resample(filtered);
+  debug_trajectories.clear();
+  if (enable_debug_trajectories_) {
+    debug_trajectories.resize(3);
+    debug_trajectories[0] = resample(forward_filtered);
+    debug_trajectories[1] = resample(backward_filtered);
+    debug_trajectories[2] = resample(filtered);
+  }
 
   // Ensure terminal velocity is zero
   opt_resampled_trajectory.back().longitudinal_velocity_mps = 0.0;
@@ -123,9 +138,12 @@ bool JerkFilteredSmoother::apply(
     // No need to do optimization
     output.front().longitudinal_velocity_mps = v0;
     output.front().acceleration_mps2 = a0;
-    debug_trajectories[0] = output;
-    debug_trajectories[1] = output;
-    debug_trajectories[2] = output;
+    prev_solution_.clear();
+    if (enable_debug_trajectories_) {
+      debug_trajectories[0] = output;
+      debug_trajectories[1] = output;
+      debug_trajectories[2] = output;
+    }
     return true;
   }
 
@@ -136,6 +154,7 @@ bool JerkFilteredSmoother::apply(
 
   if (!zero_vel_id) {
     RCLCPP_WARN(logger_, "opt_resampled_trajectory must have stop point.");
+    prev_solution_.clear();
     return false;
   }
 
@@ -175,14 +194,18 @@ bool JerkFilteredSmoother::apply(
   const uint32_t l_variables = 5 * N;
   const uint32_t l_constraints = 4 * N + 1;
 
-  // the matrix size depends on constraint numbers.
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(l_constraints, l_variables);
-
-  std::vector<double> lower_bound(l_constraints, 0.0);
-  std::vector<double> upper_bound(l_constraints, 0.0);
-
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(l_variables, l_variables);
-  std::vector<double> q(l_variables, 0.0);
+  // the sparsity pattern depends only on the number of the points, so that the workspace of the
+  // QP solver is reused and only the values are updated while the size is unchanged.
+  if (
+    P_.rows() != static_cast<Eigen::Index>(l_variables) ||
+    A_.rows() != static_cast<Eigen::Index>(l_constraints)) {
+    initializeProblemStructure(N);
+  }
+  P_.coeffs().setZero();
+  A_.coeffs().setZero();
+  std::fill(q_.begin(), q_.end(), 0.0);
+  std::fill(lower_bound_.begin(), lower_bound_.end(), 0.0);
+  std::fill(upper_bound_.begin(), upper_bound_.end(), 0.0);
 
   /**************************************************************/
   /**************************************************************/
@@ -191,15 +214,17 @@ bool JerkFilteredSmoother::apply(
   /**************************************************************/
 
   // jerk: d(ai)/ds * v_ref -> minimize weight * ((a1 - a0) / ds * v_ref)^2 * ds
+  // only the upper triangular part of P is set since P is symmetric
   const double smooth_weight = smoother_param_.jerk_weight;
   for (size_t i = 0; i < N - 1; ++i) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double interval_dist = std::max(interval_dist_arr.at(i), 0.0001);
     const double w_x_ds_inv = (1.0 / interval_dist) * ref_vel;
-    P(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i, IDX_A0 + i + 1) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i) -= smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
-    P(IDX_A0 + i + 1, IDX_A0 + i + 1) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_.coeffRef(IDX_A0 + i, IDX_A0 + i) += smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_.coeffRef(IDX_A0 + i, IDX_A0 + i + 1) -=
+      smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
+    P_.coeffRef(IDX_A0 + i + 1, IDX_A0 + i + 1) +=
+      smooth_weight * w_x_ds_inv * w_x_ds_inv * interval_dist;
   }
 
   // |v_max_i^2 - b_i|/v_max^2 -> minimize (-bi) * ds / v_max^2
@@ -210,11 +235,11 @@ bool JerkFilteredSmoother::apply(
       if (i < N - 1) {
         v_weight_term *= std::max(interval_dist_arr.at(i), 0.0001);
       }
-      q.at(IDX_B0 + i) += v_weight_term;
+      q_.at(IDX_B0 + i) += v_weight_term;
     }
-    P(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
-    P(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
-    P(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
+    P_.coeffRef(IDX_DELTA0 + i, IDX_DELTA0 + i) += over_v_weight;  // over velocity cost
+    P_.coeffRef(IDX_SIGMA0 + i, IDX_SIGMA0 + i) += over_a_weight;  // over acceleration cost
+    P_.coeffRef(IDX_GAMMA0 + i, IDX_GAMMA0 + i) += over_j_weight;  // over jerk cost
   }
 
   /**************************************************************/
@@ -235,25 +260,25 @@ bool JerkFilteredSmoother::apply(
 
   // Soft Constraint Velocity Limit: 0 < b - delta < v_max^2
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = 1.0;       // b_i
-    A(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
-    upper_bound[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
-    lower_bound[constr_idx] = 0.0;
+    A_.coeffRef(constr_idx, IDX_B0 + i) = 1.0;       // b_i
+    A_.coeffRef(constr_idx, IDX_DELTA0 + i) = -1.0;  // -delta_i
+    upper_bound_[constr_idx] = v_max_arr.at(i) * v_max_arr.at(i);
+    lower_bound_[constr_idx] = 0.0;
   }
 
   // Soft Constraint Acceleration Limit: a_min < a - sigma < a_max
   for (size_t i = 0; i < N; ++i, ++constr_idx) {
-    A(constr_idx, IDX_A0 + i) = 1.0;       // a_i
-    A(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
+    A_.coeffRef(constr_idx, IDX_A0 + i) = 1.0;       // a_i
+    A_.coeffRef(constr_idx, IDX_SIGMA0 + i) = -1.0;  // -sigma_i
 
     constexpr double stop_vel = 1e-3;
     if (v_max_arr.at(i) < stop_vel) {
       // Stop Point
-      upper_bound[constr_idx] = a_stop_decel;
-      lower_bound[constr_idx] = a_stop_decel;
+      upper_bound_[constr_idx] = a_stop_decel;
+      lower_bound_[constr_idx] = a_stop_decel;
     } else {
-      upper_bound[constr_idx] = a_max;
-      lower_bound[constr_idx] = a_min;
+      upper_bound_[constr_idx] = a_max;
+      lower_bound_[constr_idx] = a_min;
     }
   }
 
@@ -262,49 +287,68 @@ bool JerkFilteredSmoother::apply(
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
     const double ref_vel = 0.5 * (v_max_arr.at(i) + v_max_arr.at(i + 1));
     const double ds = interval_dist_arr.at(i);
-    A(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
-    A(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
-    A(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
-    upper_bound[constr_idx] = j_max * ds;     //  jerk_max * ds
-    lower_bound[constr_idx] = j_min * ds;     //  jerk_min * ds
+    A_.coeffRef(constr_idx, IDX_A0 + i) = -ref_vel;     // -a[i] * ref_vel
+    A_.coeffRef(constr_idx, IDX_A0 + i + 1) = ref_vel;  //  a[i+1] * ref_vel
+    A_.coeffRef(constr_idx, IDX_GAMMA0 + i) = -ds;      // -gamma[i] * ds
+    upper_bound_[constr_idx] = j_max * ds;              //  jerk_max * ds
+    lower_bound_[constr_idx] = j_min * ds;              //  jerk_min * ds
   }
 
   // b' = 2a ... (b(i+1) - b(i)) / ds = 2a(i)
   for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
-    A(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
-    A(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
-    A(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
-    upper_bound[constr_idx] = 0.0;
-    lower_bound[constr_idx] = 0.0;
+    A_.coeffRef(constr_idx, IDX_B0 + i) = -1.0;                            // b(i)
+    A_.coeffRef(constr_idx, IDX_B0 + i + 1) = 1.0;                         // b(i+1)
+    A_.coeffRef(constr_idx, IDX_A0 + i) = -2.0 * interval_dist_arr.at(i);  // a(i) * ds
+    upper_bound_[constr_idx] = 0.0;
+    lower_bound_[constr_idx] = 0.0;
   }
 
   // initial condition
   {
-    A(constr_idx, IDX_B0) = 1.0;  // b0
-    upper_bound[constr_idx] = v0 * v0;
-    lower_bound[constr_idx] = v0 * v0;
+    A_.coeffRef(constr_idx, IDX_B0) = 1.0;  // b0
+    upper_bound_[constr_idx] = v0 * v0;
+    lower_bound_[constr_idx] = v0 * v0;
     ++constr_idx;
 
-    A(constr_idx, IDX_A0) = 1.0;  // a0
-    upper_bound[constr_idx] = a0;
-    lower_bound[constr_idx] = a0;
+    A_.coeffRef(constr_idx, IDX_A0) = 1.0;  // a0
+    upper_bound_[constr_idx] = a0;
+    lower_bound_[constr_idx] = a0;
     ++constr_idx;
   }
 
+  // arc length of the optimized points from the first point
+  std::vector<double> arclength(N, 0.0);
+  for (size_t i = 1; i < N; ++i) {
+    arclength.at(i) = arclength.at(i - 1) + interval_dist_arr.at(i - 1);
+  }
+
   // execute optimization
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  if (prev_solution_.empty()) {
+    qp_solver_.initializeProblem(
+      autoware::common::osqp::calCSCMatrixTrapezoidal(P_), autoware::common::osqp::calCSCMatrix(A_),
+      q_, lower_bound_, upper_bound_);
+  } else {
+    // warm start from the previous solution shifted by the distance ego traveled
+    qp_solver_.setProblem(P_, A_, q_, lower_bound_, upper_bound_);
+    qp_solver_.setPrimalVariables(calcWarmStartSolution(arclength));
+  }
+  const auto result = qp_solver_.optimize();
   const std::vector<double> optval = std::get<0>(result);
   const int status_val = std::get<3>(result);
   if (status_val != 1) {
     RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
+    prev_solution_.clear();
     return false;
   }
   const auto has_nan =
     std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
   if (has_nan) {
     RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+    prev_solution_.clear();
     return false;
   }
+  prev_solution_ = optval;
+  prev_arclength_ = arclength;
 
   const auto tf1 = std::chrono::system_clock::now();
   const double dt_ms1 =
@@ -352,6 +396,94 @@ bool JerkFilteredSmoother::apply(
   return true;
 }
 
+void JerkFilteredSmoother::initializeProblemStructure(const size_t N)
+{
+  const size_t IDX_B0 = 0;
+  const size_t IDX_A0 = N;
+  const size_t IDX_DELTA0 = 2 * N;
+  const size_t IDX_SIGMA0 = 3 * N;
+  const size_t IDX_GAMMA0 = 4 * N;
+
+  const size_t l_variables = 5 * N;
+  const size_t l_constraints = 4 * N + 1;
+
+  // the elements which can be non-zero in apply(). The values are kept even if they are zero so
+  // that the sparsity pattern does not change.
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(5 * N + N - 1);
+  for (size_t i = 0; i < N; ++i) {
+    P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i, 0.0);
+    if (i + 1 < N) {
+      P_triplets.emplace_back(IDX_A0 + i, IDX_A0 + i + 1, 0.0);
+    }
+    P_triplets.emplace_back(IDX_DELTA0 + i, IDX_DELTA0 + i, 0.0);
+    P_triplets.emplace_back(IDX_SIGMA0 + i, IDX_SIGMA0 + i, 0.0);
+    P_triplets.emplace_back(IDX_GAMMA0 + i, IDX_GAMMA0 + i, 0.0);
+  }
+
+  std::vector<Eigen::Triplet<double>> A_triplets;
+  A_triplets.reserve(4 * N + 6 * (N - 1) + 2);
+  size_t constr_idx = 0;
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_DELTA0 + i, 0.0);
+  }
+  for (size_t i = 0; i < N; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_SIGMA0 + i, 0.0);
+  }
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i + 1, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_GAMMA0 + i, 0.0);
+  }
+  for (size_t i = 0; i < N - 1; ++i, ++constr_idx) {
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_B0 + i + 1, 0.0);
+    A_triplets.emplace_back(constr_idx, IDX_A0 + i, 0.0);
+  }
+  A_triplets.emplace_back(constr_idx++, IDX_B0, 0.0);
+  A_triplets.emplace_back(constr_idx++, IDX_A0, 0.0);
+
+  P_.resize(l_variables, l_variables);
+  P_.setFromTriplets(P_triplets.begin(), P_triplets.end());
+  A_.resize(l_constraints, l_variables);
+  A_.setFromTriplets(A_triplets.begin(), A_triplets.end());
+  q_.resize(l_variables);
+  lower_bound_.resize(l_constraints);
+  upper_bound_.resize(l_constraints);
+}
+
+std::vector<double> JerkFilteredSmoother::calcWarmStartSolution(
+  const std::vector<double> & arclength) const
+{
+  const size_t N = arclength.size();
+  const size_t prev_N = prev_arclength_.size();
+  std::vector<double> solution(5 * N, 0.0);
+  if (prev_N < 2 || prev_solution_.size() != 5 * prev_N) {
+    return solution;
+  }
+
+  // linear interpolation of each block of the variables [b, a, delta, sigma, gamma], clamped at
+  // the both ends of the previous points
+  size_t prev_idx = 0;
+  for (size_t i = 0; i < N; ++i) {
+    const double s = arclength.at(i) + travel_distance_;
+    while (prev_idx + 2 < prev_N && prev_arclength_.at(prev_idx + 1) < s) {
+      ++prev_idx;
+    }
+    const double prev_s0 = prev_arclength_.at(prev_idx);
+    const double prev_s1 = prev_arclength_.at(prev_idx + 1);
+    const double ratio = std::clamp((s - prev_s0) / std::max(prev_s1 - prev_s0, 1e-6), 0.0, 1.0);
+    for (size_t block = 0; block < 5; ++block) {
+      const double prev_x0 = prev_solution_.at(block * prev_N + prev_idx);
+      const double prev_x1 = prev_solution_.at(block * prev_N + prev_idx + 1);
+      solution.at(block * N + i) = prev_x0 + ratio * (prev_x1 - prev_x0);
+    }
+  }
+  return solution;
+}
+
 TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
   const double v0, const double a0, const double a_max, const double a_start, const double j_max,
   const TrajectoryPoints & input) const
@@ -127,19 +127,34 @@ private:
     Eigen::SparseMatrix<double> R;
   };
 
+  // NOTE: The hessian stores only the upper triangular part.
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
   };
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
   };
 
+  // NOTE: The sparsity patterns of the objective and constraint matrices depend only on these.
+  struct MatrixPatternKey
+  {
+    size_t num_points{0};
+    size_t num_vehicle_circles{0};
+    std::vector<size_t> fixed_points_indices{};
+    bool soft_constraint{false};
+    bool hard_constraint{false};
+    bool l_inf_norm{false};
+    bool steer_limit_constraint{false};
+
+    bool operator==(const MatrixPatternKey & other) const;
+  };
+
   struct MPTParam
   {
     explicit MPTParam(rclcpp::Node * node, const vehicle_info_util::VehicleInfo & vehicle_info);
@@ -234,9 +249,13 @@ private:
   std::vector<double> vehicle_circle_longitudinal_offsets_;  // from base_link
   std::vector<double> vehicle_circle_radiuses_;
 
+  // objective and constraint matrices whose sparsity patterns are kept across cycles
+  ObjectiveMatrix obj_mat_;
+  ConstraintMatrix const_mat_;
+  std::optional<MatrixPatternKey> obj_mat_pattern_key_{std::nullopt};
+  std::optional<MatrixPatternKey> const_mat_pattern_key_{std::nullopt};
+
   // previous data
-  int prev_mat_n_ = 0;
-  int prev_mat_m_ = 0;
   int prev_solution_status_ = 0;
   std::shared_ptr<std::vector<ReferencePoint>> prev_ref_points_ptr_{nullptr};
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_optimized_traj_points_ptr_{nullptr};
@@ -273,13 +292,15 @@ private:
     const std::vector<ReferencePoint> & reference_points,
     const std::vector<TrajectoryPoint> & traj_points) const;
 
-  ObjectiveMatrix calcObjectiveMatrix(
+  MatrixPatternKey calcMatrixPatternKey(const std::vector<ReferencePoint> & ref_points) const;
+
+  const ObjectiveMatrix & calcObjectiveMatrix(
     const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & obj_mat,
-    const std::vector<ReferencePoint> & ref_points) const;
+    const std::vector<ReferencePoint> & ref_points);
 
-  ConstraintMatrix calcConstraintMatrix(
+  const ConstraintMatrix & calcConstraintMatrix(
     const StateEquationGenerator::Matrix & mpt_mat,
-    const std::vector<ReferencePoint> & ref_points) const;
+    const std::vector<ReferencePoint> & ref_points);
 
   std::optional<Eigen::VectorXd> calcOptimizedSteerAngles(
     const std::vector<ReferencePoint> & ref_points, const ObjectiveMatrix & obj_mat,
@@ -287,9 +308,10 @@ private:
   Eigen::VectorXd calcInitialSolutionForManualWarmStart(
     const std::vector<ReferencePoint> & ref_points,
     const std::vector<ReferencePoint> & prev_ref_points) const;
-  std::pair<ObjectiveMatrix, ConstraintMatrix> updateMatrixForManualWarmStart(
-    const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat,
-    const std::optional<Eigen::VectorXd> & u0) const;
+  void updateMatrixForManualWarmStart(
+    const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat, const Eigen::VectorXd & u0,
+    Eigen::VectorXd & gradient, Eigen::VectorXd & lower_bound,
+    Eigen::VectorXd & upper_bound) const;
 
   void addSteerWeightR(
     std::vector<Eigen::Triplet<double>> & R_triplet_vec,
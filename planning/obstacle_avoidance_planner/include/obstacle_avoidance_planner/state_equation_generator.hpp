@@ -19,6 +19,9 @@
 #include "obstacle_avoidance_planner/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
 #include "obstacle_avoidance_planner/vehicle_model/vehicle_model_interface.hpp"
 
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
 #include <memory>
 #include <vector>
 
@@ -29,10 +32,12 @@ struct ReferencePoint;
 class StateEquationGenerator
 {
 public:
+  // NOTE: A and B store all the elements of their one-step blocks even if they are zero, so that
+  //       their sparsity patterns depend only on the number of points.
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
@@ -122,6 +122,25 @@ std::vector<double> toStdVector(const Eigen::VectorXd & eigen_vec)
   return {eigen_vec.data(), eigen_vec.data() + eigen_vec.rows()};
 }
 
+// NOTE: When the pattern is kept, the triplets only update the values of the existing elements
+//       without any allocation. Duplicated triplets are summed up in both cases.
+void assembleSparseMatrix(
+  const size_t rows, const size_t cols, const std::vector<Eigen::Triplet<double>> & triplet_vec,
+  const bool keep_pattern, Eigen::SparseMatrix<double> & mat)
+{
+  if (keep_pattern) {
+    mat.coeffs().setZero();
+    for (const auto & triplet : triplet_vec) {
+      mat.coeffRef(triplet.row(), triplet.col()) += triplet.value();
+    }
+    mat.makeCompressed();
+    return;
+  }
+
+  mat.resize(rows, cols);
+  mat.setFromTriplets(triplet_vec.begin(), triplet_vec.end());
+}
+
 bool isLeft(const geometry_msgs::msg::Pose & pose, const geometry_msgs::msg::Point & target_pos)
 {
   const double base_theta = tf2::getYaw(pose.orientation);
@@ -168,6 +187,14 @@ double calcLateralDistToBounds(
 }
 }  // namespace
 
+bool MPTOptimizer::MatrixPatternKey::operator==(const MatrixPatternKey & other) const
+{
+  return num_points == other.num_points && num_vehicle_circles == other.num_vehicle_circles &&
+         fixed_points_indices == other.fixed_points_indices &&
+         soft_constraint == other.soft_constraint && hard_constraint == other.hard_constraint &&
+         l_inf_norm == other.l_inf_norm && steer_limit_constraint == other.steer_limit_constraint;
+}
+
 MPTOptimizer::MPTParam::MPTParam(
   rclcpp::Node * node, const vehicle_info_util::VehicleInfo & vehicle_info)
 {
@@ -497,10 +524,10 @@ std::vector<TrajectoryPoint> MPTOptimizer::optimizeTrajectory(const PlannerData
   const auto val_mat = calcValueMatrix(ref_points, traj_points);
 
   // 4. get objective matrix
-  const auto obj_mat = calcObjectiveMatrix(mpt_mat, val_mat, ref_points);
+  const auto & obj_mat = calcObjectiveMatrix(mpt_mat, val_mat, ref_points);
 
   // 5. get constraints matrix
-  const auto const_mat = calcConstraintMatrix(mpt_mat, ref_points);
+  const auto & const_mat = calcConstraintMatrix(mpt_mat, ref_points);
 
   // 6. optimize steer angles
   const auto optimized_variables = calcOptimizedSteerAngles(ref_points, obj_mat, const_mat);
@@ -579,14 +606,14 @@ std::vector<ReferencePoint> MPTOptimizer::calcReferencePoints(
   ref_points = motion_utils::cropPoints(
     ref_points, p.ego_pose.position, ego_seg_idx, forward_traj_length + tmp_margin,
     backward_traj_length);
-  ref_points_spline = SplineInterpolationPoints2d(ref_points);
+  ref_points_spline.calcSplineCoefficients(ref_points);
   ego_seg_idx = trajectory_utils::findEgoSegmentIndex(ref_points, p.ego_pose, ego_nearest_param_);
 
   // 5. update fixed points, and resample
   // NOTE: This must be after backward cropping.
   //       New start point may be added and resampled. Spline calculation is required.
   updateFixedPoint(ref_points);
-  ref_points_spline = SplineInterpolationPoints2d(ref_points);
+  ref_points_spline.calcSplineCoefficients(ref_points);
 
   // 6. update bounds
   // NOTE: After this, resample must not be called since bounds are not interpolated.
@@ -1103,6 +1130,17 @@ void MPTOptimizer::updateVehicleBounds(
 {
   time_keeper_ptr_->tic(__func__);
 
+  // interpolate the poses of each vehicle circle on all the reference points at once
+  std::vector<std::vector<geometry_msgs::msg::Pose>> collision_check_poses;
+  for (const double lon_offset : vehicle_circle_longitudinal_offsets_) {
+    std::vector<double> collision_check_s_vec(ref_points.size());
+    for (size_t p_idx = 0; p_idx < ref_points.size(); ++p_idx) {
+      collision_check_s_vec.at(p_idx) = ref_points_spline.getAccumulatedLength(p_idx) + lon_offset;
+    }
+    collision_check_poses.push_back(
+      ref_points_spline.getSplineInterpolatedPoses(collision_check_s_vec));
+  }
+
   for (size_t p_idx = 0; p_idx < ref_points.size(); ++p_idx) {
     const auto & ref_point = ref_points.at(p_idx);
     // NOTE: This clear is required.
@@ -1110,9 +1148,9 @@ void MPTOptimizer::updateVehicleBounds(
     ref_points.at(p_idx).bounds_on_constraints.clear();
     ref_points.at(p_idx).beta.clear();
 
-    for (const double lon_offset : vehicle_circle_longitudinal_offsets_) {
-      const auto collision_check_pose =
-        ref_points_spline.getSplineInterpolatedPose(p_idx, lon_offset);
+    for (size_t c_idx = 0; c_idx < vehicle_circle_longitudinal_offsets_.size(); ++c_idx) {
+      const double lon_offset = vehicle_circle_longitudinal_offsets_.at(c_idx);
+      const auto & collision_check_pose = collision_check_poses.at(c_idx).at(p_idx);
       const double collision_check_yaw = tf2::getYaw(collision_check_pose.orientation);
 
       // calculate beta
@@ -1229,9 +1267,27 @@ MPTOptimizer::ValueMatrix MPTOptimizer::calcValueMatrix(
   return ValueMatrix{Q_sparse_mat, R_sparse_mat};
 }
 
-MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
-  [[maybe_unused]] const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & val_mat,
+MPTOptimizer::MatrixPatternKey MPTOptimizer::calcMatrixPatternKey(
   const std::vector<ReferencePoint> & ref_points) const
+{
+  MatrixPatternKey key;
+  key.num_points = ref_points.size();
+  key.num_vehicle_circles = vehicle_circle_longitudinal_offsets_.size();
+  for (size_t i = 0; i < ref_points.size(); ++i) {
+    if (ref_points.at(i).fixed_kinematic_state) {
+      key.fixed_points_indices.push_back(i);
+    }
+  }
+  key.soft_constraint = mpt_param_.soft_constraint;
+  key.hard_constraint = mpt_param_.hard_constraint;
+  key.l_inf_norm = mpt_param_.l_inf_norm;
+  key.steer_limit_constraint = mpt_param_.steer_limit_constraint;
+  return key;
+}
+
+const MPTOptimizer::ObjectiveMatrix & MPTOptimizer::calcObjectiveMatrix(
+  [[maybe_unused]] const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & val_mat,
+  const std::vector<ReferencePoint> & ref_points)
 {
   time_keeper_ptr_->tic(__func__);
 
@@ -1266,33 +1322,48 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+  //       H = [T'QT | O | O
+  //              O  | R | O
+  //              O  | O | O], where only the upper triangular part is stored.
+  //       The sparse product keeps the explicit zeros, so the pattern is kept with the same key.
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
+
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  H_triplet_vec.reserve(H_x.nonZeros() + val_mat.R.nonZeros());
+  for (int k = 0; k < H_x.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(H_x, k); it; ++it) {
+      if (it.row() <= it.col()) {
+        H_triplet_vec.emplace_back(it.row(), it.col(), it.value());
+      }
+    }
+  }
+  for (int k = 0; k < val_mat.R.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(val_mat.R, k); it; ++it) {
+      if (it.row() <= it.col()) {
+        H_triplet_vec.emplace_back(N_x + it.row(), N_x + it.col(), it.value());
+      }
+    }
+  }
 
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  const auto pattern_key = calcMatrixPatternKey(ref_points);
+  const bool keep_pattern = obj_mat_pattern_key_ && *obj_mat_pattern_key_ == pattern_key;
+  assembleSparseMatrix(N_v, N_v, H_triplet_vec, keep_pattern, obj_mat_.hessian);
+  obj_mat_pattern_key_ = pattern_key;
 
-  Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
+  Eigen::VectorXd & g = obj_mat_.gradient;
+  g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
   g.segment(N_x + N_u, N_s) = mpt_param_.soft_collision_free_weight * Eigen::VectorXd::Ones(N_s);
 
-  ObjectiveMatrix obj_matrix;
-  obj_matrix.hessian = H;
-  obj_matrix.gradient = g;
-
   time_keeper_ptr_->toc(__func__, "        ");
-  return obj_matrix;
+  return obj_mat_;
 }
 
 // Constraint: lb <= A u <= ub
 // decision variable
 // u := [initial state, steer angles, soft variables]
-MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
-  const StateEquationGenerator::Matrix & mpt_mat,
-  const std::vector<ReferencePoint> & ref_points) const
+const MPTOptimizer::ConstraintMatrix & MPTOptimizer::calcConstraintMatrix(
+  const StateEquationGenerator::Matrix & mpt_mat, const std::vector<ReferencePoint> & ref_points)
 {
   time_keeper_ptr_->tic(__func__);
 
@@ -1312,12 +1383,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   const size_t N_collision_check = vehicle_circle_longitudinal_offsets_.size();
 
   // calculate indices of fixed points
-  std::vector<size_t> fixed_points_indices;
-  for (size_t i = 0; i < N_ref; ++i) {
-    if (ref_points.at(i).fixed_kinematic_state) {
-      fixed_points_indices.push_back(i);
-    }
-  }
+  const auto pattern_key = calcMatrixPatternKey(ref_points);
+  const auto & fixed_points_indices = pattern_key.fixed_points_indices;
 
   // calculate rows and cols of A
   size_t A_rows = 0;
@@ -1335,15 +1402,33 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
-  Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::common::osqp::INF);
-  Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::common::osqp::INF);
+  // NOTE: Every element is added even if its value is zero, so that the sparsity pattern of A
+  //       depends only on the pattern key.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
+  A_triplet_vec.reserve(
+    N_x + mpt_mat.A.nonZeros() + mpt_mat.B.nonZeros() + 8 * N_ref * N_collision_check +
+    fixed_points_indices.size() * D_x + N_u);
+  Eigen::VectorXd & lb = const_mat_.lower_bound;
+  Eigen::VectorXd & ub = const_mat_.upper_bound;
+  lb = Eigen::VectorXd::Constant(A_rows, -autoware::common::osqp::INF);
+  ub = Eigen::VectorXd::Constant(A_rows, autoware::common::osqp::INF);
   size_t A_rows_end = 0;
 
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  // A := [I - A_mat | -B_mat | O]
+  for (size_t i = 0; i < N_x; ++i) {
+    A_triplet_vec.emplace_back(i, i, 1.0);
+  }
+  for (int k = 0; k < mpt_mat.A.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mpt_mat.A, k); it; ++it) {
+      A_triplet_vec.emplace_back(it.row(), it.col(), -it.value());
+    }
+  }
+  for (int k = 0; k < mpt_mat.B.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(mpt_mat.B, k); it; ++it) {
+      A_triplet_vec.emplace_back(it.row(), N_x + it.col(), -it.value());
+    }
+  }
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1352,7 +1437,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // CX = C(Bv + w) + C \in R^{N_ref, N_ref * D_x}
   for (size_t l_idx = 0; l_idx < N_collision_check; ++l_idx) {
     // create C := [cos(beta) | l cos(beta)]
-    Eigen::SparseMatrix<double> C_sparse_mat(N_ref, N_x);
     std::vector<Eigen::Triplet<double>> C_triplet_vec;
     Eigen::VectorXd C_vec = Eigen::VectorXd::Zero(N_ref);
 
@@ -1365,7 +1449,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x + 1, lon_offset * std::cos(beta)));
       C_vec(i) = lon_offset * std::sin(beta);
     }
-    C_sparse_mat.setFromTriplets(C_triplet_vec.begin(), C_triplet_vec.end());
 
     // calculate bounds
     const double bounds_offset =
@@ -1379,26 +1462,26 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      for (const auto & C_triplet : C_triplet_vec) {
+        A_triplet_vec.emplace_back(
+          A_rows_end + C_triplet.row(), C_triplet.col(), C_triplet.value());
+        A_triplet_vec.emplace_back(
+          A_rows_end + N_ref + C_triplet.row(), C_triplet.col(), -C_triplet.value());
+      }
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      for (size_t i = 0; i < N_ref; ++i) {
+        A_triplet_vec.emplace_back(A_rows_end + i, local_A_offset_cols + i, 1.0);
+        A_triplet_vec.emplace_back(A_rows_end + N_ref + i, local_A_offset_cols + i, 1.0);
+        A_triplet_vec.emplace_back(A_rows_end + 2 * N_ref + i, local_A_offset_cols + i, 1.0);
+      }
 
       // lb := [lower_bound - C
       //        C - upper_bound
       //               O        ]
-      Eigen::VectorXd lb_blk = Eigen::VectorXd::Zero(A_blk_rows);
-      lb_blk.segment(0, N_ref) = -C_vec + part_lb;
-      lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
-
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
-      lb.segment(A_rows_end, A_blk_rows) = lb_blk;
+      lb.segment(A_rows_end, N_ref) = -C_vec + part_lb;
+      lb.segment(A_rows_end + N_ref, N_ref) = C_vec - part_ub;
+      lb.segment(A_rows_end + 2 * N_ref, N_ref) = Eigen::VectorXd::Zero(N_ref);
 
       A_rows_end += A_blk_rows;
     }
@@ -1407,10 +1490,12 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      // A := [C | O | ... ]
+      for (const auto & C_triplet : C_triplet_vec) {
+        A_triplet_vec.emplace_back(
+          A_rows_end + C_triplet.row(), C_triplet.col(), C_triplet.value());
+      }
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1421,7 +1506,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    for (size_t j = 0; j < D_x; ++j) {
+      A_triplet_vec.emplace_back(A_rows_end + j, D_x * i + j, 1.0);
+    }
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1431,7 +1518,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    for (size_t i = 0; i < N_u; ++i) {
+      A_triplet_vec.emplace_back(A_rows_end + i, N_x + i, 1.0);
+    }
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1448,8 +1537,12 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  const bool keep_pattern = const_mat_pattern_key_ && *const_mat_pattern_key_ == pattern_key;
+  assembleSparseMatrix(A_rows, N_v, A_triplet_vec, keep_pattern, const_mat_.linear);
+  const_mat_pattern_key_ = pattern_key;
+
   time_keeper_ptr_->toc(__func__, "        ");
-  return ConstraintMatrix{A, lb, ub};
+  return const_mat_;
 }
 
 void MPTOptimizer::addSteerWeightR(
@@ -1495,38 +1588,36 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     return std::nullopt;
   }();
 
-  // for manual start, update objective and constraint matrix
-  const auto [updated_obj_mat, updated_const_mat] =
-    updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
+  // for manual start, update gradient and bounds
+  Eigen::VectorXd gradient = obj_mat.gradient;
+  Eigen::VectorXd lower_bound_vec = const_mat.lower_bound;
+  Eigen::VectorXd upper_bound_vec = const_mat.upper_bound;
+  if (u0) {
+    updateMatrixForManualWarmStart(
+      obj_mat, const_mat, *u0, gradient, lower_bound_vec, upper_bound_vec);
+  }
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
-  const auto f = toStdVector(updated_obj_mat.gradient);
-  const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
-  const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
+  const auto & H = obj_mat.hessian;
+  const auto & A = const_mat.linear;
+  const auto f = toStdVector(gradient);
+  const auto upper_bound = toStdVector(upper_bound_vec);
+  const auto lower_bound = toStdVector(lower_bound_vec);
 
   // initialize or update solver according to warm start
+  // NOTE: While the sparsity patterns of H and A are kept, the solver only updates the values of
+  //       the workspace and starts from the previous solution.
   time_keeper_ptr_->tic("initOsqp");
 
-  const autoware::common::osqp::CSC_Matrix P_csc =
-    autoware::common::osqp::calCSCMatrixTrapezoidal(H);
-  const autoware::common::osqp::CSC_Matrix A_csc = autoware::common::osqp::calCSCMatrix(A);
-  if (
-    prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
-    osqp_solver_ptr_->updateCscP(P_csc);
-    osqp_solver_ptr_->updateQ(f);
-    osqp_solver_ptr_->updateCscA(A_csc);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+  if (prev_solution_status_ == 1 && mpt_param_.enable_warm_start) {
+    osqp_solver_ptr_->setProblem(H, A, f, lower_bound, upper_bound);
   } else {
-    RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "no warm start");
-    osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
-      P_csc, A_csc, f, lower_bound, upper_bound, osqp_epsilon_);
+    osqp_solver_ptr_->initializeProblem(
+      autoware::common::osqp::calCSCMatrixTrapezoidal(H),
+      autoware::common::osqp::calCSCMatrix(A), f, lower_bound, upper_bound);
   }
-  prev_mat_n_ = H.rows();
-  prev_mat_m_ = A.rows();
+  RCLCPP_INFO_EXPRESSION(
+    logger_, enable_debug_info_, osqp_solver_ptr_->isWorkReused() ? "warm start" : "no warm start");
 
   time_keeper_ptr_->toc("initOsqp", "          ");
 
@@ -1609,35 +1700,23 @@ Eigen::VectorXd MPTOptimizer::calcInitialSolutionForManualWarmStart(
   return u0;
 }
 
-std::pair<MPTOptimizer::ObjectiveMatrix, MPTOptimizer::ConstraintMatrix>
-MPTOptimizer::updateMatrixForManualWarmStart(
-  const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat,
-  const std::optional<Eigen::VectorXd> & u0) const
+void MPTOptimizer::updateMatrixForManualWarmStart(
+  const ObjectiveMatrix & obj_mat, const ConstraintMatrix & const_mat, const Eigen::VectorXd & u0,
+  Eigen::VectorXd & gradient, Eigen::VectorXd & lower_bound, Eigen::VectorXd & upper_bound) const
 {
-  if (!u0) {
-    // not manual warm start
-    return {obj_mat, const_mat};
-  }
-
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
-
-  auto updated_obj_mat = obj_mat;
-  auto updated_const_mat = const_mat;
-
-  Eigen::VectorXd & f = updated_obj_mat.gradient;
-  Eigen::VectorXd & ub = updated_const_mat.upper_bound;
-  Eigen::VectorXd & lb = updated_const_mat.lower_bound;
+  time_keeper_ptr_->tic(__func__);
 
+  // NOTE: Only the gradient and bounds are updated so that the sparsity patterns of the hessian
+  //       and linear constraint matrix are kept.
   // update gradient
-  f += H * *u0;
+  gradient += obj_mat.hessian.selfadjointView<Eigen::Upper>() * u0;
 
   // update upper_bound and lower_bound
-  const Eigen::VectorXd A_times_u0 = A * *u0;
-  ub -= A_times_u0;
-  lb -= A_times_u0;
+  const Eigen::VectorXd A_times_u0 = const_mat.linear * u0;
+  upper_bound -= A_times_u0;
+  lower_bound -= A_times_u0;
 
-  return {updated_obj_mat, updated_const_mat};
+  time_keeper_ptr_->toc(__func__, "          ");
 }
 
 std::optional<std::vector<TrajectoryPoint>> MPTOptimizer::calcMPTPoints(
@@ -18,6 +18,7 @@
 #include "obstacle_cruise_planner/common_structs.hpp"
 #include "obstacle_cruise_planner/optimization_based_planner/optimization_based_planner.hpp"
 #include "obstacle_cruise_planner/pid_based_planner/pid_based_planner.hpp"
+#include "obstacle_cruise_planner/polygon_utils.hpp"
 #include "obstacle_cruise_planner/type_alias.hpp"
 #include "signal_processing/lowpass_filter_1d.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
@@ -60,7 +61,9 @@ private:
   std::vector<TrajectoryPoint> decimateTrajectoryPoints(
     const std::vector<TrajectoryPoint> & traj_points) const;
   std::optional<StopObstacle> createStopObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
+    const std::vector<TrajectoryPoint> & traj_points,
+    const polygon_utils::TrajectoryPolygons & traj_polys,
+    const polygon_utils::TrajectoryPolygons & traj_polys_with_lat_margin,
     const Obstacle & obstacle, const double precise_lateral_dist) const;
   bool isStopObstacle(const uint8_t label) const;
   bool isInsideCruiseObstacle(const uint8_t label) const;
@@ -75,22 +78,24 @@ private:
   std::optional<std::vector<CruiseObstacle>> findYieldCruiseObstacles(
     const std::vector<Obstacle> & obstacles, const std::vector<TrajectoryPoint> & traj_points);
   std::optional<CruiseObstacle> createCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle, const double precise_lat_dist);
+    const std::vector<TrajectoryPoint> & traj_points,
+    const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle,
+    const double precise_lat_dist);
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForInsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle) const;
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForOutsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle) const;
   bool isObstacleCrossing(
     const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle) const;
   double calcCollisionTimeMargin(
     const std::vector<PointWithStamp> & collision_points,
     const std::vector<TrajectoryPoint> & traj_points, const bool is_driving_forward) const;
   std::optional<SlowDownObstacle> createSlowDownObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle,
-    const double precise_lat_dist);
+    const std::vector<TrajectoryPoint> & traj_points,
+    const polygon_utils::TrajectoryPolygons & traj_polys_with_lat_margin,
+    const Obstacle & obstacle, const double precise_lat_dist);
   PlannerData createPlannerData(const std::vector<TrajectoryPoint> & traj_points) const;
 
   void checkConsistency(
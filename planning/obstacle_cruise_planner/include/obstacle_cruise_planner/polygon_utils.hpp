@@ -21,6 +21,7 @@
 #include "vehicle_info_util/vehicle_info_util.hpp"
 
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <limits>
 #include <optional>
@@ -30,21 +31,46 @@
 namespace polygon_utils
 {
 namespace bg = boost::geometry;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
+// bounding box of the polygon and its index
+using PolygonRtree = bg::index::rtree<std::pair<Box2d, size_t>, bg::index::rstar<16>>;
+
+// Polygons along the trajectory with the bounding box hierarchy over them. It is used as the
+// broadphase of the collision check so that the precise polygon calculation runs only against the
+// polygons whose bounding boxes overlap with the obstacle's one.
+struct TrajectoryPolygons
+{
+  TrajectoryPolygons() = default;
+  explicit TrajectoryPolygons(std::vector<Polygon2d> arg_polygons);
+
+  std::vector<Polygon2d> polygons;
+  std::vector<Box2d> boxes;
+  PolygonRtree rtree;
+};
 
 Polygon2d createOneStepPolygon(
   const std::vector<geometry_msgs::msg::Pose> & last_poses,
   const std::vector<geometry_msgs::msg::Pose> & current_poses,
   const vehicle_info_util::VehicleInfo & vehicle_info, const double lat_margin);
 
+// NOTE: The result is the same as the minimum distance to all the polygons, but the polygons whose
+// bounding boxes are farther than the minimum distance found so far are skipped.
+double calcMinDistance(const TrajectoryPolygons & traj_polygons, const Polygon2d & polygon);
+
+// NOTE: This is the broadphase which compares only the bounding boxes, so it may be true even when
+// the polygons are farther than the distance, but it is never false when they are within it.
+bool isWithinDistance(
+  const TrajectoryPolygons & traj_polygons, const Polygon2d & polygon, const double distance);
+
 std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points, const TrajectoryPolygons & traj_polygons,
   const Obstacle & obstacle, const bool is_driving_forward,
   const vehicle_info_util::VehicleInfo & vehicle_info);
 
 std::vector<PointWithStamp> getCollisionPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points, const TrajectoryPolygons & traj_polygons,
   const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
   const rclcpp::Time & current_time, const bool is_driving_forward,
   std::vector<size_t> & collision_index,
@@ -610,6 +610,8 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
   const auto obj_stamp = rclcpp::Time(objects_ptr_->header.stamp);
   const auto & p = behavior_determination_param_;
 
+  const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, ego_odom_ptr_->pose.pose);
+
   std::vector<Obstacle> target_obstacles;
   for (const auto & predicted_object : objects_ptr_->objects) {
     const auto & object_id =
@@ -629,7 +631,6 @@ std::vector<Obstacle> ObstacleCruisePlannerNode::convertToObstacles(
     }
 
     // 2. Check if the obstacle is in front of the ego.
-    const size_t ego_idx = ego_nearest_param_.findIndex(traj_points, ego_odom_ptr_->pose.pose);
     const auto ego_to_obstacle_distance =
       calcDistanceToFrontVehicle(traj_points, ego_idx, current_obstacle_pose.pose.position);
     if (!ego_to_obstacle_distance) {
@@ -722,11 +723,42 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
 {
   stop_watch_.tic(__func__);
 
+  const auto & p = behavior_determination_param_;
+
   // calculated decimated trajectory points and trajectory polygon
   const auto decimated_traj_points = decimateTrajectoryPoints(traj_points);
-  const auto decimated_traj_polys =
-    createOneStepPolygons(decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose);
-  debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  const polygon_utils::TrajectoryPolygons decimated_traj_polys(
+    createOneStepPolygons(decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose));
+  debug_data_ptr_->detection_polygons = decimated_traj_polys.polygons;
+
+  // trajectory polygons with lateral margins for the stop and slow down obstacles, which are common
+  // among the obstacles
+  // NOTE: For additional margin of slow down, hysteresis is not divided by two.
+  polygon_utils::TrajectoryPolygons decimated_traj_polys_for_stop;
+  polygon_utils::TrajectoryPolygons decimated_traj_polys_for_slow_down;
+  if (!obstacles.empty()) {
+    decimated_traj_polys_for_stop = polygon_utils::TrajectoryPolygons(createOneStepPolygons(
+      decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose, p.max_lat_margin_for_stop));
+    decimated_traj_polys_for_slow_down = polygon_utils::TrajectoryPolygons(createOneStepPolygons(
+      decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose,
+      p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down));
+  }
+
+  // count the obstacles which pass the broadphase, i.e. whose bounding boxes are within the
+  // lateral margin from the ones of the trajectory polygons
+  if (enable_debug_info_) {
+    const double max_lat_margin = std::max(
+      {p.max_lat_margin_for_stop, p.max_lat_margin_for_cruise,
+       p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down / 2.0});
+    const auto num_broadphase_obstacles =
+      std::count_if(obstacles.begin(), obstacles.end(), [&](const auto & obstacle) {
+        return polygon_utils::isWithinDistance(
+          decimated_traj_polys, obstacle.toPolygon(), max_lat_margin);
+      });
+    RCLCPP_INFO(
+      get_logger(), "%ld of %lu obstacles passed the broadphase.", num_broadphase_obstacles,
+      obstacles.size());
+  }
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
@@ -737,11 +769,8 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
     const auto obstacle_poly = obstacle.toPolygon();
 
     // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+    const double precise_lat_dist =
+      polygon_utils::calcMinDistance(decimated_traj_polys, obstacle_poly);
 
     // Filter obstacles for cruise, stop and slow down
     const auto cruise_obstacle =
@@ -750,20 +779,20 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
       cruise_obstacles.push_back(*cruise_obstacle);
       continue;
     }
-    const auto stop_obstacle =
-      createStopObstacle(decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+    const auto stop_obstacle = createStopObstacle(
+      decimated_traj_points, decimated_traj_polys, decimated_traj_polys_for_stop, obstacle,
+      precise_lat_dist);
     if (stop_obstacle) {
       stop_obstacles.push_back(*stop_obstacle);
       continue;
     }
-    const auto slow_down_obstacle =
-      createSlowDownObstacle(decimated_traj_points, obstacle, precise_lat_dist);
+    const auto slow_down_obstacle = createSlowDownObstacle(
+      decimated_traj_points, decimated_traj_polys_for_slow_down, obstacle, precise_lat_dist);
     if (slow_down_obstacle) {
       slow_down_obstacles.push_back(*slow_down_obstacle);
       continue;
     }
   }
-  const auto & p = behavior_determination_param_;
   if (p.enable_yield) {
     const auto yield_obstacles = findYieldCruiseObstacles(obstacles, decimated_traj_points);
     if (yield_obstacles) {
@@ -825,8 +854,9 @@ std::vector<TrajectoryPoint> ObstacleCruisePlannerNode::decimateTrajectoryPoints
 }
 
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle, const double precise_lat_dist)
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle,
+  const double precise_lat_dist)
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
   const auto & p = behavior_determination_param_;
@@ -1001,8 +1031,8 @@ std::optional<std::vector<CruiseObstacle>> ObstacleCruisePlannerNode::findYieldC
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle) const
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
   const auto & p = behavior_determination_param_;
@@ -1053,8 +1083,8 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polys, const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1124,8 +1154,10 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
 }
 
 std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle, const double precise_lat_dist) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polys,
+  const polygon_utils::TrajectoryPolygons & traj_polys_with_lat_margin, const Obstacle & obstacle,
+  const double precise_lat_dist) const
 {
   const auto & p = behavior_determination_param_;
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1188,9 +1220,6 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
   }
 
   // calculate collision points with trajectory with lateral stop margin
-  const auto traj_polys_with_lat_margin = createOneStepPolygons(
-    traj_points, vehicle_info_, ego_odom_ptr_->pose.pose, p.max_lat_margin_for_stop);
-
   const auto collision_point = polygon_utils::getCollisionPoint(
     traj_points, traj_polys_with_lat_margin, obstacle, is_driving_forward_, vehicle_info_);
   if (!collision_point) {
@@ -1204,7 +1233,8 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
 }
 
 std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polys_with_lat_margin, const Obstacle & obstacle,
   const double precise_lat_dist)
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1255,20 +1285,21 @@ std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacl
   }
 
   const auto obstacle_poly = obstacle.toPolygon();
+  polygon_utils::Box2d obstacle_box;
+  bg::envelope(obstacle_poly, obstacle_box);
 
   // calculate collision points with trajectory with lateral stop margin
-  // NOTE: For additional margin, hysteresis is not divided by two.
-  const auto traj_polys_with_lat_margin = createOneStepPolygons(
-    traj_points, vehicle_info_, ego_odom_ptr_->pose.pose,
-    p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down);
-
   std::vector<Polygon2d> front_collision_polygons;
   size_t front_seg_idx = 0;
   std::vector<Polygon2d> back_collision_polygons;
   size_t back_seg_idx = 0;
-  for (size_t i = 0; i < traj_polys_with_lat_margin.size(); ++i) {
+  for (size_t i = 0; i < traj_polys_with_lat_margin.polygons.size(); ++i) {
+    // NOTE: the polygons do not collide unless their bounding boxes overlap
     std::vector<Polygon2d> collision_polygons;
-    bg::intersection(traj_polys_with_lat_margin.at(i), obstacle_poly, collision_polygons);
+    if (bg::intersects(traj_polys_with_lat_margin.boxes.at(i), obstacle_box)) {
+      bg::intersection(
+        traj_polys_with_lat_margin.polygons.at(i), obstacle_poly, collision_polygons);
+    }
 
     if (!collision_polygons.empty()) {
       if (front_collision_polygons.empty()) {
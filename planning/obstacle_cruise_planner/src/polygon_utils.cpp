@@ -18,6 +18,11 @@
 #include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
 namespace
 {
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
@@ -56,15 +61,36 @@ PointWithStamp calcNearestCollisionPoint(
   return collision_points.at(min_idx);
 }
 
+Box2d calcBox(const Polygon2d & polygon)
+{
+  Box2d box;
+  bg::envelope(polygon, box);
+  return box;
+}
+
+// indices of the trajectory polygons whose bounding boxes overlap with the box in ascending order
+std::vector<size_t> queryOverlappedIndices(
+  const polygon_utils::TrajectoryPolygons & traj_polygons, const Box2d & box)
+{
+  std::vector<size_t> indices;
+  for (auto itr = traj_polygons.rtree.qbegin(bg::index::intersects(box));
+       itr != traj_polygons.rtree.qend(); ++itr) {
+    indices.push_back(itr->second);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
 // NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
 // calculation.
 std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const polygon_utils::TrajectoryPolygons & traj_polygons, const Polygon2d & obj_polygon,
   const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
-  const Shape & object_shape, const double max_lat_dist = std::numeric_limits<double>::max())
+  const double max_lat_dist = std::numeric_limits<double>::max())
 {
-  const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
-  for (size_t i = 0; i < traj_polygons.size(); ++i) {
+  // broadphase: the polygons do not collide unless their bounding boxes overlap
+  for (const size_t i : queryOverlappedIndices(traj_polygons, calcBox(obj_polygon))) {
     const double approximated_dist =
       tier4_autoware_utils::calcDistance2d(traj_points.at(i).pose, object_pose);
     if (approximated_dist > max_lat_dist) {
@@ -72,7 +98,7 @@ std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
     }
 
     std::vector<Polygon2d> collision_polygons;
-    boost::geometry::intersection(traj_polygons.at(i), obj_polygon, collision_polygons);
+    boost::geometry::intersection(traj_polygons.polygons.at(i), obj_polygon, collision_polygons);
 
     std::vector<PointWithStamp> collision_geom_points;
     bool has_collision = false;
@@ -104,6 +130,51 @@ std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
 
 namespace polygon_utils
 {
+TrajectoryPolygons::TrajectoryPolygons(std::vector<Polygon2d> arg_polygons)
+: polygons(std::move(arg_polygons))
+{
+  boxes.reserve(polygons.size());
+  std::vector<std::pair<Box2d, size_t>> indexed_boxes;
+  indexed_boxes.reserve(polygons.size());
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    boxes.push_back(calcBox(polygons.at(i)));
+    indexed_boxes.emplace_back(boxes.back(), i);
+  }
+  rtree = PolygonRtree(indexed_boxes);
+}
+
+double calcMinDistance(const TrajectoryPolygons & traj_polygons, const Polygon2d & polygon)
+{
+  double min_dist = std::numeric_limits<double>::max();
+  if (traj_polygons.polygons.empty()) {
+    return min_dist;
+  }
+
+  // visit the polygons in ascending order of the distance between the bounding boxes, which is the
+  // lower bound of the distance between the polygons
+  const auto box = calcBox(polygon);
+  const auto num_polygons = static_cast<unsigned int>(traj_polygons.polygons.size());
+  for (auto itr = traj_polygons.rtree.qbegin(bg::index::nearest(box, num_polygons));
+       itr != traj_polygons.rtree.qend(); ++itr) {
+    if (min_dist <= bg::distance(itr->first, box)) {
+      break;
+    }
+    min_dist = std::min(min_dist, bg::distance(traj_polygons.polygons.at(itr->second), polygon));
+  }
+  return min_dist;
+}
+
+bool isWithinDistance(
+  const TrajectoryPolygons & traj_polygons, const Polygon2d & polygon, const double distance)
+{
+  auto box = calcBox(polygon);
+  box.min_corner().x() -= distance;
+  box.min_corner().y() -= distance;
+  box.max_corner().x() += distance;
+  box.max_corner().y() += distance;
+  return traj_polygons.rtree.qbegin(bg::index::intersects(box)) != traj_polygons.rtree.qend();
+}
+
 Polygon2d createOneStepPolygon(
   const std::vector<geometry_msgs::msg::Pose> & last_poses,
   const std::vector<geometry_msgs::msg::Pose> & current_poses,
@@ -137,12 +208,12 @@ Polygon2d createOneStepPolygon(
 }
 
 std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points, const TrajectoryPolygons & traj_polygons,
   const Obstacle & obstacle, const bool is_driving_forward,
   const vehicle_info_util::VehicleInfo & vehicle_info)
 {
-  const auto collision_info =
-    getCollisionIndex(traj_points, traj_polygons, obstacle.pose, obstacle.stamp, obstacle.shape);
+  const auto collision_info = getCollisionIndex(
+    traj_points, traj_polygons, obstacle.toPolygon(), obstacle.pose, obstacle.stamp);
   if (!collision_info) {
     return std::nullopt;
   }
@@ -171,13 +242,15 @@ std::optional<std::pair<geometry_msgs::msg::Point, double>> getCollisionPoint(
 // NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
 // calculation.
 std::vector<PointWithStamp> getCollisionPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points, const TrajectoryPolygons & traj_polygons,
   const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
   const rclcpp::Time & current_time, const bool is_driving_forward,
   std::vector<size_t> & collision_index, const double max_lat_dist,
   const double max_prediction_time_for_collision_check)
 {
-  std::vector<PointWithStamp> collision_points;
+  // object polygons on the predicted path to check
+  std::vector<std::pair<rclcpp::Time, size_t>> object_times_with_indices;
+  std::vector<Polygon2d> obj_polygons;
   for (size_t i = 0; i < predicted_path.path.size(); ++i) {
     if (
       max_prediction_time_for_collision_check <
@@ -192,8 +265,29 @@ std::vector<PointWithStamp> getCollisionPoints(
       continue;
     }
 
+    object_times_with_indices.emplace_back(object_time, i);
+    obj_polygons.push_back(tier4_autoware_utils::toPolygon2d(predicted_path.path.at(i), shape));
+  }
+
+  // broadphase: no collision when the box swept by the object along the predicted path does not
+  // overlap with the trajectory polygons
+  if (obj_polygons.empty()) {
+    return {};
+  }
+  auto swept_box = calcBox(obj_polygons.front());
+  for (const auto & obj_polygon : obj_polygons) {
+    bg::expand(swept_box, calcBox(obj_polygon));
+  }
+  if (traj_polygons.rtree.qbegin(bg::index::intersects(swept_box)) == traj_polygons.rtree.qend()) {
+    return {};
+  }
+
+  std::vector<PointWithStamp> collision_points;
+  for (size_t j = 0; j < obj_polygons.size(); ++j) {
+    const auto & [object_time, i] = object_times_with_indices.at(j);
     const auto collision_info = getCollisionIndex(
-      traj_points, traj_polygons, predicted_path.path.at(i), object_time, shape, max_lat_dist);
+      traj_points, traj_polygons, obj_polygons.at(j), predicted_path.path.at(i), object_time,
+      max_lat_dist);
     if (collision_info) {
       const auto nearest_collision_point = calcNearestCollisionPoint(
         collision_info->first, collision_info->second, traj_points, is_driving_forward);
@@ -0,0 +1,253 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "obstacle_cruise_planner/polygon_utils.hpp"
+
+#include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using polygon_utils::TrajectoryPolygons;
+
+namespace
+{
+constexpr double max_lat_dist = 5.0;
+
+VehicleInfo createVehicleInfo()
+{
+  return vehicle_info_util::createVehicleInfo(
+    0.39, 0.42, 2.74, 1.63, 1.0, 1.03, 0.1, 0.1, 2.5, 0.7);
+}
+
+// trajectory along an arc with 1 m interval
+std::vector<TrajectoryPoint> createTrajectoryPoints(const size_t num_points, const double radius)
+{
+  std::vector<TrajectoryPoint> traj_points;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = static_cast<double>(i) / radius;
+    TrajectoryPoint p;
+    p.pose.position.x = radius * std::sin(theta);
+    p.pose.position.y = radius * (1.0 - std::cos(theta));
+    p.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(theta);
+    traj_points.push_back(p);
+  }
+  return traj_points;
+}
+
+TrajectoryPolygons createTrajectoryPolygons(
+  const std::vector<TrajectoryPoint> & traj_points, const VehicleInfo & vehicle_info)
+{
+  std::vector<Polygon2d> polygons;
+  for (size_t i = 0; i < traj_points.size(); ++i) {
+    const auto & last_pose = traj_points.at(i == 0 ? 0 : i - 1).pose;
+    polygons.push_back(polygon_utils::createOneStepPolygon(
+      {last_pose}, {traj_points.at(i).pose}, vehicle_info, 0.0));
+  }
+  return TrajectoryPolygons(polygons);
+}
+
+Shape createShape(std::mt19937 & engine)
+{
+  std::uniform_real_distribution<double> size_dist(0.5, 5.0);
+  Shape shape;
+  shape.type = Shape::BOUNDING_BOX;
+  shape.dimensions.x = size_dist(engine);
+  shape.dimensions.y = size_dist(engine);
+  return shape;
+}
+
+// obstacle around the trajectory, which overlaps with it or not
+geometry_msgs::msg::Pose createObstaclePose(
+  std::mt19937 & engine, const std::vector<TrajectoryPoint> & traj_points)
+{
+  std::uniform_int_distribution<size_t> idx_dist(0, traj_points.size() - 1);
+  std::uniform_real_distribution<double> lat_offset_dist(-8.0, 8.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+
+  auto pose = tier4_autoware_utils::calcOffsetPose(
+    traj_points.at(idx_dist(engine)).pose, 0.0, lat_offset_dist(engine), 0.0);
+  pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(yaw_dist(engine));
+  return pose;
+}
+
+double calcMinDistanceByLinearScan(
+  const TrajectoryPolygons & traj_polygons, const Polygon2d & polygon)
+{
+  double min_dist = std::numeric_limits<double>::max();
+  for (const auto & traj_polygon : traj_polygons.polygons) {
+    min_dist = std::min(min_dist, bg::distance(traj_polygon, polygon));
+  }
+  return min_dist;
+}
+
+// the first index of the trajectory polygons which collides with the polygon, and the vertices of
+// the collision polygons
+std::optional<std::pair<size_t, std::vector<Point2d>>> getCollisionIndexByLinearScan(
+  const std::vector<TrajectoryPoint> & traj_points, const TrajectoryPolygons & traj_polygons,
+  const Polygon2d & obj_polygon, const geometry_msgs::msg::Pose & object_pose,
+  const double max_lat_dist = std::numeric_limits<double>::max())
+{
+  for (size_t i = 0; i < traj_polygons.polygons.size(); ++i) {
+    if (tier4_autoware_utils::calcDistance2d(traj_points.at(i).pose, object_pose) > max_lat_dist) {
+      continue;
+    }
+
+    std::vector<Polygon2d> collision_polygons;
+    bg::intersection(traj_polygons.polygons.at(i), obj_polygon, collision_polygons);
+    std::vector<Point2d> collision_points;
+    for (const auto & collision_polygon : collision_polygons) {
+      if (bg::area(collision_polygon) > 0.0) {
+        collision_points.insert(
+          collision_points.end(), collision_polygon.outer().begin(),
+          collision_polygon.outer().end());
+      }
+    }
+    if (!collision_points.empty()) {
+      return std::make_pair(i, collision_points);
+    }
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+TEST(PolygonUtils, calcMinDistanceSameAsLinearScan)
+{
+  std::mt19937 engine(0);
+  const auto traj_points = createTrajectoryPoints(100, 30.0);
+  const auto traj_polygons = createTrajectoryPolygons(traj_points, createVehicleInfo());
+  std::uniform_real_distribution<double> distance_dist(0.0, 3.0);
+
+  for (int trial = 0; trial < 300; ++trial) {
+    const auto obj_pose = createObstaclePose(engine, traj_points);
+    const auto obj_polygon = tier4_autoware_utils::toPolygon2d(obj_pose, createShape(engine));
+    const double expected_dist = calcMinDistanceByLinearScan(traj_polygons, obj_polygon);
+    EXPECT_DOUBLE_EQ(polygon_utils::calcMinDistance(traj_polygons, obj_polygon), expected_dist);
+
+    // the broadphase never misses the polygon within the distance
+    const double distance = distance_dist(engine);
+    if (expected_dist <= distance) {
+      EXPECT_TRUE(polygon_utils::isWithinDistance(traj_polygons, obj_polygon, distance));
+    }
+  }
+
+  // empty trajectory
+  const auto obj_polygon =
+    tier4_autoware_utils::toPolygon2d(createObstaclePose(engine, traj_points), createShape(engine));
+  EXPECT_EQ(
+    polygon_utils::calcMinDistance(TrajectoryPolygons{}, obj_polygon),
+    std::numeric_limits<double>::max());
+  EXPECT_FALSE(polygon_utils::isWithinDistance(TrajectoryPolygons{}, obj_polygon, 1.0));
+}
+
+TEST(PolygonUtils, getCollisionPointSameAsLinearScan)
+{
+  std::mt19937 engine(1);
+  const auto vehicle_info = createVehicleInfo();
+  const auto traj_points = createTrajectoryPoints(100, 30.0);
+  const auto traj_polygons = createTrajectoryPolygons(traj_points, vehicle_info);
+  const rclcpp::Time stamp(0, 0, RCL_ROS_TIME);
+
+  size_t num_collisions = 0;
+  for (int trial = 0; trial < 300; ++trial) {
+    PredictedObject object;
+    object.classification.emplace_back();
+    object.shape = createShape(engine);
+    const Obstacle obstacle(stamp, object, createObstaclePose(engine, traj_points), 0.0, 0.0);
+
+    const auto collision_point = polygon_utils::getCollisionPoint(
+      traj_points, traj_polygons, obstacle, true, vehicle_info);
+    const auto expected_collision = getCollisionIndexByLinearScan(
+      traj_points, traj_polygons, obstacle.toPolygon(), obstacle.pose);
+    ASSERT_EQ(collision_point.has_value(), expected_collision.has_value());
+    if (!expected_collision) {
+      continue;
+    }
+    ++num_collisions;
+
+    // the farthest vertex of the collision polygons from the front bumper
+    const auto bumper_pose = tier4_autoware_utils::calcOffsetPose(
+      traj_points.at(expected_collision->first).pose, vehicle_info.max_longitudinal_offset_m, 0.0,
+      0.0);
+    double max_collision_length = std::numeric_limits<double>::lowest();
+    for (const auto & p : expected_collision->second) {
+      const auto point = tier4_autoware_utils::createPoint(p.x(), p.y(), 0.0);
+      max_collision_length = std::max(
+        max_collision_length,
+        std::abs(tier4_autoware_utils::inverseTransformPoint(point, bumper_pose).x));
+    }
+    const double expected_dist =
+      motion_utils::calcSignedArcLength(traj_points, 0, expected_collision->first) -
+      max_collision_length;
+    EXPECT_NEAR(collision_point->second, expected_dist, 1e-9);
+  }
+
+  // both results appear in the random obstacles
+  EXPECT_GT(num_collisions, 0u);
+  EXPECT_LT(num_collisions, 300u);
+}
+
+TEST(PolygonUtils, getCollisionPointsSameAsLinearScan)
+{
+  std::mt19937 engine(2);
+  const auto traj_points = createTrajectoryPoints(100, 30.0);
+  const auto traj_polygons = createTrajectoryPolygons(traj_points, createVehicleInfo());
+  const rclcpp::Time current_time(0, 0, RCL_ROS_TIME);
+  std::uniform_real_distribution<double> velocity_dist(0.0, 10.0);
+
+  size_t num_collisions = 0;
+  for (int trial = 0; trial < 100; ++trial) {
+    // the obstacle moving straight
+    const auto shape = createShape(engine);
+    const auto start_pose = createObstaclePose(engine, traj_points);
+    const double velocity = velocity_dist(engine);
+    PredictedPath predicted_path;
+    predicted_path.time_step = rclcpp::Duration::from_seconds(0.5);
+    for (int i = 0; i < 10; ++i) {
+      predicted_path.path.push_back(
+        tier4_autoware_utils::calcOffsetPose(start_pose, 0.5 * velocity * i, 0.0, 0.0));
+    }
+
+    std::vector<size_t> collision_index;
+    const auto collision_points = polygon_utils::getCollisionPoints(
+      traj_points, traj_polygons, current_time, predicted_path, shape, current_time, true,
+      collision_index, max_lat_dist);
+    ASSERT_EQ(collision_points.size(), collision_index.size());
+
+    std::vector<size_t> expected_collision_index;
+    for (const auto & pose : predicted_path.path) {
+      const auto expected_collision = getCollisionIndexByLinearScan(
+        traj_points, traj_polygons, tier4_autoware_utils::toPolygon2d(pose, shape), pose,
+        max_lat_dist);
+      if (expected_collision) {
+        expected_collision_index.push_back(expected_collision->first);
+      }
+    }
+    EXPECT_EQ(collision_index, expected_collision_index);
+    num_collisions += collision_index.empty() ? 0 : 1;
+  }
+
+  // both results appear in the random obstacles
+  EXPECT_GT(num_collisions, 0u);
+  EXPECT_LT(num_collisions, 100u);
+}
@@ -20,6 +20,7 @@
 #include "path_smoother/type_alias.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 
 #include <memory>
 #include <optional>
@@ -39,6 +40,14 @@ public:
   std::vector<TrajectoryPoint> smoothTrajectory(
     const std::vector<TrajectoryPoint> & traj_points, const geometry_msgs::msg::Pose & ego_pose);
 
+  // NOTE: The segments are smoothed independently of each other in one QP. Their front points are
+  //       fixed, and the previous result is not used. The segment longer than num_points after
+  //       resampling is split into multiple blocks of the QP. The result is std::nullopt for the
+  //       segment which failed the validation, and all the results are std::nullopt if the QP
+  //       failed.
+  std::vector<std::optional<std::vector<TrajectoryPoint>>> smoothTrajectorySegments(
+    const std::vector<std::vector<TrajectoryPoint>> & segments_traj_points);
+
   void initialize(const bool enable_debug_info, const CommonParam & common_param);
   void resetPreviousData();
   void onParam(const std::vector<rclcpp::Parameter> & parameters);
@@ -96,6 +105,14 @@ private:
     Constraint lat;
   };
 
+  // trajectory points which are padded to eb_param_.num_points for the QP
+  struct PaddedSegment
+  {
+    std::vector<TrajectoryPoint> traj_points;
+    size_t pad_start_idx;
+    bool is_goal_contained;
+  };
+
   // arguments
   bool enable_debug_info_;
   EgoNearestParam ego_nearest_param_;
@@ -110,6 +127,12 @@ private:
   rclcpp::Publisher<Trajectory>::SharedPtr debug_eb_fixed_traj_pub_;
 
   std::unique_ptr<autoware::common::osqp::OSQPInterface> osqp_solver_ptr_;
+
+  // NOTE: The smoothing matrix before the rotation by the yaw depends only on the number of points,
+  //       and the constraint matrix only on the number of variables, so they are kept until these
+  //       change.
+  Eigen::SparseMatrix<double> raw_P_for_smooth_;
+  Eigen::SparseMatrix<double> A_;
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_eb_traj_points_ptr_{nullptr};
 
   std::vector<TrajectoryPoint> insertFixedPoint(
@@ -118,9 +141,7 @@ private:
   std::tuple<std::vector<TrajectoryPoint>, size_t> getPaddedTrajectoryPoints(
     const std::vector<TrajectoryPoint> & traj_points) const;
 
-  void updateConstraint(
-    const std::vector<TrajectoryPoint> & traj_points, const bool is_goal_contained,
-    const int pad_start_idx);
+  void updateConstraint(const std::vector<PaddedSegment> & segments);
 
   std::optional<std::vector<double>> calcSmoothedTrajectory();
 
@@ -27,6 +27,8 @@
 #include <algorithm>
 #include <chrono>
 #include <limits>
+#include <tuple>
+#include <utility>
 
 namespace
 {
@@ -39,8 +41,9 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
       triplet_vec.push_back(Eigen::Triplet<double>(row + num_points, colum + num_points, value));
     };
 
+  // NOTE: Only the elements in the band of width 2 are non-zero.
   for (int r = 0; r < num_points; ++r) {
-    for (int c = 0; c < num_points; ++c) {
+    for (int c = std::max(r - 2, 0); c <= std::min(r + 2, num_points - 1); ++c) {
       if (r == c) {
         if (r == 0 || r == num_points - 1) {
           assign_value_to_triplet_vec(r, c, 1.0);
@@ -57,10 +60,8 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
         } else {
           assign_value_to_triplet_vec(r, c, -4.0);
         }
-      } else if (std::abs(c - r) == 2) {
-        assign_value_to_triplet_vec(r, c, 1.0);
       } else {
-        assign_value_to_triplet_vec(r, c, 0.0);
+        assign_value_to_triplet_vec(r, c, 1.0);
       }
     }
   }
@@ -70,11 +71,6 @@ Eigen::SparseMatrix<double> makePMatrix(const int num_points)
   return sparse_mat;
 }
 
-std::vector<double> toStdVector(const Eigen::VectorXd & eigen_vec)
-{
-  return {eigen_vec.data(), eigen_vec.data() + eigen_vec.rows()};
-}
-
 std_msgs::msg::Header createHeader(const rclcpp::Time & now)
 {
   std_msgs::msg::Header header;
@@ -238,10 +234,14 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
   }();
 
   // 4. pad trajectory points
-  const auto [padded_traj_points, pad_start_idx] = getPaddedTrajectoryPoints(resampled_traj_points);
+  std::vector<PaddedSegment> segments(1);
+  auto & segment = segments.front();
+  std::tie(segment.traj_points, segment.pad_start_idx) =
+    getPaddedTrajectoryPoints(resampled_traj_points);
+  segment.is_goal_contained = is_goal_contained;
 
   // 5. update constraint for elastic band's QP
-  updateConstraint(padded_traj_points, is_goal_contained, pad_start_idx);
+  updateConstraint(segments);
 
   // 6. get optimization result
   const auto optimized_points = calcSmoothedTrajectory();
@@ -252,8 +252,8 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
   }
 
   // 7. convert optimization result to trajectory
-  const auto eb_traj_points =
-    convertOptimizedPointsToTrajectory(*optimized_points, padded_traj_points, pad_start_idx);
+  const auto eb_traj_points = convertOptimizedPointsToTrajectory(
+    *optimized_points, segment.traj_points, segment.pad_start_idx);
   if (!eb_traj_points) {
     RCLCPP_WARN(logger_, "return std::nullopt since x or y error is too large");
     return get_prev_eb_traj_points();
@@ -270,6 +270,101 @@ std::vector<TrajectoryPoint> EBPathSmoother::smoothTrajectory(
   return *eb_traj_points;
 }
 
+std::vector<std::optional<std::vector<TrajectoryPoint>>> EBPathSmoother::smoothTrajectorySegments(
+  const std::vector<std::vector<TrajectoryPoint>> & segments_traj_points)
+{
+  time_keeper_ptr_->tic(__func__);
+
+  std::vector<std::optional<std::vector<TrajectoryPoint>>> eb_segments_traj_points(
+    segments_traj_points.size(), std::nullopt);
+
+  // 1. resample and pad trajectory points of each segment
+  // NOTE: The segment longer than the number of points in the QP is split into the blocks which
+  //       share their joint points. The joint points are fixed in both of the blocks, so that the
+  //       smoothed blocks are connected.
+  const size_t num_points = eb_param_.num_points;
+  const size_t block_step = std::max(num_points, static_cast<size_t>(2)) - 1;
+  std::vector<PaddedSegment> segments;
+  std::vector<size_t> segment_indices;
+  for (size_t i = 0; i < segments_traj_points.size(); ++i) {
+    if (segments_traj_points.at(i).size() < 2) {
+      continue;
+    }
+    const auto resampled_traj_points = trajectory_utils::resampleTrajectoryPointsWithoutStopPoint(
+      segments_traj_points.at(i), eb_param_.delta_arc_length);
+    if (resampled_traj_points.empty()) {
+      continue;
+    }
+
+    for (size_t block_start_idx = 0;; block_start_idx += block_step) {
+      const size_t block_end_idx =
+        std::min(block_start_idx + num_points, resampled_traj_points.size());
+      const std::vector<TrajectoryPoint> block_traj_points(
+        resampled_traj_points.begin() + block_start_idx,
+        resampled_traj_points.begin() + block_end_idx);
+
+      PaddedSegment segment;
+      std::tie(segment.traj_points, segment.pad_start_idx) =
+        getPaddedTrajectoryPoints(block_traj_points);
+      // fix the end of the block which is followed by the next block
+      segment.is_goal_contained = block_end_idx < resampled_traj_points.size();
+      segments.push_back(std::move(segment));
+      segment_indices.push_back(i);
+
+      if (block_end_idx == resampled_traj_points.size()) {
+        break;
+      }
+    }
+  }
+  if (segments.empty()) {
+    return eb_segments_traj_points;
+  }
+
+  // 2. update constraint for elastic band's QP of all the segments
+  updateConstraint(segments);
+
+  // 3. get optimization result
+  const auto optimized_points = calcSmoothedTrajectory();
+  if (!optimized_points) {
+    RCLCPP_INFO_EXPRESSION(
+      logger_, enable_debug_info_, "return std::nullopt since smoothing failed");
+    return eb_segments_traj_points;
+  }
+
+  // 4. convert optimization result of each block to trajectory, and connect the blocks of each
+  //    segment. the segment is std::nullopt if any of its blocks failed the validation.
+  std::vector<bool> is_segment_valid(segments_traj_points.size(), true);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const size_t segment_idx = segment_indices.at(i);
+    if (!is_segment_valid.at(segment_idx)) {
+      continue;
+    }
+
+    const auto block_begin = optimized_points->begin() + i * num_points;
+    const std::vector<double> block_optimized_points(block_begin, block_begin + num_points);
+    const auto eb_block_traj_points = convertOptimizedPointsToTrajectory(
+      block_optimized_points, segments.at(i).traj_points, segments.at(i).pad_start_idx);
+    if (!eb_block_traj_points) {
+      is_segment_valid.at(segment_idx) = false;
+      eb_segments_traj_points.at(segment_idx) = std::nullopt;
+      continue;
+    }
+
+    auto & eb_traj_points = eb_segments_traj_points.at(segment_idx);
+    if (!eb_traj_points) {
+      eb_traj_points = *eb_block_traj_points;
+      continue;
+    }
+    // the front point of the block is the same as the back point of the previous block
+    eb_traj_points->insert(
+      eb_traj_points->end(), eb_block_traj_points->begin() + 1, eb_block_traj_points->end());
+    motion_utils::insertOrientation(*eb_traj_points, true);
+  }
+
+  time_keeper_ptr_->toc(__func__, "      ");
+  return eb_segments_traj_points;
+}
+
 std::vector<TrajectoryPoint> EBPathSmoother::insertFixedPoint(
   const std::vector<TrajectoryPoint> & traj_points) const
 {
@@ -307,86 +402,113 @@ std::tuple<std::vector<TrajectoryPoint>, size_t> EBPathSmoother::getPaddedTrajec
   return {padded_traj_points, pad_start_idx};
 }
 
-void EBPathSmoother::updateConstraint(
-  const std::vector<TrajectoryPoint> & traj_points, const bool is_goal_contained,
-  const int pad_start_idx)
+// NOTE: The QP of the segments is block diagonal, and each block is the QP of a segment.
+void EBPathSmoother::updateConstraint(const std::vector<PaddedSegment> & segments)
 {
   time_keeper_ptr_->tic(__func__);
 
   const auto & p = eb_param_;
+  const size_t num_points = p.num_points;
+  const size_t num_variables = segments.size() * num_points;
 
   std::vector<TrajectoryPoint> debug_fixed_traj_points;  // for debug
 
-  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  std::vector<double> upper_bound(p.num_points, 0.0);
-  std::vector<double> lower_bound(p.num_points, 0.0);
-  for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
-    const double constraint_segment_length = [&]() {
-      if (i == 0) {
-        // NOTE: Only first point can be fixed since there is a lateral deviation
-        //       between the two points.
-        //       The front point is previous optimized one, and the others are the input ones.
-        return p.clearance_for_fix;
-      }
-      if (is_goal_contained) {
-        // NOTE: fix goal and its previous pose to keep goal orientation
-        if (p.num_points - 2 <= static_cast<int>(i) || pad_start_idx - 2 <= static_cast<int>(i)) {
+  // update the matrices only when their sizes are changed
+  if (raw_P_for_smooth_.rows() != static_cast<Eigen::Index>(2 * num_points)) {
+    raw_P_for_smooth_ = makePMatrix(p.num_points);
+  }
+  if (A_.rows() != static_cast<Eigen::Index>(num_variables)) {
+    A_.resize(num_variables, num_variables);
+    A_.setIdentity();
+  }
+
+  std::vector<double> upper_bound(num_variables, 0.0);
+  std::vector<double> lower_bound(num_variables, 0.0);
+  std::vector<double> q(num_variables, 0.0);
+  std::vector<Eigen::Triplet<double>> P_triplet_vec;
+  P_triplet_vec.reserve(4 * num_variables);
+  for (size_t seg_idx = 0; seg_idx < segments.size(); ++seg_idx) {
+    const auto & traj_points = segments.at(seg_idx).traj_points;
+    const bool is_goal_contained = segments.at(seg_idx).is_goal_contained;
+    const int pad_start_idx = segments.at(seg_idx).pad_start_idx;
+    const size_t offset = seg_idx * num_points;
+
+    for (size_t i = 0; i < num_points; ++i) {
+      const double constraint_segment_length = [&]() {
+        if (i == 0) {
+          // NOTE: Only first point can be fixed since there is a lateral deviation
+          //       between the two points.
+          //       The front point is previous optimized one, and the others are the input ones.
           return p.clearance_for_fix;
         }
-      }
-      if (i < static_cast<size_t>(p.num_joint_points) + 1) {  // 1 is added since index 0 is fixed
-                                                              // point
-        return p.clearance_for_joint;
-      }
-      return p.clearance_for_smooth;
-    }();
+        if (is_goal_contained) {
+          // NOTE: fix goal and its previous pose to keep goal orientation
+          if (p.num_points - 2 <= static_cast<int>(i) || pad_start_idx - 2 <= static_cast<int>(i)) {
+            return p.clearance_for_fix;
+          }
+        }
+        if (i < static_cast<size_t>(p.num_joint_points) + 1) {  // 1 is added since index 0 is
+                                                                // fixed point
+          return p.clearance_for_joint;
+        }
+        return p.clearance_for_smooth;
+      }();
 
-    upper_bound.at(i) = constraint_segment_length;
-    lower_bound.at(i) = -constraint_segment_length;
+      upper_bound.at(offset + i) = constraint_segment_length;
+      lower_bound.at(offset + i) = -constraint_segment_length;
 
-    if (constraint_segment_length == 0.0) {
-      debug_fixed_traj_points.push_back(traj_points.at(i));
+      if (constraint_segment_length == 0.0) {
+        debug_fixed_traj_points.push_back(traj_points.at(i));
+      }
     }
-  }
 
-  Eigen::VectorXd x_mat(2 * p.num_points);
-  std::vector<Eigen::Triplet<double>> theta_triplet_vec;
-  for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
-    x_mat(i) = traj_points.at(i).pose.position.x;
-    x_mat(i + p.num_points) = traj_points.at(i).pose.position.y;
+    Eigen::VectorXd x_mat(2 * num_points);
+    std::vector<Eigen::Triplet<double>> theta_triplet_vec;
+    for (size_t i = 0; i < num_points; ++i) {
+      x_mat(i) = traj_points.at(i).pose.position.x;
+      x_mat(i + num_points) = traj_points.at(i).pose.position.y;
+
+      const double yaw = tf2::getYaw(traj_points.at(i).pose.orientation);
+      theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i, -std::sin(yaw)));
+      theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i + num_points, std::cos(yaw)));
+    }
+    Eigen::SparseMatrix<double> sparse_theta_mat(num_points, 2 * num_points);
+    sparse_theta_mat.setFromTriplets(theta_triplet_vec.begin(), theta_triplet_vec.end());
+
+    // calculate P
+    // NOTE: The sparse products keep the explicit zeros, so the sparsity pattern of P is the same
+    //       as long as the number of points is the same.
+    const Eigen::SparseMatrix<double> theta_P_mat =
+      p.smooth_weight * (sparse_theta_mat * raw_P_for_smooth_);
+    const Eigen::SparseMatrix<double> P_for_smooth = theta_P_mat * sparse_theta_mat.transpose();
+    for (int k = 0; k < P_for_smooth.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(P_for_smooth, k); it; ++it) {
+        if (it.row() <= it.col()) {
+          P_triplet_vec.emplace_back(offset + it.row(), offset + it.col(), it.value());
+        }
+      }
+    }
+    for (size_t i = 0; i < num_points; ++i) {
+      P_triplet_vec.emplace_back(offset + i, offset + i, p.lat_error_weight);
+    }
 
-    const double yaw = tf2::getYaw(traj_points.at(i).pose.orientation);
-    theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i, -std::sin(yaw)));
-    theta_triplet_vec.push_back(Eigen::Triplet<double>(i, i + p.num_points, std::cos(yaw)));
+    // calculate q
+    const Eigen::VectorXd raw_q_for_smooth = theta_P_mat * x_mat;
+    std::copy(
+      raw_q_for_smooth.data(), raw_q_for_smooth.data() + num_points, q.begin() + offset);
   }
-  Eigen::SparseMatrix<double> sparse_theta_mat(p.num_points, 2 * p.num_points);
-  sparse_theta_mat.setFromTriplets(theta_triplet_vec.begin(), theta_triplet_vec.end());
-
-  // calculate P
-  const Eigen::SparseMatrix<double> raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
-  const Eigen::MatrixXd theta_P_mat = sparse_theta_mat * raw_P_for_smooth;
-  const Eigen::MatrixXd P_for_smooth = theta_P_mat * sparse_theta_mat.transpose();
-  const Eigen::MatrixXd P_for_lat_error =
-    p.lat_error_weight * Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  const Eigen::MatrixXd P = P_for_smooth + P_for_lat_error;
-
-  // calculate q
-  const Eigen::VectorXd raw_q_for_smooth = theta_P_mat * x_mat;
-  const auto q = toStdVector(raw_q_for_smooth);
-
-  if (p.enable_warm_start && osqp_solver_ptr_) {
-    osqp_solver_ptr_->updateP(P);
-    osqp_solver_ptr_->updateQ(q);
-    osqp_solver_ptr_->updateA(A);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
-    osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
-  } else {
-    osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
-      P, A, q, lower_bound, upper_bound, p.qp_param.eps_abs);
-    osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
+  Eigen::SparseMatrix<double> P(num_variables, num_variables);
+  P.setFromTriplets(P_triplet_vec.begin(), P_triplet_vec.end());
+
+  // NOTE: While the sparsity patterns are the same, only the values of the workspace are updated
+  //       with warm start.
+  if (!p.enable_warm_start || !osqp_solver_ptr_) {
+    osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(p.qp_param.eps_abs);
     osqp_solver_ptr_->updateEpsAbs(p.qp_param.eps_abs);
     osqp_solver_ptr_->updateMaxIter(p.qp_param.max_iteration);
   }
+  osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
+  osqp_solver_ptr_->setProblem(P, A_, q, lower_bound, upper_bound);
 
   // publish fixed trajectory
   const auto eb_fixed_traj =
@@ -0,0 +1,129 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "path_smoother/elastic_band.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <motion_utils/trajectory/trajectory.hpp>
+#include <tier4_autoware_utils/geometry/geometry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+using path_smoother::CommonParam;
+using path_smoother::EBPathSmoother;
+using path_smoother::EgoNearestParam;
+using path_smoother::TimeKeeper;
+using path_smoother::TrajectoryPoint;
+
+namespace
+{
+std::vector<TrajectoryPoint> createTrajectoryPoints(
+  const size_t num_points, const double y_offset, const std::function<double(size_t)> & lat_func)
+{
+  std::vector<TrajectoryPoint> traj_points;
+  for (size_t i = 0; i < num_points; ++i) {
+    TrajectoryPoint p;
+    p.pose.position.x = static_cast<double>(i);
+    p.pose.position.y = y_offset + lat_func(i);
+    p.longitudinal_velocity_mps = 5.0;
+    traj_points.push_back(p);
+  }
+  motion_utils::insertOrientation(traj_points, true);
+  return traj_points;
+}
+
+class EBPathSmootherTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+
+    const auto path_smoother_dir = ament_index_cpp::get_package_share_directory("path_smoother");
+    auto node_options = rclcpp::NodeOptions{};
+    node_options.arguments(
+      {"--ros-args", "--params-file",
+       path_smoother_dir + "/config/elastic_band_smoother.param.yaml"});
+    node_ = std::make_shared<rclcpp::Node>("test_elastic_band", node_options);
+
+    smoother_ = std::make_unique<EBPathSmoother>(
+      node_.get(), false, EgoNearestParam(node_.get()), CommonParam(node_.get()),
+      std::make_shared<TimeKeeper>());
+  }
+
+  void TearDown() override
+  {
+    smoother_.reset();
+    node_.reset();
+    rclcpp::shutdown();
+  }
+
+  std::shared_ptr<rclcpp::Node> node_;
+  std::unique_ptr<EBPathSmoother> smoother_;
+};
+}  // namespace
+
+TEST_F(EBPathSmootherTest, SmoothTrajectorySegmentsSameAsEachSegment)
+{
+  // a zigzag longer than the number of points in the QP, a sine wave, and a segment shorter than
+  // the number of points in the QP
+  const std::vector<std::vector<TrajectoryPoint>> segments_traj_points{
+    createTrajectoryPoints(120, 0.0, [](const size_t i) { return 0.3 * (i % 2); }),
+    createTrajectoryPoints(
+      100, 10.0, [](const size_t i) { return 2.0 * std::sin(0.2 * static_cast<double>(i)); }),
+    createTrajectoryPoints(40, -10.0, [](const size_t i) { return 0.2 * (i % 3); }),
+    createTrajectoryPoints(1, 20.0, [](const size_t) { return 0.0; })};
+
+  const auto joint_results = smoother_->smoothTrajectorySegments(segments_traj_points);
+  ASSERT_EQ(joint_results.size(), segments_traj_points.size());
+
+  // the segment of one point is not smoothed
+  EXPECT_FALSE(joint_results.back());
+
+  for (size_t i = 0; i + 1 < segments_traj_points.size(); ++i) {
+    const auto & traj_points = segments_traj_points.at(i);
+    const auto separate_results = smoother_->smoothTrajectorySegments({traj_points});
+    ASSERT_EQ(separate_results.size(), 1u);
+    ASSERT_TRUE(separate_results.front());
+    ASSERT_TRUE(joint_results.at(i));
+
+    const auto & separate_points = *separate_results.front();
+    const auto & joint_points = *joint_results.at(i);
+    ASSERT_EQ(joint_points.size(), separate_points.size());
+    for (size_t j = 0; j < joint_points.size(); ++j) {
+      EXPECT_NEAR(joint_points.at(j).pose.position.x, separate_points.at(j).pose.position.x, 1e-3);
+      EXPECT_NEAR(joint_points.at(j).pose.position.y, separate_points.at(j).pose.position.y, 1e-3);
+    }
+
+    // the front point is fixed
+    EXPECT_NEAR(joint_points.front().pose.position.x, traj_points.front().pose.position.x, 1e-6);
+    EXPECT_NEAR(joint_points.front().pose.position.y, traj_points.front().pose.position.y, 1e-6);
+
+    // the whole segment is smoothed without a gap, even if it is split into the blocks of the QP
+    EXPECT_NEAR(joint_points.back().pose.position.x, traj_points.back().pose.position.x, 0.2);
+    for (size_t j = 0; j + 1 < joint_points.size(); ++j) {
+      EXPECT_LT(
+        tier4_autoware_utils::calcDistance2d(joint_points.at(j), joint_points.at(j + 1)), 1.5);
+    }
+  }
+
+  // the long segment is split into two blocks
+  EXPECT_GT(joint_results.front()->size(), 100u);
+}
@@ -0,0 +1,103 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ROUTE_HANDLER__LANELET_MAP_REGISTRY_HPP_
+#define ROUTE_HANDLER__LANELET_MAP_REGISTRY_HPP_
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+
+#include <lanelet2_core/Forward.h>
+#include <lanelet2_routing/Forward.h>
+#include <lanelet2_traffic_rules/TrafficRules.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace route_handler
+{
+using autoware_auto_mapping_msgs::msg::HADMapBin;
+
+/**
+ * @brief The lanelet map deserialized from HADMapBin and the data derived from it. The data is
+ *        shared by all the users of the same map and must not be modified. The lazy caches of the
+ *        map (e.g. the centerlines) are built in advance, so the map can be read on any thread.
+ */
+struct LaneletMapData
+{
+  lanelet::LaneletMapPtr lanelet_map_ptr;
+  lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr;
+  // routing graph for vehicles (Germany rules) built by fromBinMsg
+  lanelet::routing::RoutingGraphPtr routing_graph_ptr;
+  // routing graphs for vehicles and pedestrians
+  std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs_ptr;
+  lanelet::ConstLanelets road_lanelets;
+  lanelet::ConstLanelets shoulder_lanelets;
+  lanelet::ConstLanelets crosswalk_lanelets;
+};
+using LaneletMapDataConstPtr = std::shared_ptr<const LaneletMapData>;
+
+/**
+ * @brief Process-wide registry of the deserialized lanelet maps. The nodes loaded in the same
+ *        component container receive the same HADMapBin, so the map is deserialized and the
+ *        routing graphs are built only once and handed out to every node.
+ *        The entries are held weakly and released when the last user drops the map.
+ */
+class LaneletMapRegistry
+{
+public:
+  static LaneletMapRegistry & getInstance();
+
+  /**
+   * @brief Get the map data of the message, or build it if the map is not registered yet.
+   * @param map_msg The map message.
+   * @return LaneletMapDataConstPtr The shared map data.
+   */
+  LaneletMapDataConstPtr get(const HADMapBin & map_msg);
+
+  // number of the maps which are still in use
+  size_t size() const;
+  // number of the requests served without deserializing the map
+  size_t hitCount() const;
+
+  static size_t hashMap(const HADMapBin & map_msg);
+
+  /**
+   * @brief Build the map data of the message without registering it. The map is owned only by
+   *        the caller, so it can be modified unlike the shared one.
+   * @param map_msg The map message.
+   * @return LaneletMapDataConstPtr The map data.
+   */
+  static LaneletMapDataConstPtr build(const HADMapBin & map_msg);
+
+  LaneletMapRegistry(const LaneletMapRegistry &) = delete;
+  LaneletMapRegistry & operator=(const LaneletMapRegistry &) = delete;
+
+private:
+  LaneletMapRegistry() = default;
+
+  struct Entry
+  {
+    size_t data_size{0};
+    std::weak_ptr<const LaneletMapData> data{};
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<size_t, Entry> maps_{};
+  size_t hit_count_{0};
+};
+}  // namespace route_handler
+
+#endif  // ROUTE_HANDLER__LANELET_MAP_REGISTRY_HPP_
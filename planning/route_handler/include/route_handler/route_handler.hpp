@@ -15,6 +15,8 @@
 #ifndef ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 #define ROUTE_HANDLER__ROUTE_HANDLER_HPP_
 
+#include "route_handler/lanelet_map_registry.hpp"
+
 #include <rclcpp/logger.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
@@ -57,7 +59,9 @@ public:
   explicit RouteHandler(const HADMapBin & map_msg);
 
   // non-const methods
-  void setMap(const HADMapBin & map_msg);
+  // the map is shared with the other users in the process unless share_map is false. set it to
+  // false to modify the map.
+  void setMap(const HADMapBin & map_msg, const bool share_map = true);
   void setRoute(const LaneletRoute & route_msg);
   void setRouteLanelets(const lanelet::ConstLanelets & path_lanelets);
   void clearRoute();
@@ -357,6 +361,7 @@ public:
 
 private:
   // MUST
+  LaneletMapDataConstPtr map_data_ptr_;
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_ptr_;
   std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs_ptr_;
@@ -0,0 +1,131 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "route_handler/lanelet_map_registry.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+#include <lanelet2_extension/utility/query.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_routing/RoutingGraph.h>
+#include <lanelet2_routing/RoutingGraphContainer.h>
+#include <lanelet2_traffic_rules/TrafficRulesFactory.h>
+
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace route_handler
+{
+LaneletMapRegistry & LaneletMapRegistry::getInstance()
+{
+  static LaneletMapRegistry instance;
+  return instance;
+}
+
+size_t LaneletMapRegistry::hashMap(const HADMapBin & map_msg)
+{
+  const auto combine = [](size_t seed, const size_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+  };
+
+  const std::string_view bin(
+    reinterpret_cast<const char *>(map_msg.data.data()), map_msg.data.size());
+  size_t seed = std::hash<std::string_view>{}(bin);
+  seed = combine(seed, std::hash<std::string>{}(map_msg.format_version));
+  seed = combine(seed, std::hash<std::string>{}(map_msg.map_version));
+  seed = combine(seed, std::hash<std::string>{}(map_msg.header.frame_id));
+  return seed;
+}
+
+LaneletMapDataConstPtr LaneletMapRegistry::get(const HADMapBin & map_msg)
+{
+  const auto key = hashMap(map_msg);
+
+  // NOTE: the lock is held while building so that the nodes which receive the same map at the
+  // same time wait for the first one instead of deserializing it again.
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto & entry = maps_[key];
+  if (entry.data_size == map_msg.data.size()) {
+    if (const auto data = entry.data.lock()) {
+      ++hit_count_;
+      return data;
+    }
+  }
+
+  const auto data = build(map_msg);
+  entry.data_size = map_msg.data.size();
+  entry.data = data;
+
+  // drop the maps which are not used anymore
+  for (auto itr = maps_.begin(); itr != maps_.end();) {
+    itr = itr->second.data.expired() ? maps_.erase(itr) : std::next(itr);
+  }
+
+  return data;
+}
+
+size_t LaneletMapRegistry::size() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t num = 0;
+  for (const auto & [key, entry] : maps_) {
+    if (!entry.data.expired()) {
+      ++num;
+    }
+  }
+  return num;
+}
+
+size_t LaneletMapRegistry::hitCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hit_count_;
+}
+
+LaneletMapDataConstPtr LaneletMapRegistry::build(const HADMapBin & map_msg)
+{
+  auto data = std::make_shared<LaneletMapData>();
+
+  data->lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(
+    map_msg, data->lanelet_map_ptr, &data->traffic_rules_ptr, &data->routing_graph_ptr);
+
+  // the vehicle graph is the same as the one built in fromBinMsg
+  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
+    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
+  const lanelet::routing::RoutingGraphConstPtr vehicle_graph = data->routing_graph_ptr;
+  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
+    lanelet::routing::RoutingGraph::build(*data->lanelet_map_ptr, *pedestrian_rules);
+  data->overall_graphs_ptr = std::make_shared<const lanelet::routing::RoutingGraphContainer>(
+    lanelet::routing::RoutingGraphContainer({vehicle_graph, pedestrian_graph}));
+
+  const auto all_lanelets = lanelet::utils::query::laneletLayer(data->lanelet_map_ptr);
+
+  // Lanelet2 computes the centerline lazily and caches it in the lanelet without synchronization.
+  // Compute it here before the map is handed out so that the nodes on different threads only read
+  // the shared map. The bounding boxes are computed when the primitives are added to the map.
+  for (const auto & lanelet : all_lanelets) {
+    lanelet.centerline();
+  }
+
+  data->road_lanelets = lanelet::utils::query::roadLanelets(all_lanelets);
+  data->shoulder_lanelets = lanelet::utils::query::shoulderLanelets(all_lanelets);
+  data->crosswalk_lanelets = lanelet::utils::query::crosswalkLanelets(all_lanelets);
+
+  return data;
+}
+}  // namespace route_handler
@@ -139,26 +139,17 @@ RouteHandler::RouteHandler(const HADMapBin & map_msg)
   route_ptr_ = nullptr;
 }
 
-void RouteHandler::setMap(const HADMapBin & map_msg)
-{
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    map_msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
-
-  const auto traffic_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  const auto pedestrian_rules = lanelet::traffic_rules::TrafficRulesFactory::create(
-    lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
-  const lanelet::routing::RoutingGraphConstPtr vehicle_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules);
-  const lanelet::routing::RoutingGraphConstPtr pedestrian_graph =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *pedestrian_rules);
-  const lanelet::routing::RoutingGraphContainer overall_graphs({vehicle_graph, pedestrian_graph});
-  overall_graphs_ptr_ =
-    std::make_shared<const lanelet::routing::RoutingGraphContainer>(overall_graphs);
-  lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
-  shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+void RouteHandler::setMap(const HADMapBin & map_msg, const bool share_map)
+{
+  // the map is deserialized once per process and shared with the other users of the same map
+  map_data_ptr_ = share_map ? LaneletMapRegistry::getInstance().get(map_msg)
+                            : LaneletMapRegistry::build(map_msg);
+  lanelet_map_ptr_ = map_data_ptr_->lanelet_map_ptr;
+  traffic_rules_ptr_ = map_data_ptr_->traffic_rules_ptr;
+  routing_graph_ptr_ = map_data_ptr_->routing_graph_ptr;
+  overall_graphs_ptr_ = map_data_ptr_->overall_graphs_ptr;
+  road_lanelets_ = map_data_ptr_->road_lanelets;
+  shoulder_lanelets_ = map_data_ptr_->shoulder_lanelets;
 
   is_map_msg_ready_ = true;
   is_handler_ready_ = false;
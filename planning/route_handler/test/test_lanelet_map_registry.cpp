@@ -0,0 +1,116 @@
+// Copyright 2024 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "route_handler/lanelet_map_registry.hpp"
+#include "route_handler/route_handler.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+
+#include <memory>
+
+using route_handler::HADMapBin;
+using route_handler::LaneletMapRegistry;
+using route_handler::RouteHandler;
+
+namespace
+{
+// a straight road lanelet whose length is given
+HADMapBin createMapBinMsg(const double length)
+{
+  lanelet::LineString3d left_bound(
+    1, {lanelet::Point3d(11, 0.0, 1.5, 0.0), lanelet::Point3d(12, length, 1.5, 0.0)});
+  lanelet::LineString3d right_bound(
+    2, {lanelet::Point3d(21, 0.0, -1.5, 0.0), lanelet::Point3d(22, length, -1.5, 0.0)});
+  lanelet::Lanelet lanelet(3, left_bound, right_bound);
+  lanelet.setAttribute(lanelet::AttributeName::Type, lanelet::AttributeValueString::Lanelet);
+  lanelet.setAttribute(lanelet::AttributeName::Subtype, lanelet::AttributeValueString::Road);
+
+  lanelet::LaneletMapPtr lanelet_map_ptr(new lanelet::LaneletMap);
+  lanelet_map_ptr->add(lanelet);
+
+  HADMapBin map_msg;
+  lanelet::utils::conversion::toBinMsg(lanelet_map_ptr, &map_msg);
+  return map_msg;
+}
+}  // namespace
+
+TEST(LaneletMapRegistry, ShareSameMap)
+{
+  auto & registry = LaneletMapRegistry::getInstance();
+  const auto map_msg = createMapBinMsg(10.0);
+  const auto hit_count = registry.hitCount();
+
+  const auto data = registry.get(map_msg);
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data->road_lanelets.size(), 1u);
+  EXPECT_EQ(registry.hitCount(), hit_count);
+
+  // the same message is served without deserializing the map
+  const auto same_data = registry.get(map_msg);
+  EXPECT_EQ(same_data, data);
+  EXPECT_EQ(registry.hitCount(), hit_count + 1);
+
+  // a different map is deserialized
+  const auto other_data = registry.get(createMapBinMsg(20.0));
+  EXPECT_NE(other_data, data);
+  EXPECT_EQ(registry.hitCount(), hit_count + 1);
+  EXPECT_EQ(registry.size(), 2u);
+}
+
+TEST(LaneletMapRegistry, ReleaseUnusedMap)
+{
+  auto & registry = LaneletMapRegistry::getInstance();
+  const auto map_msg = createMapBinMsg(10.0);
+
+  auto data = registry.get(map_msg);
+  std::weak_ptr<const route_handler::LaneletMapData> weak_data = data;
+  EXPECT_EQ(registry.size(), 1u);
+
+  // the registry does not keep the map alive
+  data.reset();
+  EXPECT_TRUE(weak_data.expired());
+  EXPECT_EQ(registry.size(), 0u);
+
+  // the released map is deserialized again
+  const auto hit_count = registry.hitCount();
+  data = registry.get(map_msg);
+  ASSERT_TRUE(data);
+  EXPECT_EQ(registry.hitCount(), hit_count);
+  EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(LaneletMapRegistry, RouteHandlerPrivateMap)
+{
+  auto & registry = LaneletMapRegistry::getInstance();
+  const auto map_msg = createMapBinMsg(10.0);
+  const auto data = registry.get(map_msg);
+
+  RouteHandler shared_route_handler;
+  shared_route_handler.setMap(map_msg, true);
+  EXPECT_EQ(shared_route_handler.getLaneletMapPtr(), data->lanelet_map_ptr);
+
+  // the private map is not registered nor shared with the other users
+  const auto hit_count = registry.hitCount();
+  RouteHandler private_route_handler;
+  private_route_handler.setMap(map_msg, false);
+  const auto private_map_ptr = private_route_handler.getLaneletMapPtr();
+  ASSERT_TRUE(private_map_ptr);
+  EXPECT_NE(private_map_ptr, data->lanelet_map_ptr);
+  EXPECT_EQ(private_map_ptr->laneletLayer.size(), data->lanelet_map_ptr->laneletLayer.size());
+  EXPECT_EQ(registry.hitCount(), hit_count);
+  EXPECT_EQ(registry.size(), 1u);
+}
@@ -188,10 +188,11 @@ void ScenarioSelectorNode::updateCurrentScenario()
 void ScenarioSelectorNode::onMap(
   const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg)
 {
-  lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
-  lanelet::utils::conversion::fromBinMsg(
-    *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
+  // the route handler and this node share the map deserialized once in the registry
   route_handler_ = std::make_shared<route_handler::RouteHandler>(*msg);
+  lanelet_map_ptr_ = route_handler_->getLaneletMapPtr();
+  traffic_rules_ptr_ = route_handler_->getTrafficRulesPtr();
+  routing_graph_ptr_ = route_handler_->getRoutingGraphPtr();
 }
 
 void ScenarioSelectorNode::onRoute(
@@ -301,8 +301,9 @@ void StaticCenterlineOptimizerNode::load_map(const std::string & lanelet2_input_
   RCLCPP_INFO(get_logger(), "Published map.");
 
   // create route_handler
+  // NOTE: the map is not shared since the optimized centerline is written to it.
   route_handler_ptr_ = std::make_shared<RouteHandler>();
-  route_handler_ptr_->setMap(*map_bin_ptr_);
+  route_handler_ptr_->setMap(*map_bin_ptr_, false);
 }
 
 void StaticCenterlineOptimizerNode::on_load_map(
@@ -20,6 +20,8 @@
 #ifndef SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 #define SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 
+#include "system_monitor/procfs_reader.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <tier4_external_api_msgs/msg/cpu_status.hpp>
@@ -102,7 +104,7 @@ protected:
 
   /**
    * @brief convert Cpu Usage To diagnostic Level
-   * @param [cpu_name] mpstat cpu name
+   * @param [cpu_name] cpu number, or "all" for the sum of all CPUs
    * @param [usage] cpu usage value
    * @return DiagStatus::OK or WARN or ERROR
    */
@@ -141,7 +143,9 @@ protected:
   std::vector<cpu_freq_info> freqs_;        //!< @brief CPU list for frequency
   std::vector<int> usage_warn_check_cnt_;   //!< @brief CPU list for usage over warn check counter
   std::vector<int> usage_error_check_cnt_;  //!< @brief CPU list for usage over error check counter
-  bool mpstat_exists_;                      //!< @brief flag if mpstat exists
+  ProcfsReader reader_;                     //!< @brief reader of /proc/stat
+  std::vector<CpuTicks> cpu_ticks_;         //!< @brief CPU time of the current check
+  std::vector<CpuTicks> prev_cpu_ticks_;    //!< @brief CPU time of the previous check
 
   float usage_warn_;       //!< @brief CPU usage(%) to generate warning
   float usage_error_;      //!< @brief CPU usage(%) to generate error
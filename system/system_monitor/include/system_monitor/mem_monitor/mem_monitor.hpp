@@ -20,6 +20,8 @@
 #ifndef SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 #define SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 
+#include "system_monitor/procfs_reader.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
@@ -60,14 +62,15 @@ protected:
 
   /**
    * @brief get human-readable output for memory size
-   * @param [in] str size with bytes
+   * @param [in] bytes size with bytes
    * @return human-readable output
    */
-  std::string toHumanReadable(const std::string & str);
+  std::string toHumanReadable(const size_t bytes);
 
   diagnostic_updater::Updater updater_;  //!< @brief Updater class which advertises to /diagnostics
 
   char hostname_[HOST_NAME_MAX + 1];  //!< @brief host name
+  ProcfsReader reader_;               //!< @brief reader of /proc/meminfo
 
   size_t available_size_;  //!< @brief Memory available size to generate error
 
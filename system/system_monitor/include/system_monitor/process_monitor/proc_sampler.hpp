@@ -0,0 +1,157 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file proc_sampler.hpp
+ * @brief Process sampler reading procfs directly
+ */
+
+#ifndef SYSTEM_MONITOR__PROCESS_MONITOR__PROC_SAMPLER_HPP_
+#define SYSTEM_MONITOR__PROCESS_MONITOR__PROC_SAMPLER_HPP_
+
+#include "system_monitor/process_monitor/diag_task.hpp"
+#include "system_monitor/procfs_reader.hpp"
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Struct for storing the number of tasks in each state
+ */
+struct TasksSummary
+{
+  int total{0};
+  int running{0};
+  int sleeping{0};
+  int stopped{0};
+  int zombie{0};
+};
+
+/**
+ * @brief Sampler of the processes which reads procfs without spawning child processes.
+ * The CPU usage of each process is computed from the difference between two samples in the same
+ * way as top, so the first sample is used only as the baseline.
+ */
+class ProcSampler
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] proc_dir mount point of procfs
+   */
+  explicit ProcSampler(const std::string & proc_dir = "/proc");
+
+  /**
+   * @brief sample the processes
+   * @return true if success to read procfs
+   */
+  bool sample();
+
+  /**
+   * @brief check if the CPU usage is available
+   * @return true if the processes are sampled twice or more
+   */
+  bool isReady() const { return is_ready_; }
+
+  /**
+   * @brief get the error message of the last sample
+   * @return error message
+   */
+  const std::string & getErrorMessage() const { return error_message_; }
+
+  /**
+   * @brief get task summary
+   * @return number of tasks in each state
+   */
+  const TasksSummary & getTasksSummary() const { return tasks_summary_; }
+
+  /**
+   * @brief get high load processes
+   * @param [in] num number of processes
+   * @return process information sorted by the CPU usage
+   */
+  std::vector<ProcessInfo> getHighLoadProcesses(const size_t num) const;
+
+  /**
+   * @brief get high memory processes
+   * @param [in] num number of processes
+   * @return process information sorted by the memory usage
+   */
+  std::vector<ProcessInfo> getHighMemoryProcesses(const size_t num) const;
+
+protected:
+  /**
+   * @brief Struct for storing the values of a process read from procfs
+   */
+  struct ProcessStat
+  {
+    pid_t pid{0};
+    char state{'?'};
+    int64_t priority{0};
+    int64_t nice{0};
+    uint64_t ticks{0};  // utime + stime
+    uint64_t virtual_kb{0};
+    uint64_t resident_kb{0};
+    uint64_t shared_kb{0};
+    uid_t uid{0};
+    std::string comm;
+    double cpu_usage{0.0};
+    double memory_usage{0.0};
+  };
+
+  /**
+   * @brief read /proc/[pid]/stat and /proc/[pid]/statm
+   * @param [in] pid process id
+   * @param [out] stat values of the process
+   * @return true if success to read the files, false if the process exited
+   */
+  bool readProcessStat(const pid_t pid, ProcessStat & stat);
+
+  /**
+   * @brief convert a sampled process to the diagnostic information
+   * @param [in] stat values of the process
+   * @return process information
+   */
+  ProcessInfo toProcessInfo(const ProcessStat & stat) const;
+
+  /**
+   * @brief get user name from uid with cache
+   * @param [in] uid user id
+   * @return user name, or uid if the user is not found
+   */
+  std::string getUserName(const uid_t uid) const;
+
+  std::string proc_dir_;   //!< @brief mount point of procfs
+  ProcfsReader reader_;    //!< @brief reader of procfs
+  std::string path_;       //!< @brief buffer reused to build file paths
+  int64_t clock_ticks_;    //!< @brief number of clock ticks per second
+  int64_t page_size_kb_;   //!< @brief page size in KiB
+  int64_t num_of_cpus_;    //!< @brief number of online CPUs
+  std::vector<CpuTicks> cpu_ticks_;  //!< @brief reused CPU time of the current sample
+  MemInfo mem_info_;                 //!< @brief memory statistics of the current sample
+  uint64_t prev_total_ticks_{0};     //!< @brief total CPU time of the previous sample
+  std::unordered_map<pid_t, uint64_t> prev_ticks_;  //!< @brief CPU time of each process
+  std::unordered_map<pid_t, uint64_t> curr_ticks_;  //!< @brief reused map of the current sample
+  std::vector<ProcessStat> processes_;               //!< @brief sampled processes
+  mutable std::unordered_map<uid_t, std::string> user_names_;  //!< @brief cache of user names
+  TasksSummary tasks_summary_;                                 //!< @brief number of tasks
+  std::string error_message_;                                  //!< @brief error of last sample
+  bool is_ready_{false};  //!< @brief flag if the CPU usage is available
+};
+
+#endif  // SYSTEM_MONITOR__PROCESS_MONITOR__PROC_SAMPLER_HPP_
@@ -21,18 +21,15 @@
 #define SYSTEM_MONITOR__PROCESS_MONITOR__PROCESS_MONITOR_HPP_
 
 #include "system_monitor/process_monitor/diag_task.hpp"
+#include "system_monitor/process_monitor/proc_sampler.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
-#include <boost/process.hpp>
-
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
-namespace bp = boost::process;
-
 class ProcessMonitor : public rclcpp::Node
 {
 public:
@@ -55,56 +52,15 @@ protected:
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
   /**
-   * @brief get task summary
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
-   */
-  void getTasksSummary(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    const std::string & output);  // NOLINT(runtime/references)
-
-  /**
-   * @brief remove header
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
-   */
-  void removeHeader(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    std::string & output);  // NOLINT(runtime/references)
-
-  /**
-   * @brief get high load processes
-   * @param [in] output top command output
-   */
-  void getHighLoadProcesses(const std::string & output);
-
-  /**
-   * @brief get high memory processes
-   * @param [in] output top command output
-   */
-  void getHighMemoryProcesses(const std::string & output);
-
-  /**
-   * @brief get command line from process id
-   * @param [in] pid process id
-   * @param [out] command output command line
-   * @return true if success to get command line name
-   */
-  bool getCommandLineFromPiD(const std::string & pid, std::string & command);
-
-  /**
-   * @brief get top-rated processes
-   * @param [in] tasks list of diagnostics tasks for high load procs
-   * @param [in] output top command output
+   * @brief set process information to diagnostics tasks
+   * @param [in] tasks list of diagnostics tasks
+   * @param [in] infos list of process information
    */
-  void getTopratedProcesses(std::vector<std::shared_ptr<DiagTask>> * tasks, bp::pipe * p);
+  void setProcessInformation(
+    std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & infos);
 
   /**
-   * @brief get top-rated processes
+   * @brief set error content to diagnostics tasks
    * @param [in] tasks list of diagnostics tasks for high load procs
    * @param [in] message Diagnostics status message
    * @param [in] error_command Error command
@@ -115,7 +71,7 @@ protected:
     const std::string & error_command, const std::string & content);
 
   /**
-   * @brief timer callback to execute top command
+   * @brief timer callback to sample processes
    */
   void onTimer();
 
@@ -128,12 +84,16 @@ protected:
     load_tasks_;  //!< @brief list of diagnostics tasks for high load procs
   std::vector<std::shared_ptr<DiagTask>>
     memory_tasks_;                      //!< @brief list of diagnostics tasks for high memory procs
-  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to execute top command
-  std::string top_output_;              //!< @brief output from top command
-  bool is_top_error_;                   //!< @brief flag if an top error occurs
-  bool is_pipe2_error_;                 //!< @brief flag if an pipe2 error occurs
-  double elapsed_ms_;                   //!< @brief Execution time of top command
-  std::mutex mutex_;                    //!< @brief mutex for output from top command
+  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to sample processes
+
+  ProcSampler sampler_;                         //!< @brief sampler reading procfs
+  bool is_ready_;                               //!< @brief flag if processes are sampled
+  std::string error_message_;                   //!< @brief error message of sampling
+  TasksSummary tasks_summary_;                  //!< @brief number of tasks in each state
+  std::vector<ProcessInfo> high_load_procs_;    //!< @brief processes sorted by CPU usage
+  std::vector<ProcessInfo> high_memory_procs_;  //!< @brief processes sorted by memory usage
+  double elapsed_ms_;                           //!< @brief Execution time of sampling
+  std::mutex mutex_;                            //!< @brief mutex for sampled processes
   rclcpp::CallbackGroup::SharedPtr timer_callback_group_;  //!< @brief Callback Group
 };
 
@@ -0,0 +1,115 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file procfs_reader.hpp
+ * @brief Reader of the system-wide statistics in procfs
+ */
+
+#ifndef SYSTEM_MONITOR__PROCFS_READER_HPP_
+#define SYSTEM_MONITOR__PROCFS_READER_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief CPU time in clock ticks read from a cpu line of /proc/stat
+ */
+struct CpuTicks
+{
+  int cpu{-1};  //!< @brief CPU number, or -1 for all CPUs
+  uint64_t user{0};
+  uint64_t nice{0};
+  uint64_t system{0};
+  uint64_t idle{0};
+  uint64_t iowait{0};
+  uint64_t irq{0};
+  uint64_t softirq{0};
+  uint64_t steal{0};
+
+  /**
+   * @brief sum of the CPU time (guest and guest_nice are included in user and nice)
+   */
+  uint64_t total() const { return user + nice + system + idle + iowait + irq + softirq + steal; }
+};
+
+/**
+ * @brief Memory statistics in KiB read from /proc/meminfo
+ */
+struct MemInfo
+{
+  uint64_t mem_total_kb{0};
+  uint64_t mem_free_kb{0};
+  uint64_t mem_available_kb{0};
+  uint64_t buffers_kb{0};
+  uint64_t cached_kb{0};
+  uint64_t shmem_kb{0};
+  uint64_t sreclaimable_kb{0};
+  uint64_t swap_total_kb{0};
+  uint64_t swap_free_kb{0};
+};
+
+/**
+ * @brief Reader of procfs without spawning child processes. The buffer to read the files is
+ * reused, so that sampling periodically does not allocate memory in the steady state.
+ */
+class ProcfsReader
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] proc_dir mount point of procfs
+   */
+  explicit ProcfsReader(const std::string & proc_dir = "/proc");
+
+  /**
+   * @brief get mount point of procfs
+   * @return mount point of procfs
+   */
+  const std::string & getProcDir() const { return proc_dir_; }
+
+  /**
+   * @brief read a whole file into the reused buffer
+   * @param [in] path file path
+   * @return true if success to read the file
+   */
+  bool readFile(const std::string & path);
+
+  /**
+   * @brief get the content of the file read last
+   * @return content of the file
+   */
+  const std::string & getBuffer() const { return buffer_; }
+
+  /**
+   * @brief read CPU time from /proc/stat
+   * @param [out] cpus CPU time of all CPUs followed by the one of each CPU
+   * @return true if success to read the file
+   */
+  bool readCpuTicks(std::vector<CpuTicks> & cpus);
+
+  /**
+   * @brief read memory statistics from /proc/meminfo
+   * @param [out] mem_info memory statistics
+   * @return true if success to read the file
+   */
+  bool readMemInfo(MemInfo & mem_info);
+
+protected:
+  std::string proc_dir_;  //!< @brief mount point of procfs
+  std::string buffer_;    //!< @brief buffer reused to read files
+};
+
+#endif  // SYSTEM_MONITOR__PROCFS_READER_HPP_
@@ -0,0 +1,350 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file proc_sampler.cpp
+ * @brief Process sampler reading procfs directly
+ */
+
+#include "system_monitor/process_monitor/proc_sampler.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/**
+ * @brief parse an unsigned integer and move the pointer to the next token
+ */
+uint64_t parseUnsigned(const char *& p)
+{
+  while (*p == ' ') {
+    ++p;
+  }
+  char * end = nullptr;
+  const auto value = std::strtoull(p, &end, 10);
+  p = end;
+  return value;
+}
+
+/**
+ * @brief parse a signed integer and move the pointer to the next token
+ */
+int64_t parseSigned(const char *& p)
+{
+  while (*p == ' ') {
+    ++p;
+  }
+  char * end = nullptr;
+  const auto value = std::strtoll(p, &end, 10);
+  p = end;
+  return value;
+}
+
+/**
+ * @brief skip tokens separated by a space
+ */
+void skipTokens(const char *& p, int num)
+{
+  while (num > 0 && *p != '\0') {
+    while (*p == ' ') {
+      ++p;
+    }
+    while (*p != ' ' && *p != '\0') {
+      ++p;
+    }
+    --num;
+  }
+}
+
+/**
+ * @brief format a value with one decimal place in the same way as top
+ */
+std::string toFixed1(const double value)
+{
+  char str[32];
+  std::snprintf(str, sizeof(str), "%.1f", value);
+  return str;
+}
+}  // namespace
+
+ProcSampler::ProcSampler(const std::string & proc_dir)
+: proc_dir_(proc_dir),
+  reader_(proc_dir),
+  clock_ticks_(std::max<int64_t>(sysconf(_SC_CLK_TCK), 1)),
+  page_size_kb_(std::max<int64_t>(sysconf(_SC_PAGESIZE) / 1024, 1)),
+  num_of_cpus_(std::max<int64_t>(sysconf(_SC_NPROCESSORS_ONLN), 1))
+{
+  path_.reserve(64);
+}
+
+bool ProcSampler::readProcessStat(const pid_t pid, ProcessStat & stat)
+{
+  path_ = proc_dir_;
+  path_ += '/';
+  path_ += std::to_string(pid);
+  const auto dir_length = path_.size();
+
+  struct stat dir_stat
+  {
+  };
+  if (::stat(path_.c_str(), &dir_stat) != 0) {
+    return false;
+  }
+  stat.pid = pid;
+  stat.uid = dir_stat.st_uid;
+
+  // /proc/[pid]/stat: pid (comm) state ppid ...
+  path_ += "/stat";
+  if (!reader_.readFile(path_)) {
+    return false;
+  }
+  const auto & buffer = reader_.getBuffer();
+  const auto comm_begin = buffer.find('(');
+  const auto comm_end = buffer.rfind(')');
+  if (comm_begin == std::string::npos || comm_end == std::string::npos || comm_end < comm_begin) {
+    return false;
+  }
+  stat.comm.assign(buffer, comm_begin + 1, comm_end - comm_begin - 1);
+
+  const char * p = buffer.c_str() + comm_end + 1;
+  while (*p == ' ') {
+    ++p;
+  }
+  stat.state = *p;
+  skipTokens(p, 1);  // state
+  skipTokens(p, 10);  // ppid pgrp session tty_nr tpgid flags minflt cminflt majflt cmajflt
+  const auto utime = parseUnsigned(p);
+  const auto stime = parseUnsigned(p);
+  skipTokens(p, 2);  // cutime cstime
+  stat.priority = parseSigned(p);
+  stat.nice = parseSigned(p);
+  skipTokens(p, 3);  // num_threads itrealvalue starttime
+  stat.virtual_kb = parseUnsigned(p) / 1024;
+  stat.ticks = utime + stime;
+
+  // /proc/[pid]/statm: size resident shared ... in pages
+  path_.resize(dir_length);
+  path_ += "/statm";
+  if (!reader_.readFile(path_)) {
+    return false;
+  }
+  p = buffer.c_str();
+  skipTokens(p, 1);  // size
+  stat.resident_kb = parseUnsigned(p) * page_size_kb_;
+  stat.shared_kb = parseUnsigned(p) * page_size_kb_;
+
+  return true;
+}
+
+bool ProcSampler::sample()
+{
+  error_message_.clear();
+
+  if (!reader_.readCpuTicks(cpu_ticks_)) {
+    error_message_ = "failed to read " + proc_dir_ + "/stat";
+    return false;
+  }
+  const auto total_ticks = cpu_ticks_.front().total();
+  if (!reader_.readMemInfo(mem_info_)) {
+    error_message_ = "failed to read " + proc_dir_ + "/meminfo";
+    return false;
+  }
+  const auto mem_total_kb = mem_info_.mem_total_kb;
+
+  DIR * dir = opendir(proc_dir_.c_str());
+  if (dir == nullptr) {
+    error_message_ = "failed to open " + proc_dir_ + ": " + std::strerror(errno);
+    return false;
+  }
+
+  // elapsed time per CPU, so that a process using one core fully is 100% as top
+  const auto elapsed_ticks = total_ticks > prev_total_ticks_ ? total_ticks - prev_total_ticks_ : 0;
+  const double elapsed_ticks_per_cpu =
+    static_cast<double>(elapsed_ticks) / static_cast<double>(num_of_cpus_);
+
+  processes_.clear();
+  curr_ticks_.clear();
+  tasks_summary_ = TasksSummary{};
+
+  ProcessStat stat;
+  while (const auto * entry = readdir(dir)) {
+    char * end = nullptr;
+    const auto pid = std::strtol(entry->d_name, &end, 10);
+    if (end == entry->d_name || *end != '\0') {
+      continue;
+    }
+    // the process may exit while reading
+    if (!readProcessStat(static_cast<pid_t>(pid), stat)) {
+      continue;
+    }
+
+    ++tasks_summary_.total;
+    switch (stat.state) {
+      case 'R':
+        ++tasks_summary_.running;
+        break;
+      case 'S':
+      case 'D':
+      case 'I':
+        ++tasks_summary_.sleeping;
+        break;
+      case 'T':
+      case 't':
+        ++tasks_summary_.stopped;
+        break;
+      case 'Z':
+        ++tasks_summary_.zombie;
+        break;
+      default:
+        break;
+    }
+
+    const auto prev = prev_ticks_.find(stat.pid);
+    const auto delta_ticks =
+      (prev != prev_ticks_.end() && stat.ticks >= prev->second) ? stat.ticks - prev->second : 0;
+    stat.cpu_usage = elapsed_ticks_per_cpu > 0.0
+                       ? static_cast<double>(delta_ticks) / elapsed_ticks_per_cpu * 1e+2
+                       : 0.0;
+    stat.memory_usage =
+      static_cast<double>(stat.resident_kb) / static_cast<double>(mem_total_kb) * 1e+2;
+
+    curr_ticks_.emplace(stat.pid, stat.ticks);
+    processes_.push_back(stat);
+  }
+  closedir(dir);
+
+  // the exited processes are dropped here
+  std::swap(prev_ticks_, curr_ticks_);
+  is_ready_ = prev_total_ticks_ != 0;
+  prev_total_ticks_ = total_ticks;
+
+  return true;
+}
+
+std::vector<ProcessInfo> ProcSampler::getHighLoadProcesses(const size_t num) const
+{
+  std::vector<const ProcessStat *> sorted;
+  sorted.reserve(processes_.size());
+  for (const auto & process : processes_) {
+    sorted.push_back(&process);
+  }
+  const auto n = std::min(num, sorted.size());
+  std::partial_sort(
+    sorted.begin(), sorted.begin() + n, sorted.end(), [](const auto * a, const auto * b) {
+      return a->cpu_usage != b->cpu_usage ? a->cpu_usage > b->cpu_usage : a->pid < b->pid;
+    });
+
+  std::vector<ProcessInfo> infos;
+  for (size_t i = 0; i < n; ++i) {
+    infos.push_back(toProcessInfo(*sorted.at(i)));
+  }
+  return infos;
+}
+
+std::vector<ProcessInfo> ProcSampler::getHighMemoryProcesses(const size_t num) const
+{
+  std::vector<const ProcessStat *> sorted;
+  sorted.reserve(processes_.size());
+  for (const auto & process : processes_) {
+    sorted.push_back(&process);
+  }
+  const auto n = std::min(num, sorted.size());
+  std::partial_sort(
+    sorted.begin(), sorted.begin() + n, sorted.end(), [](const auto * a, const auto * b) {
+      return a->resident_kb != b->resident_kb ? a->resident_kb > b->resident_kb : a->pid < b->pid;
+    });
+
+  std::vector<ProcessInfo> infos;
+  for (size_t i = 0; i < n; ++i) {
+    infos.push_back(toProcessInfo(*sorted.at(i)));
+  }
+  return infos;
+}
+
+ProcessInfo ProcSampler::toProcessInfo(const ProcessStat & stat) const
+{
+  ProcessInfo info;
+  info.processId = std::to_string(stat.pid);
+  info.userName = getUserName(stat.uid);
+  // top shows the real-time priority as rt
+  info.priority = stat.priority <= -100 ? "rt" : std::to_string(stat.priority);
+  info.niceValue = std::to_string(stat.nice);
+  info.virtualImage = std::to_string(stat.virtual_kb);
+  info.residentSize = std::to_string(stat.resident_kb);
+  info.sharedMemSize = std::to_string(stat.shared_kb);
+  info.processStatus = std::string(1, stat.state);
+  info.cpuUsage = toFixed1(stat.cpu_usage);
+  info.memoryUsage = toFixed1(stat.memory_usage);
+
+  // TIME+ in the format of minutes:seconds.hundredths
+  const auto centiseconds = stat.ticks * 100 / static_cast<uint64_t>(clock_ticks_);
+  char time[32];
+  std::snprintf(
+    time, sizeof(time), "%llu:%02llu.%02llu",
+    static_cast<unsigned long long>(centiseconds / 6000),        // NOLINT(runtime/int)
+    static_cast<unsigned long long>((centiseconds / 100) % 60),  // NOLINT(runtime/int)
+    static_cast<unsigned long long>(centiseconds % 100));        // NOLINT(runtime/int)
+  info.cpuTime = time;
+
+  // use the command line as the process monitor did, or the program name for kernel threads
+  std::string cmdline_path = proc_dir_ + "/" + info.processId + "/cmdline";
+  std::string command;
+  const int fd = open(cmdline_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd >= 0) {
+    char chunk[4096];
+    ssize_t size = 0;
+    while ((size = read(fd, chunk, sizeof(chunk))) > 0) {
+      command.append(chunk, static_cast<size_t>(size));
+    }
+    close(fd);
+  }
+  // 0x00 is used as delimiter in /cmdline instead of 0x20 (space), and terminates the last one
+  while (!command.empty() && command.back() == '\0') {
+    command.pop_back();
+  }
+  std::replace(command.begin(), command.end(), '\0', ' ');
+  info.commandName = command.empty() ? stat.comm : command;
+
+  return info;
+}
+
+std::string ProcSampler::getUserName(const uid_t uid) const
+{
+  const auto itr = user_names_.find(uid);
+  if (itr != user_names_.end()) {
+    return itr->second;
+  }
+
+  struct passwd pwd
+  {
+  };
+  struct passwd * result = nullptr;
+  char buffer[1024];
+  std::string name = std::to_string(uid);
+  if (getpwuid_r(uid, &pwd, buffer, sizeof(buffer), &result) == 0 && result != nullptr) {
+    name = result->pw_name;
+  }
+  user_names_.emplace(uid, name);
+  return name;
+}
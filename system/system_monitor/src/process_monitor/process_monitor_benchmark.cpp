@@ -0,0 +1,145 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file process_monitor_benchmark.cpp
+ * @brief Compare the cost of sampling processes from procfs with running top
+ */
+
+#include "system_monitor/process_monitor/proc_sampler.hpp"
+
+#include <getopt.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief print usage
+ */
+void usage()
+{
+  printf("Usage: process_monitor_benchmark [options]\n");
+  printf("  -h --help        : Display help\n");
+  printf("  -i --iteration # : Number of iterations. (default: 20)\n");
+  printf("  -n --num #       : Number of processes to report. (default: 5)\n");
+  printf("\n");
+}
+
+/**
+ * @brief run the function repeatedly and print the elapsed time
+ * @param [in] name name of the method
+ * @param [in] iteration number of iterations
+ * @param [in] func function to measure, which returns false on error
+ */
+void measure(const std::string & name, const int iteration, const std::function<bool()> & func)
+{
+  std::vector<double> elapsed_ms;
+  for (int i = 0; i < iteration; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!func()) {
+      printf("%-8s: failed\n", name.c_str());
+      return;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    elapsed_ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  if (elapsed_ms.empty()) {
+    return;
+  }
+
+  double sum = 0.0;
+  for (const auto ms : elapsed_ms) {
+    sum += ms;
+  }
+  printf(
+    "%-8s: mean %8.3f ms, max %8.3f ms (%d iterations)\n", name.c_str(),
+    sum / static_cast<double>(elapsed_ms.size()),
+    *std::max_element(elapsed_ms.begin(), elapsed_ms.end()), iteration);
+}
+
+/**
+ * @brief run top and read all of its output in the same way as the former process monitor
+ * @return true if top exits successfully
+ */
+bool runTop()
+{
+  FILE * fp = popen("top -bn1 -o %CPU -w 128", "r");
+  if (fp == nullptr) {
+    return false;
+  }
+  char buffer[4096];
+  while (fread(buffer, 1, sizeof(buffer), fp) > 0) {
+  }
+  return pclose(fp) == 0;
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  static struct option long_options[] = {
+    {"help", no_argument, 0, 'h'},
+    {"iteration", required_argument, 0, 'i'},
+    {"num", required_argument, 0, 'n'},
+    {0, 0, 0, 0}};
+
+  // Parse command-line options
+  int c = 0;
+  int option_index = 0;
+  int iteration = 20;
+  int num = 5;
+  while ((c = getopt_long(argc, argv, "hi:n:", long_options, &option_index)) != -1) {
+    switch (c) {
+      case 'h':
+        usage();
+        return EXIT_SUCCESS;
+
+      case 'i':
+        iteration = std::max(1, atoi(optarg));
+        break;
+
+      case 'n':
+        num = std::max(1, atoi(optarg));
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  ProcSampler sampler;
+  // The first sample is the baseline of the CPU usage
+  if (!sampler.sample()) {
+    printf("Failed to read procfs. %s\n", sampler.getErrorMessage().c_str());
+    return EXIT_FAILURE;
+  }
+
+  measure("procfs", iteration, [&sampler, num]() {
+    if (!sampler.sample()) {
+      return false;
+    }
+    sampler.getHighLoadProcesses(num);
+    sampler.getHighMemoryProcesses(num);
+    return true;
+  });
+  measure("top", iteration, runTop);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file procfs_reader.cpp
+ * @brief Reader of the system-wide statistics in procfs
+ */
+
+#include "system_monitor/procfs_reader.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+/**
+ * @brief parse an unsigned integer and move the pointer to the next token
+ */
+uint64_t parseUnsigned(const char *& p)
+{
+  while (*p == ' ') {
+    ++p;
+  }
+  char * end = nullptr;
+  const auto value = std::strtoull(p, &end, 10);
+  p = end;
+  return value;
+}
+}  // namespace
+
+ProcfsReader::ProcfsReader(const std::string & proc_dir) : proc_dir_(proc_dir)
+{
+  buffer_.reserve(4096);
+}
+
+bool ProcfsReader::readFile(const std::string & path)
+{
+  const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  buffer_.clear();
+  char chunk[4096];
+  while (true) {
+    const auto size = read(fd, chunk, sizeof(chunk));
+    if (size < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      close(fd);
+      return false;
+    }
+    if (size == 0) {
+      break;
+    }
+    buffer_.append(chunk, static_cast<size_t>(size));
+  }
+  close(fd);
+  return true;
+}
+
+bool ProcfsReader::readCpuTicks(std::vector<CpuTicks> & cpus)
+{
+  cpus.clear();
+  if (!readFile(proc_dir_ + "/stat")) {
+    return false;
+  }
+
+  // cpu  user nice system idle iowait irq softirq steal guest guest_nice
+  // cpu0 user nice system idle iowait irq softirq steal guest guest_nice
+  const char * p = buffer_.c_str();
+  while (std::strncmp(p, "cpu", 3) == 0) {
+    p += 3;
+    CpuTicks ticks;
+    if (*p != ' ') {
+      char * end = nullptr;
+      ticks.cpu = static_cast<int>(std::strtol(p, &end, 10));
+      p = end;
+    }
+    ticks.user = parseUnsigned(p);
+    ticks.nice = parseUnsigned(p);
+    ticks.system = parseUnsigned(p);
+    ticks.idle = parseUnsigned(p);
+    ticks.iowait = parseUnsigned(p);
+    ticks.irq = parseUnsigned(p);
+    ticks.softirq = parseUnsigned(p);
+    ticks.steal = parseUnsigned(p);
+    cpus.push_back(ticks);
+
+    p = std::strchr(p, '\n');
+    if (p == nullptr) {
+      break;
+    }
+    ++p;
+  }
+
+  // the first line is the sum of all CPUs
+  return !cpus.empty() && cpus.front().cpu < 0;
+}
+
+bool ProcfsReader::readMemInfo(MemInfo & mem_info)
+{
+  mem_info = MemInfo{};
+  if (!readFile(proc_dir_ + "/meminfo")) {
+    return false;
+  }
+
+  // MemTotal:       32809744 kB
+  // the key must be at the beginning of a line, e.g. Cached: is not the one in SwapCached:
+  const auto read_value = [this](const char * key, uint64_t & value) {
+    const auto key_length = std::strlen(key);
+    for (auto pos = buffer_.find(key); pos != std::string::npos; pos = buffer_.find(key, pos + 1)) {
+      if (pos == 0 || buffer_[pos - 1] == '\n') {
+        const char * p = buffer_.c_str() + pos + key_length;
+        value = parseUnsigned(p);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  if (!read_value("MemTotal:", mem_info.mem_total_kb)) {
+    return false;
+  }
+  read_value("MemFree:", mem_info.mem_free_kb);
+  read_value("MemAvailable:", mem_info.mem_available_kb);
+  read_value("Buffers:", mem_info.buffers_kb);
+  read_value("Cached:", mem_info.cached_kb);
+  read_value("Shmem:", mem_info.shmem_kb);
+  read_value("SReclaimable:", mem_info.sreclaimable_kb);
+  read_value("SwapTotal:", mem_info.swap_total_kb);
+  read_value("SwapFree:", mem_info.swap_free_kb);
+  return mem_info.mem_total_kb > 0;
+}
@@ -81,15 +81,12 @@ public:
     // Get directory of executable
     const fs::path exe_path(argv_[0]);
     exe_dir_ = exe_path.parent_path().generic_string();
-    // Get dummy executable path
-    free_ = exe_dir_ + "/free";
   }
 
 protected:
   std::unique_ptr<TestMemMonitor> monitor_;
   rclcpp::Subscription<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr sub_;
   std::string exe_dir_;
-  std::string free_;
 
   void SetUp()
   {
@@ -99,19 +96,10 @@ protected:
     monitor_ = std::make_unique<TestMemMonitor>("test_mem_monitor", node_options);
     sub_ = monitor_->create_subscription<diagnostic_msgs::msg::DiagnosticArray>(
       "/diagnostics", 1000, std::bind(&TestMemMonitor::diagCallback, monitor_.get(), _1));
-
-    // Remove dummy executable if exists
-    if (fs::exists(free_)) {
-      fs::remove(free_);
-    }
   }
 
   void TearDown()
   {
-    // Remove dummy executable if exists
-    if (fs::exists(free_)) {
-      fs::remove(free_);
-    }
     rclcpp::shutdown();
   }
 
@@ -125,15 +113,6 @@ protected:
     }
     return false;
   }
-
-  void modifyPath()
-  {
-    // Modify PATH temporarily
-    auto env = boost::this_process::environment();
-    std::string new_path = env["PATH"].to_string();
-    new_path.insert(0, fmt::format("{}:", exe_dir_));
-    env["PATH"] = new_path;
-  }
 };
 
 TEST_F(MemMonitorTestSuite, usageWarnTest)
@@ -246,31 +225,6 @@ TEST_F(MemMonitorTestSuite, usageErrorTest)
   }
 }
 
-TEST_F(MemMonitorTestSuite, usageFreeErrorTest)
-{
-  // Symlink free1 to free
-  fs::create_symlink(exe_dir_ + "/free1", free_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  ASSERT_TRUE(monitor_->findDiagStatus("Memory Usage", status));
-  ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "free error");
-  ASSERT_TRUE(findValue(status, "free", value));
-}
-
 int main(int argc, char ** argv)
 {
   argv_ = argv;
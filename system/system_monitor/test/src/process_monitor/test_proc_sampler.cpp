@@ -0,0 +1,347 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "system_monitor/process_monitor/proc_sampler.hpp"
+
+#include <gtest/gtest.h>
+#include <pwd.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+/**
+ * @brief sampler with fixed system values so that the results do not depend on the host
+ */
+class TestProcSampler : public ProcSampler
+{
+public:
+  explicit TestProcSampler(const std::string & proc_dir) : ProcSampler(proc_dir)
+  {
+    clock_ticks_ = 100;
+    page_size_kb_ = 4;
+    num_of_cpus_ = 2;
+  }
+};
+
+/**
+ * @brief values written to the fake /proc/[pid] files
+ */
+struct FakeProcess
+{
+  pid_t pid;
+  std::string comm;
+  char state;
+  uint64_t utime;
+  uint64_t stime;
+  int64_t priority;
+  int64_t nice;
+  uint64_t vsize_bytes;
+  uint64_t resident_pages;
+  uint64_t shared_pages;
+  std::string cmdline;
+};
+
+class ProcSamplerTestSuite : public ::testing::Test
+{
+protected:
+  fs::path proc_dir_;
+
+  void SetUp() override
+  {
+    std::string dir = (fs::temp_directory_path() / "test_proc_sampler_XXXXXX").string();
+    ASSERT_NE(mkdtemp(dir.data()), nullptr);
+    proc_dir_ = dir;
+  }
+
+  void TearDown() override { fs::remove_all(proc_dir_); }
+
+  static void writeFile(const fs::path & path, const std::string & content)
+  {
+    std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    ofs << content;
+  }
+
+  void writeSystem(const uint64_t total_ticks, const uint64_t mem_total_kb = 1000000)
+  {
+    // user nice system idle iowait irq softirq steal guest guest_nice
+    writeFile(
+      proc_dir_ / "stat", "cpu  " + std::to_string(total_ticks) +
+                            " 0 0 0 0 0 0 0 100 100\ncpu0 0 0 0 0 0 0 0 0 0 0\nctxt 12345\n");
+    writeFile(
+      proc_dir_ / "meminfo", "MemTotal:       " + std::to_string(mem_total_kb) +
+                               " kB\nMemFree:          500000 kB\n");
+  }
+
+  void writeProcess(const FakeProcess & process)
+  {
+    const auto dir = proc_dir_ / std::to_string(process.pid);
+    fs::create_directories(dir);
+    writeFile(
+      dir / "stat", std::to_string(process.pid) + " (" + process.comm + ") " + process.state +
+                      " 1 1 1 0 -1 4194560 100 0 0 0 " + std::to_string(process.utime) + " " +
+                      std::to_string(process.stime) + " 0 0 " + std::to_string(process.priority) +
+                      " " + std::to_string(process.nice) + " 1 0 5 " +
+                      std::to_string(process.vsize_bytes) + " 100 18446744073709551615\n");
+    writeFile(
+      dir / "statm", "1000 " + std::to_string(process.resident_pages) + " " +
+                       std::to_string(process.shared_pages) + " 10 0 100 0\n");
+    writeFile(dir / "status", "Name:\t" + process.comm + "\nState:\t" + process.state + "\n");
+    writeFile(dir / "cmdline", process.cmdline);
+  }
+
+  static FakeProcess makeProcess(
+    const pid_t pid, const std::string & comm, const char state, const uint64_t ticks,
+    const uint64_t resident_pages, const std::string & cmdline = "")
+  {
+    return FakeProcess{pid, comm, state, ticks, 0, 20, 0, 4096 * 1024, resident_pages, 10, cmdline};
+  }
+};
+
+const ProcessInfo * findProcess(const std::vector<ProcessInfo> & infos, const std::string & pid)
+{
+  for (const auto & info : infos) {
+    if (info.processId == pid) {
+      return &info;
+    }
+  }
+  return nullptr;
+}
+
+TEST_F(ProcSamplerTestSuite, firstSampleIsBaseline)
+{
+  writeSystem(1000);
+  writeProcess(makeProcess(1, "systemd", 'S', 100, 2500, std::string("/sbin/init\0splash\0", 18)));
+  writeProcess(makeProcess(42, "worker", 'R', 100, 100));
+
+  TestProcSampler sampler(proc_dir_.string());
+  ASSERT_TRUE(sampler.sample());
+  EXPECT_TRUE(sampler.getErrorMessage().empty());
+  EXPECT_FALSE(sampler.isReady());
+  EXPECT_EQ(sampler.getTasksSummary().total, 2);
+
+  // the CPU usage is not available without the previous sample
+  for (const auto & info : sampler.getHighLoadProcesses(5)) {
+    EXPECT_EQ(info.cpuUsage, "0.0");
+  }
+}
+
+TEST_F(ProcSamplerTestSuite, cpuUsageFromTwoSamples)
+{
+  TestProcSampler sampler(proc_dir_.string());
+
+  writeSystem(1000);
+  writeProcess(makeProcess(1, "systemd", 'S', 100, 2500));
+  writeProcess(makeProcess(42, "worker", 'R', 1000, 100));
+  writeProcess(makeProcess(43, "idle", 'S', 50, 100));
+  ASSERT_TRUE(sampler.sample());
+
+  // 200 ticks elapse in total, which are 100 ticks per CPU
+  writeSystem(1200);
+  writeProcess(makeProcess(1, "systemd", 'S', 110, 2500));
+  writeProcess(makeProcess(42, "worker", 'R', 1050, 100));
+  writeProcess(makeProcess(43, "idle", 'S', 50, 100));
+  ASSERT_TRUE(sampler.sample());
+  ASSERT_TRUE(sampler.isReady());
+
+  const auto infos = sampler.getHighLoadProcesses(5);
+  ASSERT_EQ(infos.size(), 3u);
+  EXPECT_EQ(infos.at(0).processId, "42");
+  EXPECT_EQ(infos.at(0).cpuUsage, "50.0");
+  EXPECT_EQ(infos.at(1).processId, "1");
+  EXPECT_EQ(infos.at(1).cpuUsage, "10.0");
+  EXPECT_EQ(infos.at(2).processId, "43");
+  EXPECT_EQ(infos.at(2).cpuUsage, "0.0");
+
+  // only the requested number of processes
+  const auto top = sampler.getHighLoadProcesses(1);
+  ASSERT_EQ(top.size(), 1u);
+  EXPECT_EQ(top.front().processId, "42");
+}
+
+TEST_F(ProcSamplerTestSuite, processInformation)
+{
+  writeSystem(1000);
+  auto process =
+    makeProcess(1, "systemd", 'S', 12000, 2500, std::string("/sbin/init\0splash\0", 18));
+  process.stime = 345;
+  process.nice = -5;
+  process.vsize_bytes = 167936 * 1024;
+  writeProcess(process);
+
+  TestProcSampler sampler(proc_dir_.string());
+  ASSERT_TRUE(sampler.sample());
+
+  const auto infos = sampler.getHighMemoryProcesses(1);
+  ASSERT_EQ(infos.size(), 1u);
+  const auto & info = infos.front();
+  EXPECT_EQ(info.processId, "1");
+  EXPECT_EQ(info.priority, "20");
+  EXPECT_EQ(info.niceValue, "-5");
+  EXPECT_EQ(info.virtualImage, "167936");
+  EXPECT_EQ(info.residentSize, "10000");
+  EXPECT_EQ(info.sharedMemSize, "40");
+  EXPECT_EQ(info.processStatus, "S");
+  EXPECT_EQ(info.memoryUsage, "1.0");
+  // 12345 ticks are 123.45 seconds
+  EXPECT_EQ(info.cpuTime, "2:03.45");
+  // the arguments are separated by a space without the trailing delimiter
+  EXPECT_EQ(info.commandName, "/sbin/init splash");
+
+  // the owner of the directory is the user of the process
+  const auto * pw = getpwuid(getuid());
+  EXPECT_EQ(info.userName, pw != nullptr ? pw->pw_name : std::to_string(getuid()));
+}
+
+TEST_F(ProcSamplerTestSuite, commContainingSpacesAndParentheses)
+{
+  writeSystem(1000);
+  // the fields after comm look valid if the stat is split at the first ')'
+  writeProcess(makeProcess(42, "a) R (b c", 'S', 100, 100));
+  writeProcess(makeProcess(43, "(sd-pam)", 'T', 100, 50));
+  auto kernel_thread = makeProcess(44, "kworker/0:1-events", 'I', 100, 0);
+  kernel_thread.priority = -100;
+  writeProcess(kernel_thread);
+
+  TestProcSampler sampler(proc_dir_.string());
+  ASSERT_TRUE(sampler.sample());
+
+  const auto infos = sampler.getHighMemoryProcesses(5);
+  ASSERT_EQ(infos.size(), 3u);
+
+  const auto * spaces = findProcess(infos, "42");
+  ASSERT_NE(spaces, nullptr);
+  EXPECT_EQ(spaces->processStatus, "S");
+  EXPECT_EQ(spaces->priority, "20");
+  EXPECT_EQ(spaces->residentSize, "400");
+  // the program name is used if the command line is empty
+  EXPECT_EQ(spaces->commandName, "a) R (b c");
+
+  const auto * parentheses = findProcess(infos, "43");
+  ASSERT_NE(parentheses, nullptr);
+  EXPECT_EQ(parentheses->processStatus, "T");
+  EXPECT_EQ(parentheses->commandName, "(sd-pam)");
+
+  // the real-time priority is shown in the same way as top
+  const auto * realtime = findProcess(infos, "44");
+  ASSERT_NE(realtime, nullptr);
+  EXPECT_EQ(realtime->priority, "rt");
+  EXPECT_EQ(realtime->commandName, "kworker/0:1-events");
+}
+
+TEST_F(ProcSamplerTestSuite, tasksSummary)
+{
+  writeSystem(1000);
+  writeProcess(makeProcess(1, "running", 'R', 0, 1));
+  writeProcess(makeProcess(2, "sleeping", 'S', 0, 1));
+  writeProcess(makeProcess(3, "disk sleep", 'D', 0, 1));
+  writeProcess(makeProcess(4, "idle", 'I', 0, 1));
+  writeProcess(makeProcess(5, "stopped", 'T', 0, 1));
+  writeProcess(makeProcess(6, "tracing stop", 't', 0, 1));
+  writeProcess(makeProcess(7, "zombie", 'Z', 0, 0));
+  writeProcess(makeProcess(8, "dead", 'X', 0, 0));
+
+  // entries other than the processes are skipped
+  fs::create_directories(proc_dir_ / "self");
+  fs::create_directories(proc_dir_ / "net");
+  fs::create_directories(proc_dir_ / "12ab");
+  writeFile(proc_dir_ / "uptime", "100.00 200.00\n");
+
+  TestProcSampler sampler(proc_dir_.string());
+  ASSERT_TRUE(sampler.sample());
+
+  const auto & summary = sampler.getTasksSummary();
+  EXPECT_EQ(summary.total, 8);
+  EXPECT_EQ(summary.running, 1);
+  EXPECT_EQ(summary.sleeping, 3);
+  EXPECT_EQ(summary.stopped, 2);
+  EXPECT_EQ(summary.zombie, 1);
+}
+
+TEST_F(ProcSamplerTestSuite, exitedProcesses)
+{
+  TestProcSampler sampler(proc_dir_.string());
+
+  writeSystem(1000);
+  writeProcess(makeProcess(1, "systemd", 'S', 100, 2500));
+  writeProcess(makeProcess(42, "worker", 'R', 1000, 100));
+  ASSERT_TRUE(sampler.sample());
+
+  // the process exits while reading, and a new process reuses the pid with less ticks
+  writeSystem(1200);
+  writeProcess(makeProcess(1, "systemd", 'S', 110, 2500));
+  fs::remove(proc_dir_ / "1" / "statm");
+  writeProcess(makeProcess(42, "new worker", 'R', 10, 100));
+  // the stat is broken or the directory is empty if the process has just exited
+  fs::create_directories(proc_dir_ / "100");
+  fs::create_directories(proc_dir_ / "101");
+  writeFile(proc_dir_ / "101" / "stat", "");
+  ASSERT_TRUE(sampler.sample());
+
+  EXPECT_EQ(sampler.getTasksSummary().total, 1);
+  const auto infos = sampler.getHighLoadProcesses(5);
+  ASSERT_EQ(infos.size(), 1u);
+  EXPECT_EQ(infos.front().processId, "42");
+  EXPECT_EQ(infos.front().cpuUsage, "0.0");
+
+  // the ticks of the new process are used as the baseline
+  writeSystem(1400);
+  writeProcess(makeProcess(1, "systemd", 'S', 120, 2500));
+  writeProcess(makeProcess(42, "new worker", 'R', 30, 100));
+  ASSERT_TRUE(sampler.sample());
+  const auto next = sampler.getHighLoadProcesses(5);
+  ASSERT_EQ(next.size(), 2u);
+  EXPECT_EQ(next.front().processId, "42");
+  EXPECT_EQ(next.front().cpuUsage, "20.0");
+}
+
+TEST_F(ProcSamplerTestSuite, procfsError)
+{
+  {
+    TestProcSampler sampler((proc_dir_ / "not_found").string());
+    EXPECT_FALSE(sampler.sample());
+    EXPECT_EQ(
+      sampler.getErrorMessage(), "failed to read " + (proc_dir_ / "not_found").string() + "/stat");
+    EXPECT_FALSE(sampler.isReady());
+  }
+
+  writeSystem(1000);
+  writeProcess(makeProcess(1, "systemd", 'S', 100, 2500));
+  TestProcSampler sampler(proc_dir_.string());
+
+  // invalid format of /proc/stat
+  writeFile(proc_dir_ / "stat", "intr 12345\n");
+  EXPECT_FALSE(sampler.sample());
+  EXPECT_EQ(sampler.getErrorMessage(), "failed to read " + proc_dir_.string() + "/stat");
+
+  // MemTotal is not found
+  writeSystem(1000);
+  writeFile(proc_dir_ / "meminfo", "MemFree:          500000 kB\n");
+  EXPECT_FALSE(sampler.sample());
+  EXPECT_EQ(sampler.getErrorMessage(), "failed to read " + proc_dir_.string() + "/meminfo");
+
+  // the error is cleared by the next sample
+  writeSystem(1000);
+  EXPECT_TRUE(sampler.sample());
+  EXPECT_TRUE(sampler.getErrorMessage().empty());
+}
+}  // namespace
@@ -17,8 +17,6 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <boost/algorithm/string.hpp>
-#include <boost/filesystem.hpp>
-#include <boost/process.hpp>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
@@ -26,21 +24,12 @@
 #include <memory>
 #include <string>
 
-namespace bp = boost::process;
-namespace fs = boost::filesystem;
 using DiagStatus = diagnostic_msgs::msg::DiagnosticStatus;
 
-char ** argv_;
-
 class TestProcessMonitor : public ProcessMonitor
 {
-  friend class ProcessMonitorTestSuite;
-
 public:
-  TestProcessMonitor(const std::string & node_name, const rclcpp::NodeOptions & options)
-  : ProcessMonitor(node_name, options)
-  {
-  }
+  explicit TestProcessMonitor(const rclcpp::NodeOptions & options) : ProcessMonitor(options) {}
 
   void diagCallback(const diagnostic_msgs::msg::DiagnosticArray::ConstSharedPtr diag_msg)
   {
@@ -49,6 +38,10 @@ public:
 
   int getNumOfProcs() const { return num_of_procs_; }
 
+  void setProcDir(const std::string & proc_dir) { sampler_ = ProcSampler(proc_dir); }
+
+  void sample() { onTimer(); }
+
   void update() { updater_.force_update(); }
 
   const std::string removePrefix(const std::string & name)
@@ -58,7 +51,7 @@ public:
 
   bool findDiagStatus(const std::string & name, DiagStatus & status)  // NOLINT
   {
-    for (int i = 0; i < array_.status.size(); ++i) {
+    for (size_t i = 0; i < array_.status.size(); ++i) {
       if (removePrefix(array_.status[i].name) == name) {
         status = array_.status[i];
         return true;
@@ -74,69 +67,21 @@ private:
 
 class ProcessMonitorTestSuite : public ::testing::Test
 {
-public:
-  ProcessMonitorTestSuite()
-  {
-    // Get directory of executable
-    const fs::path exe_path(argv_[0]);
-    exe_dir_ = exe_path.parent_path().generic_string();
-    // Get dummy executable path
-    top_ = exe_dir_ + "/top";
-    echo_ = exe_dir_ + "/echo";
-    sed_ = exe_dir_ + "/sed";
-    sort_ = exe_dir_ + "/sort";
-  }
-
 protected:
   std::unique_ptr<TestProcessMonitor> monitor_;
   rclcpp::Subscription<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr sub_;
-  std::string exe_dir_;
-  std::string top_;
-  std::string echo_;
-  std::string sed_;
-  std::string sort_;
 
   void SetUp()
   {
     using std::placeholders::_1;
     rclcpp::init(0, nullptr);
     rclcpp::NodeOptions node_options;
-    monitor_ = std::make_unique<TestProcessMonitor>("test_process_monitor", node_options);
+    monitor_ = std::make_unique<TestProcessMonitor>(node_options);
     sub_ = monitor_->create_subscription<diagnostic_msgs::msg::DiagnosticArray>(
       "/diagnostics", 1000, std::bind(&TestProcessMonitor::diagCallback, monitor_.get(), _1));
-
-    // Remove dummy executable if exists
-    if (fs::exists(top_)) {
-      fs::remove(top_);
-    }
-    if (fs::exists(echo_)) {
-      fs::remove(echo_);
-    }
-    if (fs::exists(sed_)) {
-      fs::remove(sed_);
-    }
-    if (fs::exists(sort_)) {
-      fs::remove(sort_);
-    }
   }
 
-  void TearDown()
-  {
-    // Remove dummy executable if exists
-    if (fs::exists(top_)) {
-      fs::remove(top_);
-    }
-    if (fs::exists(echo_)) {
-      fs::remove(echo_);
-    }
-    if (fs::exists(sed_)) {
-      fs::remove(sed_);
-    }
-    if (fs::exists(sort_)) {
-      fs::remove(sort_);
-    }
-    rclcpp::shutdown();
-  }
+  void TearDown() { rclcpp::shutdown(); }
 
   bool findValue(const DiagStatus status, const std::string & key, std::string & value)  // NOLINT
   {
@@ -149,39 +94,50 @@ protected:
     return false;
   }
 
-  void modifyPath()
+  void publish()
   {
-    // Modify PATH temporarily
-    auto env = boost::this_process::environment();
-    std::string new_path = env["PATH"].to_string();
-    new_path.insert(0, fmt::format("{}:", exe_dir_));
-    env["PATH"] = new_path;
+    // Publish topic
+    monitor_->update();
+
+    // Give time to publish
+    rclcpp::WallRate(2).sleep();
+    rclcpp::spin_some(monitor_->get_node_base_interface());
   }
 };
 
-TEST_F(ProcessMonitorTestSuite, tasksSummaryTest)
+TEST_F(ProcessMonitorTestSuite, startingUpTest)
 {
-  // Publish topic
-  monitor_->update();
+  // The processes are sampled only once
+  monitor_->sample();
+  publish();
+
+  // Verify
+  DiagStatus status;
+  ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
+  ASSERT_EQ(status.level, DiagStatus::OK);
+  ASSERT_STREQ(status.message.c_str(), "starting up");
+}
 
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
+TEST_F(ProcessMonitorTestSuite, tasksSummaryTest)
+{
+  monitor_->sample();
+  monitor_->sample();
+  publish();
 
   // Verify
   DiagStatus status;
+  std::string value;
   ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
   ASSERT_EQ(status.level, DiagStatus::OK);
+  ASSERT_TRUE(findValue(status, "total", value));
+  ASSERT_GT(std::stoi(value), 0);
 }
 
 TEST_F(ProcessMonitorTestSuite, highLoadProcTest)
 {
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
+  monitor_->sample();
+  monitor_->sample();
+  publish();
 
   // Verify
   DiagStatus status;
@@ -190,17 +146,15 @@ TEST_F(ProcessMonitorTestSuite, highLoadProcTest)
   for (int i = 0; i < monitor_->getNumOfProcs(); ++i) {
     ASSERT_TRUE(monitor_->findDiagStatus(fmt::format("High-load Proc[{}]", i), status));
     ASSERT_EQ(status.level, DiagStatus::OK);
+    ASSERT_TRUE(findValue(status, "%CPU", value));
   }
 }
 
 TEST_F(ProcessMonitorTestSuite, highMemProcTest)
 {
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
+  monitor_->sample();
+  monitor_->sample();
+  publish();
 
   // Verify
   DiagStatus status;
@@ -209,23 +163,16 @@ TEST_F(ProcessMonitorTestSuite, highMemProcTest)
   for (int i = 0; i < monitor_->getNumOfProcs(); ++i) {
     ASSERT_TRUE(monitor_->findDiagStatus(fmt::format("High-mem Proc[{}]", i), status));
     ASSERT_EQ(status.level, DiagStatus::OK);
+    ASSERT_TRUE(findValue(status, "%MEM", value));
   }
 }
 
-TEST_F(ProcessMonitorTestSuite, topErrorTest)
+TEST_F(ProcessMonitorTestSuite, procfsErrorTest)
 {
-  // Symlink top1 to top
-  fs::create_symlink(exe_dir_ + "/top1", top_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
+  // Read procfs from a directory which does not exist
+  monitor_->setProcDir("/nonexistent_proc");
+  monitor_->sample();
+  publish();
 
   // Verify
   DiagStatus status;
@@ -233,146 +180,23 @@ TEST_F(ProcessMonitorTestSuite, topErrorTest)
 
   ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
   ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "top error");
-  ASSERT_TRUE(findValue(status, "top", value));
-  ASSERT_STREQ(value.c_str(), "");
+  ASSERT_STREQ(status.message.c_str(), "procfs error");
+  ASSERT_TRUE(findValue(status, "procfs", value));
+  ASSERT_STREQ(value.c_str(), "failed to read /nonexistent_proc/stat");
 
   for (int i = 0; i < monitor_->getNumOfProcs(); ++i) {
     ASSERT_TRUE(monitor_->findDiagStatus(fmt::format("High-load Proc[{}]", i), status));
     ASSERT_EQ(status.level, DiagStatus::ERROR);
-    ASSERT_STREQ(status.message.c_str(), "top error");
-
-    ASSERT_TRUE(monitor_->findDiagStatus(fmt::format("High-mem Proc[{}]", i), status));
-    ASSERT_EQ(status.level, DiagStatus::ERROR);
-    ASSERT_STREQ(status.message.c_str(), "top error");
-  }
-}
-
-TEST_F(ProcessMonitorTestSuite, matchingPatternNotFoundTest)
-{
-  // Symlink top2 to top
-  fs::create_symlink(exe_dir_ + "/top2", top_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
-  ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "matching pattern not found");
-}
-
-TEST_F(ProcessMonitorTestSuite, invalidFormatTest)
-{
-  // Symlink top3 to top
-  fs::create_symlink(exe_dir_ + "/top3", top_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
-  ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "invalid format");
-}
-
-TEST_F(ProcessMonitorTestSuite, echoErrorTest)
-{
-  // Symlink sed1 to sed
-  fs::create_symlink(exe_dir_ + "/echo1", echo_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
-  ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "echo error");
-}
-
-TEST_F(ProcessMonitorTestSuite, sedErrorTest)
-{
-  // Symlink sed1 to sed
-  fs::create_symlink(exe_dir_ + "/sed1", sed_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
-
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  ASSERT_TRUE(monitor_->findDiagStatus("Tasks Summary", status));
-  ASSERT_EQ(status.level, DiagStatus::ERROR);
-  ASSERT_STREQ(status.message.c_str(), "sed error");
-}
-
-TEST_F(ProcessMonitorTestSuite, sortErrorTest)
-{
-  // Symlink sort1 to sort
-  fs::create_symlink(exe_dir_ + "/sort1", sort_);
-
-  // Modify PATH temporarily
-  modifyPath();
-
-  // Publish topic
-  monitor_->update();
+    ASSERT_STREQ(status.message.c_str(), "procfs error");
 
-  // Give time to publish
-  rclcpp::WallRate(2).sleep();
-  rclcpp::spin_some(monitor_->get_node_base_interface());
-
-  // Verify
-  DiagStatus status;
-  std::string value;
-
-  for (int i = 0; i < monitor_->getNumOfProcs(); ++i) {
     ASSERT_TRUE(monitor_->findDiagStatus(fmt::format("High-mem Proc[{}]", i), status));
     ASSERT_EQ(status.level, DiagStatus::ERROR);
-    ASSERT_STREQ(status.message.c_str(), "sort error");
+    ASSERT_STREQ(status.message.c_str(), "procfs error");
   }
 }
 
 int main(int argc, char ** argv)
 {
-  argv_ = argv;
   testing::InitGoogleTest(&argc, argv);
 
   return RUN_ALL_TESTS();
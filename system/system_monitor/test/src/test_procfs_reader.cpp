@@ -0,0 +1,135 @@
+// Copyright 2024 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "system_monitor/procfs_reader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+class ProcfsReaderTestSuite : public ::testing::Test
+{
+protected:
+  fs::path proc_dir_;
+
+  void SetUp() override
+  {
+    std::string dir = (fs::temp_directory_path() / "test_procfs_reader_XXXXXX").string();
+    ASSERT_NE(mkdtemp(dir.data()), nullptr);
+    proc_dir_ = dir;
+  }
+
+  void TearDown() override { fs::remove_all(proc_dir_); }
+
+  void writeFile(const std::string & name, const std::string & content)
+  {
+    std::ofstream ofs(proc_dir_ / name, std::ios::binary | std::ios::trunc);
+    ofs << content;
+  }
+};
+}  // namespace
+
+TEST_F(ProcfsReaderTestSuite, readCpuTicks)
+{
+  writeFile(
+    "stat",
+    "cpu  300 10 100 5000 20 1 2 3 50 0\n"
+    "cpu0 200 10 60 2400 15 1 1 2 50 0\n"
+    "cpu1 100 0 40 2600 5 0 1 1 0 0\n"
+    "intr 12345 0 0\n"
+    "ctxt 67890\n");
+
+  ProcfsReader reader(proc_dir_.string());
+  std::vector<CpuTicks> cpus;
+  ASSERT_TRUE(reader.readCpuTicks(cpus));
+  ASSERT_EQ(cpus.size(), 3u);
+
+  EXPECT_EQ(cpus.at(0).cpu, -1);
+  EXPECT_EQ(cpus.at(0).user, 300u);
+  EXPECT_EQ(cpus.at(0).nice, 10u);
+  EXPECT_EQ(cpus.at(0).system, 100u);
+  EXPECT_EQ(cpus.at(0).idle, 5000u);
+  EXPECT_EQ(cpus.at(0).iowait, 20u);
+  EXPECT_EQ(cpus.at(0).steal, 3u);
+  // guest is included in user
+  EXPECT_EQ(cpus.at(0).total(), 5436u);
+
+  EXPECT_EQ(cpus.at(1).cpu, 0);
+  EXPECT_EQ(cpus.at(1).user, 200u);
+  EXPECT_EQ(cpus.at(2).cpu, 1);
+  EXPECT_EQ(cpus.at(2).idle, 2600u);
+
+  // the vector is reused
+  ASSERT_TRUE(reader.readCpuTicks(cpus));
+  EXPECT_EQ(cpus.size(), 3u);
+}
+
+TEST_F(ProcfsReaderTestSuite, readCpuTicksError)
+{
+  ProcfsReader reader(proc_dir_.string());
+  std::vector<CpuTicks> cpus;
+  EXPECT_FALSE(reader.readCpuTicks(cpus));
+
+  // the line of all CPUs is missing
+  writeFile("stat", "cpu0 200 10 60 2400 15 1 1 2 50 0\nctxt 67890\n");
+  EXPECT_FALSE(reader.readCpuTicks(cpus));
+}
+
+TEST_F(ProcfsReaderTestSuite, readMemInfo)
+{
+  // SwapCached is written before Cached to check that the key is matched at the line head
+  writeFile(
+    "meminfo",
+    "MemTotal:       32809744 kB\n"
+    "MemFree:        13090376 kB\n"
+    "MemAvailable:   19622092 kB\n"
+    "Buffers:          500000 kB\n"
+    "SwapCached:        12345 kB\n"
+    "Cached:          6000000 kB\n"
+    "Shmem:            292840 kB\n"
+    "SReclaimable:     664588 kB\n"
+    "SwapTotal:      33554428 kB\n"
+    "SwapFree:       31786748 kB\n");
+
+  ProcfsReader reader(proc_dir_.string());
+  MemInfo mem_info;
+  ASSERT_TRUE(reader.readMemInfo(mem_info));
+  EXPECT_EQ(mem_info.mem_total_kb, 32809744u);
+  EXPECT_EQ(mem_info.mem_free_kb, 13090376u);
+  EXPECT_EQ(mem_info.mem_available_kb, 19622092u);
+  EXPECT_EQ(mem_info.buffers_kb, 500000u);
+  EXPECT_EQ(mem_info.cached_kb, 6000000u);
+  EXPECT_EQ(mem_info.shmem_kb, 292840u);
+  EXPECT_EQ(mem_info.sreclaimable_kb, 664588u);
+  EXPECT_EQ(mem_info.swap_total_kb, 33554428u);
+  EXPECT_EQ(mem_info.swap_free_kb, 31786748u);
+}
+
+TEST_F(ProcfsReaderTestSuite, readMemInfoError)
+{
+  ProcfsReader reader(proc_dir_.string());
+  MemInfo mem_info;
+  EXPECT_FALSE(reader.readMemInfo(mem_info));
+
+  writeFile("meminfo", "MemFree:        13090376 kB\n");
+  EXPECT_FALSE(reader.readMemInfo(mem_info));
+}